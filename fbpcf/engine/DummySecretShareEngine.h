@@ -23,7 +23,8 @@ namespace fbpcf::engine {
  */
 class DummySecretShareEngine final : public ISecretShareEngine {
  public:
-  explicit DummySecretShareEngine(int myId) : myId_(myId) {}
+  explicit DummySecretShareEngine(int myId, int numberOfParty = 2)
+      : myId_(myId), numberOfParty_(numberOfParty) {}
 
   /**
    * @inherit doc
@@ -246,6 +247,13 @@ class DummySecretShareEngine final : public ISecretShareEngine {
     return {0, 0};
   }
 
+  /**
+   * @inherit doc
+   */
+  std::chrono::nanoseconds getTupleGenerationTime() const override {
+    return std::chrono::nanoseconds::zero();
+  }
+
   /**
    * @inherit doc
    */
@@ -346,6 +354,70 @@ class DummySecretShareEngine final : public ISecretShareEngine {
     return left;
   }
 
+  //======== Below are share conversion API's: ========
+
+  /**
+   * @inherit doc
+   */
+  int getNumberOfParties() const override {
+    return numberOfParty_;
+  }
+
+  /**
+   * @inherit doc
+   */
+  uint64_t computeBooleanShareToInteger(int /* partyId */, bool share)
+      const override {
+    return share;
+  }
+
+  /**
+   * @inherit doc
+   */
+  std::vector<uint64_t> computeBatchBooleanShareToInteger(
+      int /* partyId */,
+      const std::vector<bool>& shares) const override {
+    return std::vector<uint64_t>(shares.begin(), shares.end());
+  }
+
+  /**
+   * @inherit doc
+   */
+  std::vector<bool> computeIntegerShareToBooleans(
+      int /* partyId */,
+      uint64_t /* share */) const override {
+    return std::vector<bool>(64);
+  }
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<bool>> computeBatchIntegerShareToBooleans(
+      int /* partyId */,
+      const std::vector<uint64_t>& shares) const override {
+    return std::vector<std::vector<bool>>(
+        64, std::vector<bool>(shares.size()));
+  }
+
+  //======== Below are truncation API's: ========
+
+  /**
+   * @inherit doc
+   */
+  uint64_t computeTruncation(uint64_t share, size_t /* bits */)
+      const override {
+    return share;
+  }
+
+  /**
+   * @inherit doc
+   */
+  std::vector<uint64_t> computeBatchTruncation(
+      const std::vector<uint64_t>& shares,
+      size_t /* bits */) const override {
+    return shares;
+  }
+
   //======== Below are API's to schedule non-free Mult's: ========
 
   /**
@@ -425,6 +497,7 @@ class DummySecretShareEngine final : public ISecretShareEngine {
   std::vector<std::vector<uint64_t>> dummyBatchMultResults_;
 
   int myId_;
+  int numberOfParty_;
 };
 
 } // namespace fbpcf::engine
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <chrono>
 #include <cstdint>
 #include <optional>
 #include <vector>
@@ -275,6 +276,93 @@ class ISecretShareEngine {
       const std::vector<uint64_t>& left,
       const std::vector<uint64_t>& right) const = 0;
 
+  //======== Below are share conversion API's: ========
+
+  /**
+   * Get the number of parties holding a share of each secret.
+   */
+  virtual int getNumberOfParties() const = 0;
+
+  /**
+   * Convert one party's share of a boolean secret into an integer secret
+   * share: the share of party partyId becomes the integer 0 or 1 and the
+   * shares of all other parties become 0. Thus the result is an integer
+   * sharing of partyId's boolean share rather than of the secret, which is the
+   * XOR of these integers over all parties. This computation can be done
+   * locally, without any interaction with other parties.
+   * @param partyId the party whose share is converted
+   * @param share this party's share of the boolean secret
+   * @return this party's share of the integer
+   */
+  virtual uint64_t computeBooleanShareToInteger(int partyId, bool share)
+      const = 0;
+
+  /**
+   * Compute a batch of boolean share to integer conversions, see
+   * computeBooleanShareToInteger().
+   * @param partyId the party whose shares are converted
+   * @param shares this party's shares of the boolean secrets
+   * @return this party's shares of the integers
+   */
+  virtual std::vector<uint64_t> computeBatchBooleanShareToInteger(
+      int partyId,
+      const std::vector<bool>& shares) const = 0;
+
+  /**
+   * Decompose one party's share of an integer secret into boolean secret
+   * shares of its bits: party partyId's shares are the bits of its integer
+   * share and the shares of all other parties are 0. Thus the result is a
+   * boolean sharing of partyId's integer share rather than of the secret,
+   * which is the sum of these integers over all parties. This computation can
+   * be done locally, without any interaction with other parties.
+   * @param partyId the party whose share is decomposed
+   * @param share this party's share of the integer secret
+   * @return this party's shares of the 64 bits, least significant first
+   */
+  virtual std::vector<bool> computeIntegerShareToBooleans(
+      int partyId,
+      uint64_t share) const = 0;
+
+  /**
+   * Compute a batch of integer share decompositions, see
+   * computeIntegerShareToBooleans().
+   * @param partyId the party whose shares are decomposed
+   * @param shares this party's shares of the integer secrets
+   * @return this party's shares of the 64 bits of each integer, indexed by
+   * bit first and by position in the batch second
+   */
+  virtual std::vector<std::vector<bool>> computeBatchIntegerShareToBooleans(
+      int partyId,
+      const std::vector<uint64_t>& shares) const = 0;
+
+  //======== Below are truncation API's: ========
+
+  /**
+   * Compute this party's share of an integer secret x divided by 2^bits, i.e.
+   * shifted to the right as a signed integer, with probabilistic truncation in
+   * the style of SecureML: every party shifts its own share as a signed
+   * integer. This computation can be done locally, without any interaction
+   * with other parties, but the result may be smaller by up to one in its last
+   * bit for each party but the first. Moreover, if the signed shares overflow
+   * when they are added up, which happens with probability about
+   * 2^(l + 1 - 64) per party when |x| < 2^l, the result is wrong entirely.
+   * Thus callers must keep l well below 64.
+   * @param share this party's share of the integer secret
+   * @param bits the number of bits to truncate
+   * @return this party's share of the truncated integer
+   */
+  virtual uint64_t computeTruncation(uint64_t share, size_t bits) const = 0;
+
+  /**
+   * Compute a batch of truncations, see computeTruncation().
+   * @param shares this party's shares of the integer secrets
+   * @param bits the number of bits to truncate
+   * @return this party's shares of the truncated integers
+   */
+  virtual std::vector<uint64_t> computeBatchTruncation(
+      const std::vector<uint64_t>& shares,
+      size_t bits) const = 0;
+
   //======== Below are API's to schedule non-free AND's: ========
 
   /** Schedule an AND gate for computation. Since computing AND gates incurs 2
@@ -457,6 +545,14 @@ class ISecretShareEngine {
    * @return a pair of (sent, received) data in bytes.
    */
   virtual std::pair<uint64_t, uint64_t> getTrafficStatistics() const = 0;
+
+  /**
+   * Get the total wall time spent on obtaining tuples (e.g. AND/Mult triples)
+   * while executing scheduled operations. This is part of the time spent in
+   * executeScheduledOperations() and the computeBatch*Immediately() APIs.
+   * @return the accumulated duration
+   */
+  virtual std::chrono::nanoseconds getTupleGenerationTime() const = 0;
 };
 
 } // namespace fbpcf::engine
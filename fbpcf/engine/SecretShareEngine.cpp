@@ -7,6 +7,7 @@
 
 #include <fmt/format.h>
 #include <sys/types.h>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -332,6 +333,70 @@ std::vector<uint64_t> SecretShareEngine::computeBatchFreeMult(
   return rst;
 }
 
+//======== Below are share conversion API's: ========
+
+uint64_t SecretShareEngine::computeBooleanShareToInteger(
+    int partyId,
+    bool share) const {
+  return (partyId == myId_) && share;
+}
+
+std::vector<uint64_t> SecretShareEngine::computeBatchBooleanShareToInteger(
+    int partyId,
+    const std::vector<bool>& shares) const {
+  std::vector<uint64_t> rst(shares.size(), 0);
+  if (partyId == myId_) {
+    for (size_t i = 0; i < shares.size(); i++) {
+      rst[i] = shares[i];
+    }
+  }
+  return rst;
+}
+
+std::vector<bool> SecretShareEngine::computeIntegerShareToBooleans(
+    int partyId,
+    uint64_t share) const {
+  std::vector<bool> rst(64, false);
+  if (partyId == myId_) {
+    for (size_t i = 0; i < rst.size(); i++) {
+      rst[i] = (share >> i) & 1;
+    }
+  }
+  return rst;
+}
+
+std::vector<std::vector<bool>>
+SecretShareEngine::computeBatchIntegerShareToBooleans(
+    int partyId,
+    const std::vector<uint64_t>& shares) const {
+  std::vector<std::vector<bool>> rst(64, std::vector<bool>(shares.size()));
+  if (partyId == myId_) {
+    for (size_t i = 0; i < rst.size(); i++) {
+      for (size_t j = 0; j < shares.size(); j++) {
+        rst[i][j] = (shares[j] >> i) & 1;
+      }
+    }
+  }
+  return rst;
+}
+
+//======== Below are truncation API's: ========
+
+uint64_t SecretShareEngine::computeTruncation(uint64_t share, size_t bits)
+    const {
+  return static_cast<uint64_t>(static_cast<int64_t>(share) >> bits);
+}
+
+std::vector<uint64_t> SecretShareEngine::computeBatchTruncation(
+    const std::vector<uint64_t>& shares,
+    size_t bits) const {
+  std::vector<uint64_t> rst(shares.size());
+  for (size_t i = 0; i < shares.size(); i++) {
+    rst[i] = computeTruncation(shares[i], bits);
+  }
+  return rst;
+}
+
 //======== Below are API's to schedule non-free AND's: ========
 
 uint32_t SecretShareEngine::scheduleAND(bool left, bool right) {
@@ -535,9 +600,11 @@ SecretShareEngine::computeAllScheduledOperations(
           std::vector<std::vector<uint64_t>>()};
     }
 
+    auto tupleStart = std::chrono::steady_clock::now();
     auto [normalTuples, compositeTuples] =
         tupleGenerator_->getNormalAndCompositeBooleanTuples(
             normalTupleCount, compositeTupleCount);
+    tupleGenerationTime_ += std::chrono::steady_clock::now() - tupleStart;
 
     auto secretsToOpen = computeSecretSharesToOpen(
         ands,
@@ -554,8 +621,10 @@ SecretShareEngine::computeAllScheduledOperations(
       throw std::runtime_error("unexpected number of opened secrets");
     }
 
+    tupleStart = std::chrono::steady_clock::now();
     auto integerTuples =
         arithmeticTupleGenerator_->getIntegerTuple(integerTupleCount);
+    tupleGenerationTime_ += std::chrono::steady_clock::now() - tupleStart;
 
     auto integerSecretsToOpen = computeSecretSharesToOpen(
         mults, batchMults, integerTuples, openedIntegerSecretCount);
@@ -601,7 +670,9 @@ SecretShareEngine::computeAllScheduledOperations(
           std::vector<std::vector<uint64_t>>()};
     }
 
+    auto tupleStart = std::chrono::steady_clock::now();
     auto tuples = tupleGenerator_->getBooleanTuple(normalTupleCount);
+    tupleGenerationTime_ += std::chrono::steady_clock::now() - tupleStart;
 
     auto secretsToOpen = computeSecretSharesToOpenLegacy(
         ands, batchAnds, compositeAnds, batchCompositeAnds, tuples);
@@ -613,8 +684,10 @@ SecretShareEngine::computeAllScheduledOperations(
       throw std::runtime_error("unexpected number of opened secrets");
     }
 
+    tupleStart = std::chrono::steady_clock::now();
     auto integerTuples =
         arithmeticTupleGenerator_->getIntegerTuple(integerTupleCount);
+    tupleGenerationTime_ += std::chrono::steady_clock::now() - tupleStart;
 
     size_t openedIntegerSecretCount = integerTupleCount * 2;
     auto integerSecretsToOpen = computeSecretSharesToOpen(
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -229,6 +230,55 @@ class SecretShareEngine final : public ISecretShareEngine {
       const std::vector<uint64_t>& left,
       const std::vector<uint64_t>& right) const override;
 
+  //======== Below are share conversion API's: ========
+
+  /**
+   * @inherit doc
+   */
+  int getNumberOfParties() const override {
+    return numberOfParty_;
+  }
+
+  /**
+   * @inherit doc
+   */
+  uint64_t computeBooleanShareToInteger(int partyId, bool share)
+      const override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<uint64_t> computeBatchBooleanShareToInteger(
+      int partyId,
+      const std::vector<bool>& shares) const override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<bool> computeIntegerShareToBooleans(int partyId, uint64_t share)
+      const override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<bool>> computeBatchIntegerShareToBooleans(
+      int partyId,
+      const std::vector<uint64_t>& shares) const override;
+
+  //======== Below are truncation API's: ========
+
+  /**
+   * @inherit doc
+   */
+  uint64_t computeTruncation(uint64_t share, size_t bits) const override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<uint64_t> computeBatchTruncation(
+      const std::vector<uint64_t>& shares,
+      size_t bits) const override;
+
   //======== Below are API's to schedule non-free Mult's: ========
 
   /**
@@ -289,6 +339,13 @@ class SecretShareEngine final : public ISecretShareEngine {
         onlineCost.second + offlineCost.second};
   }
 
+  /**
+   * @inherit doc
+   */
+  std::chrono::nanoseconds getTupleGenerationTime() const override {
+    return tupleGenerationTime_;
+  }
+
  private:
   struct ExecutionResults {
     std::vector<bool> andResults;
@@ -526,6 +583,8 @@ class SecretShareEngine final : public ISecretShareEngine {
   int myId_;
   int numberOfParty_;
 
+  std::chrono::nanoseconds tupleGenerationTime_{0};
+
   // A pair of prg is kept for each peer party. We need a pair so every party
   // can decide the randomness used for masking his/her private inputs: the
   // first prg in the pair is to mask this party's input; the second one is to
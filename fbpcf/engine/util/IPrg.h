@@ -10,6 +10,7 @@
 #include <assert.h>
 #include <emmintrin.h>
 #include <cstdint>
+#include <vector>
 #include "fbpcf/engine/util/util.h"
 
 namespace fbpcf::engine::util {
@@ -24,6 +25,22 @@ class IPrg {
     return buildM128i(randomBytes);
   }
 
+  /**
+   * Generate random 128-bit blocks from a single request of random bytes
+   * @param size the number of random blocks being generated
+   * @return each element in the vector is a random block
+   */
+  std::vector<__m128i> getRandomM128i(uint32_t size) {
+    auto randomBytes = getRandomBytes(16 * size);
+    assert(randomBytes.size() == 16 * size);
+    std::vector<__m128i> rst(size);
+    for (size_t i = 0; i < size; i++) {
+      rst[i] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(randomBytes.data() + 16 * i));
+    }
+    return rst;
+  }
+
   virtual std::vector<bool> getRandomBits(uint32_t size) = 0;
 
   /**
@@ -71,19 +71,40 @@ std::array<__m128i, 11> Aes::expandDecryptionKey(__m128i key) {
 }
 
 void Aes::encryptInPlace(std::vector<__m128i>& plaintext) const {
-  // Using naked pointer for best performance. This is very hot code.
-  uint32_t size = plaintext.size();
-  auto dataPointer = plaintext.data();
-  for (unsigned int i = 0; i < size; ++i) {
-    dataPointer[i] = _mm_xor_si128(dataPointer[i], roundKey_.at(0));
+  encryptInPlace(plaintext.data(), plaintext.size());
+}
+
+namespace {
+
+template <size_t blockCount>
+inline void encryptBlocks(
+    const std::array<__m128i, 11>& roundKey,
+    __m128i* dataPointer) {
+  __m128i blocks[blockCount];
+  for (size_t i = 0; i < blockCount; ++i) {
+    blocks[i] = _mm_xor_si128(dataPointer[i], roundKey[0]);
   }
-  for (unsigned int j = 1; j < kRound; ++j) {
-    for (unsigned int i = 0; i < size; ++i) {
-      dataPointer[i] = _mm_aesenc_si128(dataPointer[i], roundKey_.at(j));
+  for (size_t j = 1; j < roundKey.size() - 1; ++j) {
+    for (size_t i = 0; i < blockCount; ++i) {
+      blocks[i] = _mm_aesenc_si128(blocks[i], roundKey[j]);
     }
   }
-  for (unsigned int i = 0; i < size; ++i) {
-    dataPointer[i] = _mm_aesenclast_si128(dataPointer[i], roundKey_.at(kRound));
+  for (size_t i = 0; i < blockCount; ++i) {
+    dataPointer[i] =
+        _mm_aesenclast_si128(blocks[i], roundKey[roundKey.size() - 1]);
+  }
+}
+
+} // namespace
+
+void Aes::encryptInPlace(__m128i* data, size_t size) const {
+  // Using naked pointer for best performance. This is very hot code.
+  size_t i = 0;
+  for (; i + kPipelineDepth <= size; i += kPipelineDepth) {
+    encryptBlocks<kPipelineDepth>(roundKey_, data + i);
+  }
+  for (; i < size; ++i) {
+    encryptBlocks<1>(roundKey_, data + i);
   }
 }
 
@@ -10,6 +10,7 @@
 #include <wmmintrin.h>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -57,6 +58,13 @@ class Aes {
 
   void encryptInPlace(std::vector<__m128i>& plaintext) const;
 
+  /**
+   * Encrypt size blocks starting from data. The blocks are encrypted
+   * kPipelineDepth at a time, so that independent AES rounds are in flight in
+   * the pipeline of the AES unit, while the blocks stay in registers.
+   */
+  void encryptInPlace(__m128i* data, size_t size) const;
+
   void inPlaceHash(std::vector<__m128i>& src) const;
 
   static __m128i getFixedKey();
@@ -67,6 +75,7 @@ class Aes {
 
  protected:
   static const uint8_t kRound = 10;
+  static const uint8_t kPipelineDepth = 8;
   std::array<__m128i, 11> roundKey_;
 
   // copy-pasted from intel's whitepaper
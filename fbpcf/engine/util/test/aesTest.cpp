@@ -38,4 +38,29 @@ TEST(aesTest, testEncryptionAndDecryption) {
   }
 }
 
+TEST(aesTest, testPipelinedEncryption) {
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint32_t> dist(0, 0xFFFFFFFF);
+
+  __m128i key = _mm_set_epi32(dist(e), dist(e), dist(e), dist(e));
+  Aes cipher(key);
+
+  // a size that is not a multiple of the pipeline depth
+  std::vector<__m128i> plaintext(29);
+  for (auto& block : plaintext) {
+    block = _mm_set_epi32(dist(e), dist(e), dist(e), dist(e));
+  }
+  auto ciphertext = plaintext;
+  cipher.encryptInPlace(ciphertext);
+
+  for (size_t i = 0; i < plaintext.size(); i++) {
+    std::vector<__m128i> block{plaintext.at(i)};
+    cipher.encryptInPlace(block.data(), 1);
+    EXPECT_TRUE(_mm_testz_si128(
+        _mm_xor_si128(block.at(0), ciphertext.at(i)),
+        _mm_xor_si128(block.at(0), ciphertext.at(i))));
+  }
+}
+
 } // namespace fbpcf::engine::util
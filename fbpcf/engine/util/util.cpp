@@ -6,6 +6,7 @@
  */
 
 #include "fbpcf/engine/util/util.h"
+#include <algorithm>
 
 namespace fbpcf::engine::util {
 
@@ -16,18 +17,28 @@ Expander::Expander(int64_t index)
 std::vector<__m128i> Expander::expand(std::vector<__m128i>&& src) const {
   // expand n __m128i variable to 2n __m128i variable with two ciphers
   assert(!std::empty(src));
-  std::vector<__m128i> tmp = src;
-  cipher0_.encryptInPlace(tmp);
   std::vector<__m128i> rst(src.size() * 2);
-  for (size_t i = 0; i < src.size(); i++) {
-    rst[2 * i] = _mm_xor_si128(tmp.at(i), src.at(i));
-    rst[2 * i + 1] = src.at(i);
-  }
-  cipher1_.encryptInPlace(src);
-  for (size_t i = 0; i < src.size(); i++) {
-    rst[2 * i + 1] = _mm_xor_si128(src.at(i), rst.at(2 * i + 1));
-  }
+  expand(src.data(), src.size(), rst.data());
   return rst;
 }
 
+void Expander::expand(const __m128i* src, size_t size, __m128i* dst) const {
+  // expand the keys a chunk at a time, so that a chunk goes through both
+  // ciphers while it is in registers.
+  const size_t kChunkSize = 8;
+  __m128i tmp0[kChunkSize];
+  __m128i tmp1[kChunkSize];
+  for (size_t i = 0; i < size; i += kChunkSize) {
+    auto chunkSize = std::min(kChunkSize, size - i);
+    std::copy(src + i, src + i + chunkSize, tmp0);
+    std::copy(src + i, src + i + chunkSize, tmp1);
+    cipher0_.encryptInPlace(tmp0, chunkSize);
+    cipher1_.encryptInPlace(tmp1, chunkSize);
+    for (size_t j = 0; j < chunkSize; j++) {
+      dst[2 * (i + j)] = _mm_xor_si128(tmp0[j], src[i + j]);
+      dst[2 * (i + j) + 1] = _mm_xor_si128(tmp1[j], src[i + j]);
+    }
+  }
+}
+
 } // namespace fbpcf::engine::util
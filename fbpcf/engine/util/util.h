@@ -213,6 +213,12 @@ class Expander {
   explicit Expander(int64_t index);
   std::vector<__m128i> expand(std::vector<__m128i>&& src) const;
 
+  /**
+   * Expand the size keys starting from src into the 2 * size keys starting
+   * from dst. The two ranges must not overlap.
+   */
+  void expand(const __m128i* src, size_t size, __m128i* dst) const;
+
  private:
   Aes cipher0_;
   Aes cipher1_;
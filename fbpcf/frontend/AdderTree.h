@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "fbpcf/frontend/Multiplier.h"
+
+namespace fbpcf::frontend::adder_tree {
+
+/**
+ * Reduce columns of batched bits modulo 2^width, where column i holds batches
+ * whose bits all have weight 2^i, until every column holds at most two bits.
+ * In each round, the batches of a column are concatenated for free and three
+ * equal parts are cut off them, which are added up by a single batched full
+ * adder, i.e. one AND gate per column. This leaves about two thirds of the
+ * bits of every column, so n bits in a column take about log_{3/2}(n) round
+ * trips. The remaining bits are returned as batches of size 1, ready for
+ * multiplier::addColumns().
+ */
+template <size_t width, typename BitType>
+std::vector<std::vector<BitType>> reduceBatchColumns(
+    std::vector<std::vector<BitType>> columns) {
+  bool reduced = false;
+  while (!reduced) {
+    reduced = true;
+    std::vector<std::vector<BitType>> nextColumns(width);
+    for (size_t i = 0; i < width; i++) {
+      auto& column = columns.at(i);
+      if (column.empty()) {
+        continue;
+      }
+      auto merged = column.size() == 1
+          ? column.at(0)
+          : column.at(0).batchingWith(
+                std::vector<BitType>(column.begin() + 1, column.end()));
+      size_t batchSize = merged.getBatchSize();
+      uint32_t third = batchSize / 3;
+      if (third == 0) {
+        nextColumns[i].push_back(std::move(merged));
+        continue;
+      }
+      reduced = false;
+      auto strategy = std::make_shared<std::vector<uint32_t>>(3, third);
+      if (batchSize > 3 * third) {
+        strategy->push_back(batchSize - 3 * third);
+      }
+      auto parts = merged.unbatching(strategy);
+      auto [sum, carry] =
+          multiplier::fullAdder(parts.at(0), parts.at(1), parts.at(2));
+      nextColumns[i].push_back(std::move(sum));
+      if (parts.size() == 4) {
+        nextColumns[i].push_back(std::move(parts.at(3)));
+      }
+      // the carries of weight 2^width are dropped
+      if (i + 1 < width) {
+        nextColumns[i + 1].push_back(std::move(carry));
+      }
+    }
+    columns = std::move(nextColumns);
+  }
+
+  std::vector<std::vector<BitType>> rst(width);
+  for (size_t i = 0; i < width; i++) {
+    if (columns.at(i).empty()) {
+      continue;
+    }
+    auto& bits = columns.at(i).at(0);
+    if (bits.getBatchSize() == 1) {
+      rst[i].push_back(std::move(bits));
+    } else {
+      rst[i] =
+          bits.unbatching(std::make_shared<std::vector<uint32_t>>(2, 1));
+    }
+  }
+  return rst;
+}
+
+/**
+ * Add the bits of -count * 2^position modulo 2^width to the columns, where one
+ * must be a bit of value 1. A signed integer whose sign bit b has weight
+ * 2^position can then contribute !b instead of b to column position, since
+ * -b * 2^position = !b * 2^position - 2^position.
+ */
+template <size_t width, typename BitType>
+void addSignCorrection(
+    std::vector<std::vector<BitType>>& columns,
+    size_t position,
+    uint64_t count,
+    const BitType& one) {
+  std::vector<bool> constantBits(width, false);
+  for (size_t k = 0; k < 64 && position + k < width; k++) {
+    constantBits[position + k] = (count >> k) & 1;
+  }
+  // negate modulo 2^width as !constant + 1
+  bool carry = true;
+  for (size_t k = 0; k < width; k++) {
+    bool flipped = !constantBits[k];
+    constantBits[k] = flipped != carry;
+    carry = flipped && carry;
+  }
+  for (size_t k = 0; k < width; k++) {
+    if (constantBits[k]) {
+      columns.at(k).push_back(one);
+    }
+  }
+}
+
+} // namespace fbpcf::frontend::adder_tree
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "fbpcf/frontend/Bit.h"
+#include "fbpcf/frontend/Int.h"
+#include "fbpcf/scheduler/IArithmeticScheduler.h"
+
+namespace fbpcf::frontend {
+
+/**
+ * An integer modulo 2^64 that lives on a single arithmetic wire, as opposed to
+ * Int, which is made of one boolean wire per bit. It requires the scheduler of
+ * schedulerId to be an IArithmeticScheduler. Signed values are stored as their
+ * two's complement.
+ * Converting from a secret Int lifts its bits into the arithmetic domain, which
+ * takes one round. Converting back decomposes every party's share into bits
+ * for free and then adds them up with the boolean adder of Int.
+ */
+template <bool isSecret, int schedulerId, bool usingBatch = false>
+class ArithmeticInt : public scheduler::SchedulerKeeper<schedulerId> {
+  using IntType = typename std::
+      conditional<usingBatch, std::vector<uint64_t>, uint64_t>::type;
+  using WireType =
+      scheduler::IScheduler::WireId<scheduler::IScheduler::Arithmetic>;
+
+ public:
+  class ExtractedArithmeticInt {
+   public:
+    ExtractedArithmeticInt() = default;
+    explicit ExtractedArithmeticInt(const IntType& v) : v_(v) {}
+    IntType getValue() const {
+      return v_;
+    }
+
+   private:
+    IntType v_;
+  };
+
+  /**
+   * Create an uninitialized integer
+   */
+  ArithmeticInt() : id_() {}
+
+  /**
+   * Create an integer with a public value v.
+   */
+  explicit ArithmeticInt(const IntType& v) {
+    static_assert(!isSecret);
+    publicInput(v);
+  }
+
+  /**
+   * Create an integer with a private value v from party corresponding to
+   * partyId; other parties input will be ignored.
+   */
+  ArithmeticInt(const IntType& v, int partyId) {
+    static_assert(isSecret);
+    privateInput(v, partyId);
+  }
+
+  /**
+   * Construct a private integer from extracted shares.
+   */
+  explicit ArithmeticInt(ExtractedArithmeticInt&& extractedInt);
+
+  /**
+   * Convert a secret Int into the arithmetic domain, i.e. modulo 2^64, see
+   * IArithmeticScheduler::privateBooleansToInteger().
+   */
+  template <bool isSigned, int16_t width>
+  explicit ArithmeticInt(
+      const Int<isSigned, width, isSecret, schedulerId, usingBatch>& src);
+
+  ArithmeticInt(const ArithmeticInt<isSecret, schedulerId, usingBatch>& src);
+
+  ArithmeticInt(
+      ArithmeticInt<isSecret, schedulerId, usingBatch>&& src) noexcept;
+
+  ArithmeticInt<isSecret, schedulerId, usingBatch>& operator=(
+      const ArithmeticInt<isSecret, schedulerId, usingBatch>& src);
+
+  ArithmeticInt<isSecret, schedulerId, usingBatch>& operator=(
+      ArithmeticInt<isSecret, schedulerId, usingBatch>&& src);
+
+  ~ArithmeticInt<isSecret, schedulerId, usingBatch>() {
+    decreaseReferenceCount(id_);
+  }
+
+  void publicInput(const IntType& v);
+
+  void privateInput(const IntType& v, int partyId);
+
+  /**
+   * Addition, subtraction and negation are free for both public and secret
+   * integers. All of them wrap around modulo 2^64.
+   */
+  template <bool isSecretOther>
+  ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch> operator+(
+      const ArithmeticInt<isSecretOther, schedulerId, usingBatch>& other) const;
+
+  template <bool isSecretOther>
+  ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch> operator-(
+      const ArithmeticInt<isSecretOther, schedulerId, usingBatch>& other) const;
+
+  ArithmeticInt<isSecret, schedulerId, usingBatch> operator-() const;
+
+  /**
+   * Multiplication modulo 2^64. Multiplying by a public integer is free, while
+   * multiplying two secret integers takes one round trip, however many of them
+   * are computed in parallel.
+   */
+  template <bool isSecretOther>
+  ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch> operator*(
+      const ArithmeticInt<isSecretOther, schedulerId, usingBatch>& other) const;
+
+  /**
+   * Divide this integer by 2^bits as a signed integer, for free. For a secret
+   * integer the result may be slightly smaller and, with a probability growing
+   * with its magnitude, wrong entirely, see
+   * IArithmeticScheduler::truncatePrivate().
+   */
+  ArithmeticInt<isSecret, schedulerId, usingBatch> truncate(size_t bits) const;
+
+  /**
+   * Convert this integer modulo 2^width into a secret Int of at most 64 bits,
+   * see IArithmeticScheduler::privateIntegerShareBits(). A wider Int can be
+   * obtained by casting the result. The bits of the parties' shares are summed
+   * with adderType, by default the adder Int itself would use.
+   */
+  template <
+      bool isSigned,
+      int16_t width,
+      AdderType adderType = AdderPolicy<schedulerId>::getAdderType(width)>
+  Int<isSigned, width, isSecret, schedulerId, usingBatch> toInt() const;
+
+  /**
+   * Create a new integer that will carry the plaintext signal of this integer.
+   * However only party with partyId will receive the actual value, other
+   * parties will receive a dummy value.
+   */
+  ArithmeticInt<false, schedulerId, usingBatch> openToParty(int partyId) const;
+
+  /**
+   * get the plaintext value associated with this integer
+   */
+  IntType getValue() const;
+
+  /**
+   * extract this party's share of this integer
+   */
+  typename ArithmeticInt<true, schedulerId, usingBatch>::ExtractedArithmeticInt
+  extractIntShare() const;
+
+  /**
+   * get the batch size of this integer, requires usingBatch is True
+   */
+  size_t getBatchSize() const;
+
+ private:
+  // Check the scheduler type where a value enters the arithmetic domain, i.e.
+  // on input, on recovering shares and on converting an Int. Every other
+  // operation works on wires created there, so it skips the check.
+  scheduler::IArithmeticScheduler& getCheckedArithmeticScheduler() const {
+    return dynamic_cast<scheduler::IArithmeticScheduler&>(
+        scheduler::SchedulerKeeper<schedulerId>::getScheduler());
+  }
+
+  scheduler::IArithmeticScheduler& getArithmeticScheduler() const {
+    return static_cast<scheduler::IArithmeticScheduler&>(
+        scheduler::SchedulerKeeper<schedulerId>::getScheduler());
+  }
+
+  void increaseReferenceCount(const WireType& v) const;
+  void decreaseReferenceCount(const WireType& v) const;
+  void moveId(WireType& dst, WireType& src) const;
+
+  // this variable records the wire index
+  WireType id_{};
+
+  friend class ArithmeticInt<!isSecret, schedulerId, usingBatch>;
+};
+
+} // namespace fbpcf::frontend
+
+#include "fbpcf/frontend/ArithmeticInt_impl.h"
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+// included for clangd resolution. Should not execute during compilation
+#include <cstddef>
+#include "fbpcf/frontend/ArithmeticInt.h"
+
+namespace fbpcf::frontend {
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+void ArithmeticInt<isSecret, schedulerId, usingBatch>::increaseReferenceCount(
+    const WireType& id) const {
+  if (!id.isEmpty()) {
+    if constexpr (usingBatch) {
+      getArithmeticScheduler().increaseReferenceCountBatch(id);
+    } else {
+      getArithmeticScheduler().increaseReferenceCount(id);
+    }
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+void ArithmeticInt<isSecret, schedulerId, usingBatch>::decreaseReferenceCount(
+    const WireType& id) const {
+  if (!id.isEmpty()) {
+    if constexpr (usingBatch) {
+      getArithmeticScheduler().decreaseReferenceCountBatch(id);
+    } else {
+      getArithmeticScheduler().decreaseReferenceCount(id);
+    }
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+void ArithmeticInt<isSecret, schedulerId, usingBatch>::moveId(
+    WireType& dst,
+    WireType& src) const {
+  decreaseReferenceCount(dst);
+  dst = src;
+  src = WireType();
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::ArithmeticInt(
+    const ArithmeticInt<isSecret, schedulerId, usingBatch>& src) {
+  id_ = src.id_;
+  increaseReferenceCount(src.id_);
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::ArithmeticInt(
+    ArithmeticInt<isSecret, schedulerId, usingBatch>&& src) noexcept {
+  moveId(id_, src.id_);
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::ArithmeticInt(
+    ExtractedArithmeticInt&& extractedInt) {
+  static_assert(isSecret, "only shared secrets need recover");
+  if constexpr (usingBatch) {
+    id_ = getCheckedArithmeticScheduler().recoverIntegerWireBatch(
+        extractedInt.getValue());
+  } else {
+    id_ = getCheckedArithmeticScheduler().recoverIntegerWire(
+        extractedInt.getValue());
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSigned, int16_t width>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::ArithmeticInt(
+    const Int<isSigned, width, isSecret, schedulerId, usingBatch>& src) {
+  static_assert(isSecret, "Only secret integers need conversion.");
+  auto& arithmeticScheduler = getCheckedArithmeticScheduler();
+  auto convert = [&arithmeticScheduler](
+                     const std::vector<scheduler::IScheduler::WireId<
+                         scheduler::IScheduler::Boolean>>& bits) {
+    if constexpr (usingBatch) {
+      return arithmeticScheduler.privateBooleansToIntegerBatch(bits);
+    } else {
+      return arithmeticScheduler.privateBooleansToInteger(bits);
+    }
+  };
+
+  // In two's complement, the sign bit of a signed integer narrower than 64
+  // bits weighs -2^(width - 1) instead of 2^(width - 1). The bits of an
+  // integer wider than 64 bits from position 64 upward vanish modulo 2^64.
+  constexpr bool hasNegativeWeight = isSigned && width < 64;
+  constexpr int16_t unsignedWidth =
+      hasNegativeWeight ? width - 1 : std::min<int16_t>(width, 64);
+  std::vector<scheduler::IScheduler::WireId<scheduler::IScheduler::Boolean>>
+      bits;
+  for (int16_t i = 0; i < unsignedWidth; i++) {
+    bits.push_back(src[i].id_);
+  }
+  if constexpr (!hasNegativeWeight) {
+    id_ = convert(bits);
+  } else {
+    auto sign = convert({src[width - 1].id_});
+    uint64_t weight = -(uint64_t(1) << (width - 1));
+    WireType weightWire;
+    WireType negative;
+    if constexpr (usingBatch) {
+      weightWire = arithmeticScheduler.publicIntegerInputBatch(
+          std::vector<uint64_t>(src.getBatchSize(), weight));
+      negative = arithmeticScheduler.privateMultPublicBatch(sign, weightWire);
+    } else {
+      weightWire = arithmeticScheduler.publicIntegerInput(weight);
+      negative = arithmeticScheduler.privateMultPublic(sign, weightWire);
+    }
+    decreaseReferenceCount(sign);
+    decreaseReferenceCount(weightWire);
+
+    if (bits.empty()) {
+      id_ = negative;
+      return;
+    }
+    auto low = convert(bits);
+    if constexpr (usingBatch) {
+      id_ = arithmeticScheduler.privatePlusPrivateBatch(low, negative);
+    } else {
+      id_ = arithmeticScheduler.privatePlusPrivate(low, negative);
+    }
+    decreaseReferenceCount(low);
+    decreaseReferenceCount(negative);
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>&
+ArithmeticInt<isSecret, schedulerId, usingBatch>::operator=(
+    const ArithmeticInt<isSecret, schedulerId, usingBatch>& src) {
+  decreaseReferenceCount(id_);
+  id_ = src.id_;
+  increaseReferenceCount(src.id_);
+  return *this;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>&
+ArithmeticInt<isSecret, schedulerId, usingBatch>::operator=(
+    ArithmeticInt<isSecret, schedulerId, usingBatch>&& src) {
+  moveId(id_, src.id_);
+  return *this;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+void ArithmeticInt<isSecret, schedulerId, usingBatch>::privateInput(
+    const IntType& v,
+    int partyId) {
+  static_assert(isSecret, "public value can't come from private input");
+  decreaseReferenceCount(id_);
+  if constexpr (usingBatch) {
+    id_ = getCheckedArithmeticScheduler().privateIntegerInputBatch(v, partyId);
+  } else {
+    id_ = getCheckedArithmeticScheduler().privateIntegerInput(v, partyId);
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+void ArithmeticInt<isSecret, schedulerId, usingBatch>::publicInput(
+    const IntType& v) {
+  static_assert(!isSecret, "private value can't come from public input");
+  decreaseReferenceCount(id_);
+  if constexpr (usingBatch) {
+    id_ = getCheckedArithmeticScheduler().publicIntegerInputBatch(v);
+  } else {
+    id_ = getCheckedArithmeticScheduler().publicIntegerInput(v);
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::operator+(
+    const ArithmeticInt<isSecretOther, schedulerId, usingBatch>& other) const {
+  ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch> rst;
+  auto& arithmeticScheduler = getArithmeticScheduler();
+  if constexpr (isSecret && isSecretOther) {
+    // both are secret
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.privatePlusPrivateBatch(id_, other.id_);
+    } else {
+      rst.id_ = arithmeticScheduler.privatePlusPrivate(id_, other.id_);
+    }
+  } else if constexpr (!isSecret && !isSecretOther) {
+    // both are not secret
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.publicPlusPublicBatch(id_, other.id_);
+    } else {
+      rst.id_ = arithmeticScheduler.publicPlusPublic(id_, other.id_);
+    }
+  } else if constexpr (isSecret) {
+    // this one is secret but other is not
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.privatePlusPublicBatch(id_, other.id_);
+    } else {
+      rst.id_ = arithmeticScheduler.privatePlusPublic(id_, other.id_);
+    }
+  } else {
+    // this one is not secret but other is
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.privatePlusPublicBatch(other.id_, id_);
+    } else {
+      rst.id_ = arithmeticScheduler.privatePlusPublic(other.id_, id_);
+    }
+  }
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::operator-(
+    const ArithmeticInt<isSecretOther, schedulerId, usingBatch>& other) const {
+  // the schedulers have no subtraction gate, adding the negation is as cheap
+  return *this + (-other);
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::operator-() const {
+  ArithmeticInt<isSecret, schedulerId, usingBatch> rst;
+  auto& arithmeticScheduler = getArithmeticScheduler();
+  if constexpr (isSecret) {
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.negPrivateBatch(id_);
+    } else {
+      rst.id_ = arithmeticScheduler.negPrivate(id_);
+    }
+  } else {
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.negPublicBatch(id_);
+    } else {
+      rst.id_ = arithmeticScheduler.negPublic(id_);
+    }
+  }
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::operator*(
+    const ArithmeticInt<isSecretOther, schedulerId, usingBatch>& other) const {
+  ArithmeticInt<isSecret || isSecretOther, schedulerId, usingBatch> rst;
+  auto& arithmeticScheduler = getArithmeticScheduler();
+  if constexpr (isSecret && isSecretOther) {
+    // both are secret
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.privateMultPrivateBatch(id_, other.id_);
+    } else {
+      rst.id_ = arithmeticScheduler.privateMultPrivate(id_, other.id_);
+    }
+  } else if constexpr (!isSecret && !isSecretOther) {
+    // both are not secret
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.publicMultPublicBatch(id_, other.id_);
+    } else {
+      rst.id_ = arithmeticScheduler.publicMultPublic(id_, other.id_);
+    }
+  } else if constexpr (isSecret) {
+    // this one is secret but other is not
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.privateMultPublicBatch(id_, other.id_);
+    } else {
+      rst.id_ = arithmeticScheduler.privateMultPublic(id_, other.id_);
+    }
+  } else {
+    // this one is not secret but other is
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.privateMultPublicBatch(other.id_, id_);
+    } else {
+      rst.id_ = arithmeticScheduler.privateMultPublic(other.id_, id_);
+    }
+  }
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::truncate(size_t bits) const {
+  ArithmeticInt<isSecret, schedulerId, usingBatch> rst;
+  auto& arithmeticScheduler = getArithmeticScheduler();
+  if constexpr (isSecret) {
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.truncatePrivateBatch(id_, bits);
+    } else {
+      rst.id_ = arithmeticScheduler.truncatePrivate(id_, bits);
+    }
+  } else {
+    if constexpr (usingBatch) {
+      rst.id_ = arithmeticScheduler.truncatePublicBatch(id_, bits);
+    } else {
+      rst.id_ = arithmeticScheduler.truncatePublic(id_, bits);
+    }
+  }
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSigned, int16_t width, AdderType adderType>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::toInt() const {
+  static_assert(isSecret, "Only secret integers need conversion.");
+  static_assert(width <= 64, "The integer has only 64 bits.");
+  std::vector<std::vector<
+      scheduler::IScheduler::WireId<scheduler::IScheduler::Boolean>>>
+      shareBits;
+  if constexpr (usingBatch) {
+    shareBits =
+        getArithmeticScheduler().privateIntegerShareBitsBatch(id_, width);
+  } else {
+    shareBits = getArithmeticScheduler().privateIntegerShareBits(id_, width);
+  }
+
+  // the secret is the sum of the integers formed by each party's bits
+  Int<isSigned, width, isSecret, schedulerId, usingBatch> rst;
+  for (size_t party = 0; party < shareBits.size(); party++) {
+    Int<isSigned, width, isSecret, schedulerId, usingBatch> share;
+    for (int16_t i = 0; i < width; i++) {
+      share[i].id_ = shareBits[party].at(i);
+    }
+    if (party == 0) {
+      rst = std::move(share);
+    } else if constexpr (adderType == AdderType::RippleCarry) {
+      rst = rst + share;
+    } else {
+      std::array<Bit<isSecret, schedulerId, usingBatch>, width> left;
+      std::array<Bit<isSecret, schedulerId, usingBatch>, width> right;
+      for (int16_t i = 0; i < width; i++) {
+        left[i] = rst[i];
+        right[i] = share[i];
+      }
+      auto sum =
+          parallel_prefix::add<false, Bit<isSecret, schedulerId, usingBatch>>(
+              adderType, left, right);
+      for (int16_t i = 0; i < width; i++) {
+        rst[i] = std::move(sum[i]);
+      }
+    }
+  }
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+ArithmeticInt<false, schedulerId, usingBatch>
+ArithmeticInt<isSecret, schedulerId, usingBatch>::openToParty(
+    int partyId) const {
+  static_assert(isSecret, "No need to open a public value.");
+  ArithmeticInt<false, schedulerId, usingBatch> rst;
+  if constexpr (usingBatch) {
+    rst.id_ =
+        getArithmeticScheduler().openIntegerValueToPartyBatch(id_, partyId);
+  } else {
+    rst.id_ = getArithmeticScheduler().openIntegerValueToParty(id_, partyId);
+  }
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+typename ArithmeticInt<isSecret, schedulerId, usingBatch>::IntType
+ArithmeticInt<isSecret, schedulerId, usingBatch>::getValue() const {
+  static_assert(!isSecret, "Can't get value on secret wires.");
+  if constexpr (usingBatch) {
+    return getArithmeticScheduler().getIntegerValueBatch(id_);
+  } else {
+    return getArithmeticScheduler().getIntegerValue(id_);
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+typename ArithmeticInt<true, schedulerId, usingBatch>::ExtractedArithmeticInt
+ArithmeticInt<isSecret, schedulerId, usingBatch>::extractIntShare() const {
+  static_assert(isSecret, "No need to extract a public value.");
+  if constexpr (usingBatch) {
+    return ExtractedArithmeticInt(
+        getArithmeticScheduler().extractIntegerSecretShareBatch(id_));
+  } else {
+    return ExtractedArithmeticInt(
+        getArithmeticScheduler().extractIntegerSecretShare(id_));
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+size_t ArithmeticInt<isSecret, schedulerId, usingBatch>::getBatchSize() const {
+  static_assert(usingBatch, "Only batch integer has batch size!");
+  return getArithmeticScheduler().getBatchSize(id_);
+}
+
+} // namespace fbpcf::frontend
@@ -15,6 +15,12 @@
 
 namespace fbpcf::frontend {
 
+template <bool isSecret, int schedulerId, bool usingBatch>
+class ArithmeticInt;
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+class XorExpression;
+
 template <bool isSecret, int schedulerId, bool usingBatch = false>
 class Bit : public scheduler::SchedulerKeeper<schedulerId> {
   using BoolType =
@@ -135,6 +141,14 @@ class Bit : public scheduler::SchedulerKeeper<schedulerId> {
   std::vector<Bit<isSecret, schedulerId, usingBatch>> unbatching(
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) const;
 
+  /**
+   * Select the values at the given positions of this batch into a new batch,
+   * in the order of the positions. This is a single rebatching gate no matter
+   * how many values are selected.
+   */
+  Bit<isSecret, schedulerId, usingBatch> gathering(
+      std::shared_ptr<std::vector<uint32_t>> indexes) const;
+
   /**
    * get the batch size of this bit, requires usingBatch is True
    */
@@ -156,6 +170,14 @@ class Bit : public scheduler::SchedulerKeeper<schedulerId> {
   WireType id_{};
 
   friend class Bit<!isSecret, schedulerId, usingBatch>;
+
+  // share conversions move the wires of bits in and out of ArithmeticInt
+  template <bool, int, bool>
+  friend class ArithmeticInt;
+
+  // expressions emit a single gate for the wires of all their operands
+  template <bool, int, bool>
+  friend class XorExpression;
 };
 
 } // namespace fbpcf::frontend
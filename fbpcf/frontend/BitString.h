@@ -161,6 +161,13 @@ class BitString : public scheduler::SchedulerKeeper<schedulerId> {
   std::vector<BitString<isSecret, schedulerId, usingBatch>> unbatching(
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) const;
 
+  /**
+   * Select the values at the given positions of this batch into a new batch,
+   * in the order of the positions.
+   */
+  BitString<isSecret, schedulerId, usingBatch> gathering(
+      std::shared_ptr<std::vector<uint32_t>> indexes) const;
+
   /**
    * get the batch size of this BitString, requires usingBatch is True
    */
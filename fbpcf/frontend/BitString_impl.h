@@ -207,6 +207,18 @@ BitString<isSecret, schedulerId, usingBatch>::unbatching(
   return rst;
 }
 
+template <bool isSecret, int schedulerId, bool usingBatch>
+BitString<isSecret, schedulerId, usingBatch>
+BitString<isSecret, schedulerId, usingBatch>::gathering(
+    std::shared_ptr<std::vector<uint32_t>> indexes) const {
+  static_assert(usingBatch, "Only batch values needs to rebatch!");
+  BitString<isSecret, schedulerId, usingBatch> rst(data_.size());
+  for (size_t i = 0; i < data_.size(); i++) {
+    rst.data_[i] = data_.at(i).gathering(indexes);
+  }
+  return rst;
+}
+
 template <bool isSecret, int schedulerId, bool usingBatch>
 size_t BitString<isSecret, schedulerId, usingBatch>::getBatchSize() const {
   if (data_.size() == 0) {
@@ -408,6 +408,18 @@ Bit<isSecret, schedulerId, usingBatch>::unbatching(
   return rst;
 }
 
+template <bool isSecret, int schedulerId, bool usingBatch>
+Bit<isSecret, schedulerId, usingBatch>
+Bit<isSecret, schedulerId, usingBatch>::gathering(
+    std::shared_ptr<std::vector<uint32_t>> indexes) const {
+  static_assert(usingBatch, "Only batch values needs to rebatch!");
+  Bit<isSecret, schedulerId, usingBatch> rst;
+  rst.id_ =
+      scheduler::SchedulerKeeper<schedulerId>::getScheduler().gathering(
+          id_, indexes);
+  return rst;
+}
+
 template <bool isSecret, int schedulerId, bool usingBatch>
 size_t Bit<isSecret, schedulerId, usingBatch>::getBatchSize() const {
   static_assert(usingBatch, "Only batch bit has batch size!");
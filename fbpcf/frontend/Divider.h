@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "fbpcf/frontend/ParallelPrefixAdder.h"
+
+namespace fbpcf::frontend::divider {
+
+// the number of significant bits of value
+constexpr size_t getBitLength(uint64_t value) {
+  size_t length = 0;
+  while (length < 64 && (value >> length) != 0) {
+    length++;
+  }
+  return length;
+}
+
+/**
+ * Compute the AND of src[0..i] for every i with a Sklansky network, i.e. in
+ * log2(size) levels. The ANDs of a level sharing an operand are evaluated as
+ * one composite AND.
+ */
+template <typename BitType>
+std::vector<BitType> prefixAnd(std::vector<BitType> src) {
+  for (auto& level :
+       parallel_prefix::getNetwork(AdderType::Sklansky, src.size())) {
+    std::map<size_t, std::vector<size_t>> targetsBySource;
+    for (auto& node : level) {
+      targetsBySource[node.from].push_back(node.to);
+    }
+    std::vector<std::pair<size_t, BitType>> updates;
+    for (auto& [from, targets] : targetsBySource) {
+      std::vector<BitType> targetBits;
+      for (auto to : targets) {
+        targetBits.push_back(src.at(to));
+      }
+      auto combined = src.at(from) & targetBits;
+      for (size_t i = 0; i < targets.size(); i++) {
+        updates.emplace_back(targets[i], std::move(combined[i]));
+      }
+    }
+    for (auto& [position, bit] : updates) {
+      src[position] = std::move(bit);
+    }
+  }
+  return src;
+}
+
+/**
+ * Negate a little-endian bit array modulo 2^width if negate is 1, and keep it
+ * otherwise. This computes (src ^ negate) + negate, where the carry into
+ * position i is the AND of negate and all lower bits of src ^ negate. negate
+ * may be public while src is secret.
+ */
+template <typename BitType, typename NegateBitType, size_t width>
+std::array<BitType, width> conditionalNegate(
+    const std::array<BitType, width>& src,
+    const NegateBitType& negate) {
+  std::vector<BitType> flipped;
+  flipped.push_back(src.at(0) ^ src.at(0) ^ negate);
+  for (size_t i = 0; i + 1 < width; i++) {
+    flipped.push_back(src.at(i) ^ negate);
+  }
+  auto carries = prefixAnd(std::move(flipped));
+
+  std::array<BitType, width> rst;
+  for (size_t i = 0; i < width; i++) {
+    rst[i] = src.at(i) ^ negate ^ carries.at(i);
+  }
+  return rst;
+}
+
+/**
+ * Divide two unsigned little-endian bit arrays with a restoring division, and
+ * return the quotient and the remainder. Dividing by 0 gives a quotient of all
+ * ones and the dividend as remainder.
+ * Quotient bit i is 1 iff the partial remainder r, made of the remainder of
+ * the previous step followed by dividend bit i, is no less than the divisor.
+ * Since r never exceeds the dividend bits above position i, it has at most
+ * width - i significant bits, so only that many bits of the divisor are
+ * subtracted from it with a Sklansky adder; the carry out of the subtraction
+ * is then ANDed with whether the higher divisor bits are all 0 as one more
+ * prefix node. The next remainder picks r or the difference with a composite
+ * AND. Each step thus takes about log2(width - i) + 2 round trips.
+ * The divisor is known to have at least minDivisorLength and at most
+ * maxDivisorLength significant bits, which is useful when it is public: the
+ * quotient bits of the first minDivisorLength - 1 steps are 0 for free, and
+ * unless the divisor may be 0, the partial remainder never needs more than
+ * maxDivisorLength + 1 bits.
+ */
+template <
+    typename OutputBitType,
+    typename LeftBitType,
+    typename RightBitType,
+    size_t width>
+std::pair<std::array<OutputBitType, width>, std::array<OutputBitType, width>>
+divide(
+    const std::array<LeftBitType, width>& dividend,
+    const std::array<RightBitType, width>& divisor,
+    size_t minDivisorLength = 0,
+    size_t maxDivisorLength = width) {
+  // XOR-ing with a zero of the output type is free and unifies the bit types
+  // of both operands.
+  OutputBitType zero =
+      (dividend.at(0) ^ divisor.at(0)) ^ (dividend.at(0) ^ divisor.at(0));
+  std::vector<OutputBitType> negatedDivisor;
+  for (size_t i = 0; i < width; i++) {
+    negatedDivisor.push_back(!(divisor.at(i) ^ zero));
+  }
+  // highZeros[k] is 1 iff the divisor bits from position k upward are all 0
+  std::vector<OutputBitType> highZeros(
+      negatedDivisor.rbegin(), negatedDivisor.rend());
+  highZeros = prefixAnd(std::move(highZeros));
+  std::reverse(highZeros.begin(), highZeros.end());
+
+  std::array<OutputBitType, width> quotient;
+  std::vector<OutputBitType> remainder;
+  for (size_t i = width; i-- > 0;) {
+    remainder.insert(remainder.begin(), dividend.at(i) ^ zero);
+    if (minDivisorLength > 0 && remainder.size() > maxDivisorLength + 1) {
+      // the remainder of the previous step is less than the non-zero divisor
+      remainder.pop_back();
+    }
+    auto length = remainder.size();
+    if (length < minDivisorLength) {
+      quotient[i] = zero;
+      continue;
+    }
+
+    // r - divisor = r + !divisor + 1, computed on the low length bits
+    std::vector<OutputBitType> generate;
+    std::vector<OutputBitType> propagate;
+    for (size_t j = 0; j < length; j++) {
+      propagate.push_back(remainder.at(j) ^ negatedDivisor.at(j));
+      generate.push_back(remainder.at(j) & negatedDivisor.at(j));
+    }
+    // fold the carry-in of 1 into the least significant position
+    generate[0] = generate[0] ^ propagate[0];
+    auto groupPropagate = propagate;
+    if (length < std::min(maxDivisorLength, width)) {
+      generate.push_back(zero);
+      groupPropagate.push_back(highZeros.at(length));
+    }
+    parallel_prefix::computeCarries(
+        AdderType::Sklansky, generate, groupPropagate);
+    quotient[i] = generate.back();
+
+    std::vector<OutputBitType> change{remainder.at(0) ^ !propagate.at(0)};
+    for (size_t j = 1; j < length; j++) {
+      change.push_back(remainder.at(j) ^ propagate.at(j) ^ generate.at(j - 1));
+    }
+    // composite AND
+    auto selected = quotient[i] & change;
+    for (size_t j = 0; j < length; j++) {
+      remainder[j] = remainder.at(j) ^ selected.at(j);
+    }
+  }
+
+  std::array<OutputBitType, width> rst;
+  for (size_t i = 0; i < width; i++) {
+    rst[i] = i < remainder.size() ? remainder.at(i) : zero;
+  }
+  return {std::move(quotient), std::move(rst)};
+}
+
+/**
+ * Divide a little-endian bit array by 2^shift, rounding toward 0 like the
+ * integer division of C++, and return the quotient and the remainder. This is
+ * free for unsigned integers. A negative signed integer is first added
+ * 2^shift - 1, whose bits are all the sign bit, so that the arithmetic shift
+ * rounds toward 0; its remainder is negative iff any of the low shift bits is
+ * set.
+ */
+template <bool isSigned, typename BitType, size_t width>
+std::pair<std::array<BitType, width>, std::array<BitType, width>>
+divideByPowerOfTwo(const std::array<BitType, width>& src, size_t shift) {
+  auto zero = src.at(0) ^ src.at(0);
+  std::array<BitType, width> quotient;
+  std::array<BitType, width> remainder;
+  if constexpr (isSigned) {
+    auto sign = src.at(width - 1);
+    std::array<BitType, width> bias;
+    std::vector<BitType> lowZeros;
+    for (size_t i = 0; i < width; i++) {
+      bias[i] = i < shift ? sign : zero;
+      if (i < shift) {
+        lowZeros.push_back(!src.at(i));
+      }
+    }
+    auto biased = parallel_prefix::add<false, BitType>(
+        AdderType::Sklansky, src, bias);
+    auto negativeRemainder = shift == 0
+        ? zero
+        : sign & !prefixAnd(std::move(lowZeros)).back();
+    for (size_t i = 0; i < width; i++) {
+      quotient[i] = biased.at(std::min(i + shift, width - 1));
+      remainder[i] = i < shift ? src.at(i) : negativeRemainder;
+    }
+  } else {
+    for (size_t i = 0; i < width; i++) {
+      quotient[i] = i + shift < width ? src.at(i + shift) : zero;
+      remainder[i] = i < shift ? src.at(i) : zero;
+    }
+  }
+  return {std::move(quotient), std::move(remainder)};
+}
+
+} // namespace fbpcf::frontend::divider
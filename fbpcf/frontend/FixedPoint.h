@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "fbpcf/frontend/ArithmeticInt.h"
+#include "fbpcf/frontend/Bit.h"
+
+namespace fbpcf::frontend {
+
+/**
+ * A signed fixed-point number with fractionalBits bits after the binary point,
+ * stored as an ArithmeticInt holding the number times 2^fractionalBits. Thus
+ * addition and subtraction are free, and multiplication costs the same as an
+ * ArithmeticInt multiplication: the product is truncated back to
+ * fractionalBits for free with probabilistic truncation, see
+ * ArithmeticInt::truncate(). Between two parties, the truncated product of
+ * secrets x and y may be smaller by 2^-fractionalBits, and it is wrong entirely
+ * with probability about 2^(l + 1 - 64), where
+ * |x * y| * 2^(2 * fractionalBits) < 2^l. For instance l = 43 keeps that
+ * probability at 2^-20.
+ * Comparisons decompose the difference of two numbers into bits, which costs
+ * a 64-bit boolean adder.
+ */
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch = false>
+class FixedPoint {
+  static_assert(
+      0 <= fractionalBits && fractionalBits < 62,
+      "Need room for the integer part in 64 bits.");
+
+  using ValueType =
+      typename std::conditional<usingBatch, std::vector<double>, double>::type;
+
+ public:
+  /**
+   * Create an uninitialized number
+   */
+  FixedPoint() = default;
+
+  /**
+   * Create a number with a public value v, rounded to the nearest multiple of
+   * 2^-fractionalBits.
+   */
+  explicit FixedPoint(const ValueType& v) {
+    publicInput(v);
+  }
+
+  /**
+   * Create a number with a private value v from party corresponding to
+   * partyId; other parties input will be ignored.
+   */
+  FixedPoint(const ValueType& v, int partyId) {
+    privateInput(v, partyId);
+  }
+
+  /**
+   * Convert an integer into a fixed-point number with the same value. This is
+   * free.
+   */
+  explicit FixedPoint(
+      const ArithmeticInt<isSecret, schedulerId, usingBatch>& src);
+
+  void publicInput(const ValueType& v);
+
+  void privateInput(const ValueType& v, int partyId);
+
+  template <bool isSecretOther>
+  FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+  operator+(const FixedPoint<
+            fractionalBits,
+            isSecretOther,
+            schedulerId,
+            usingBatch>& other) const;
+
+  template <bool isSecretOther>
+  FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+  operator-(const FixedPoint<
+            fractionalBits,
+            isSecretOther,
+            schedulerId,
+            usingBatch>& other) const;
+
+  FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch> operator-()
+      const;
+
+  template <bool isSecretOther>
+  FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+  operator*(const FixedPoint<
+            fractionalBits,
+            isSecretOther,
+            schedulerId,
+            usingBatch>& other) const;
+
+  template <bool isSecretOther>
+  Bit<isSecret || isSecretOther, schedulerId, usingBatch> operator<(
+      const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+          other) const;
+
+  template <bool isSecretOther>
+  Bit<isSecret || isSecretOther, schedulerId, usingBatch> operator<=(
+      const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+          other) const;
+
+  template <bool isSecretOther>
+  Bit<isSecret || isSecretOther, schedulerId, usingBatch> operator>(
+      const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+          other) const;
+
+  template <bool isSecretOther>
+  Bit<isSecret || isSecretOther, schedulerId, usingBatch> operator>=(
+      const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+          other) const;
+
+  template <bool isSecretOther>
+  Bit<isSecret || isSecretOther, schedulerId, usingBatch> operator==(
+      const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+          other) const;
+
+  /**
+   * Create a new number that will carry the plaintext signal of this number.
+   * However only party with partyId will receive the actual value, other
+   * parties will receive a dummy value.
+   */
+  FixedPoint<fractionalBits, false, schedulerId, usingBatch> openToParty(
+      int partyId) const;
+
+  /**
+   * get the plaintext value associated with this number
+   */
+  ValueType getValue() const;
+
+  /**
+   * get the batch size of this number, requires usingBatch is True
+   */
+  size_t getBatchSize() const;
+
+ private:
+  static uint64_t encode(double v);
+  static double decode(uint64_t v);
+
+  // Whether the difference of two numbers is negative, by looking at its sign
+  // bit. The difference is converted to bits with a Sklansky adder, so this
+  // and isZero take O(log(64)) round trips.
+  template <bool isSecretDifference>
+  static Bit<isSecretDifference, schedulerId, usingBatch> isNegative(
+      const ArithmeticInt<isSecretDifference, schedulerId, usingBatch>&
+          difference);
+
+  template <bool isSecretDifference>
+  static Bit<isSecretDifference, schedulerId, usingBatch> isZero(
+      const ArithmeticInt<isSecretDifference, schedulerId, usingBatch>&
+          difference);
+
+  // this variable holds the number times 2^fractionalBits
+  ArithmeticInt<isSecret, schedulerId, usingBatch> data_;
+
+  template <int8_t, bool, int, bool>
+  friend class FixedPoint;
+};
+
+} // namespace fbpcf::frontend
+
+#include "fbpcf/frontend/FixedPoint_impl.h"
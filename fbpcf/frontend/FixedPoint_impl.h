@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+// included for clangd resolution. Should not execute during compilation
+#include "fbpcf/frontend/FixedPoint.h"
+
+namespace fbpcf::frontend {
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+uint64_t FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::encode(
+    double v) {
+  double scaled = std::round(std::ldexp(v, fractionalBits));
+  if (!(std::abs(scaled) < std::ldexp(1.0, 63))) {
+    throw std::invalid_argument(
+        "The value is out of the range of fixed-point numbers.");
+  }
+  return static_cast<uint64_t>(static_cast<int64_t>(scaled));
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+double FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::decode(
+    uint64_t v) {
+  return std::ldexp(
+      static_cast<double>(static_cast<int64_t>(v)), -fractionalBits);
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::FixedPoint(
+    const ArithmeticInt<isSecret, schedulerId, usingBatch>& src) {
+  uint64_t scale = uint64_t(1) << fractionalBits;
+  if constexpr (usingBatch) {
+    data_ = src *
+        ArithmeticInt<false, schedulerId, usingBatch>(
+                std::vector<uint64_t>(src.getBatchSize(), scale));
+  } else {
+    data_ = src * ArithmeticInt<false, schedulerId, usingBatch>(scale);
+  }
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+void FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::publicInput(
+    const ValueType& v) {
+  static_assert(!isSecret, "private value can't come from public input");
+  if constexpr (usingBatch) {
+    std::vector<uint64_t> encoded(v.size());
+    for (size_t i = 0; i < v.size(); i++) {
+      encoded[i] = encode(v[i]);
+    }
+    data_.publicInput(encoded);
+  } else {
+    data_.publicInput(encode(v));
+  }
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+void FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::
+    privateInput(const ValueType& v, int partyId) {
+  static_assert(isSecret, "public value can't come from private input");
+  if constexpr (usingBatch) {
+    std::vector<uint64_t> encoded(v.size());
+    for (size_t i = 0; i < v.size(); i++) {
+      encoded[i] = encode(v[i]);
+    }
+    data_.privateInput(encoded, partyId);
+  } else {
+    data_.privateInput(encode(v), partyId);
+  }
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator+(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+      rst;
+  rst.data_ = data_ + other.data_;
+  return rst;
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator-(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+      rst;
+  rst.data_ = data_ - other.data_;
+  return rst;
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator-()
+    const {
+  FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch> rst;
+  rst.data_ = -data_;
+  return rst;
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator*(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  FixedPoint<fractionalBits, isSecret || isSecretOther, schedulerId, usingBatch>
+      rst;
+  // the product carries 2 * fractionalBits bits after the binary point
+  rst.data_ = (data_ * other.data_).truncate(fractionalBits);
+  return rst;
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Bit<isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator<(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  return isNegative(data_ - other.data_);
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Bit<isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator<=(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  return !isNegative(other.data_ - data_);
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Bit<isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator>(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  return isNegative(other.data_ - data_);
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Bit<isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator>=(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  return !isNegative(data_ - other.data_);
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Bit<isSecret || isSecretOther, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::operator==(
+    const FixedPoint<fractionalBits, isSecretOther, schedulerId, usingBatch>&
+        other) const {
+  return isZero(data_ - other.data_);
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretDifference>
+Bit<isSecretDifference, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::isNegative(
+    const ArithmeticInt<isSecretDifference, schedulerId, usingBatch>&
+        difference) {
+  if constexpr (isSecretDifference) {
+    auto bits = difference.template toInt<true, 64, AdderType::Sklansky>();
+    return bits[63];
+  } else if constexpr (usingBatch) {
+    auto values = difference.getValue();
+    std::vector<bool> rst(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+      rst[i] = static_cast<int64_t>(values[i]) < 0;
+    }
+    return Bit<false, schedulerId, usingBatch>(rst);
+  } else {
+    return Bit<false, schedulerId, usingBatch>(
+        static_cast<int64_t>(difference.getValue()) < 0);
+  }
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretDifference>
+Bit<isSecretDifference, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::isZero(
+    const ArithmeticInt<isSecretDifference, schedulerId, usingBatch>&
+        difference) {
+  if constexpr (isSecretDifference) {
+    auto bits = difference.template toInt<true, 64, AdderType::Sklansky>();
+    if constexpr (usingBatch) {
+      return bits ==
+          Int<true, 64, false, schedulerId, usingBatch>(
+                 std::vector<int64_t>(bits.getBatchSize(), 0));
+    } else {
+      return bits == Int<true, 64, false, schedulerId, usingBatch>(0);
+    }
+  } else if constexpr (usingBatch) {
+    auto values = difference.getValue();
+    std::vector<bool> rst(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+      rst[i] = values[i] == 0;
+    }
+    return Bit<false, schedulerId, usingBatch>(rst);
+  } else {
+    return Bit<false, schedulerId, usingBatch>(difference.getValue() == 0);
+  }
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+FixedPoint<fractionalBits, false, schedulerId, usingBatch>
+FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::openToParty(
+    int partyId) const {
+  FixedPoint<fractionalBits, false, schedulerId, usingBatch> rst;
+  rst.data_ = data_.openToParty(partyId);
+  return rst;
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+typename FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::
+    ValueType
+    FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::getValue()
+        const {
+  static_assert(!isSecret, "Can't get value on secret wires.");
+  if constexpr (usingBatch) {
+    auto values = data_.getValue();
+    std::vector<double> rst(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+      rst[i] = decode(values[i]);
+    }
+    return rst;
+  } else {
+    return decode(data_.getValue());
+  }
+}
+
+template <
+    int8_t fractionalBits,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+size_t FixedPoint<fractionalBits, isSecret, schedulerId, usingBatch>::
+    getBatchSize() const {
+  return data_.getBatchSize();
+}
+
+} // namespace fbpcf::frontend
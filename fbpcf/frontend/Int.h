@@ -10,34 +10,55 @@
 #include <algorithm>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
+#include "fbpcf/frontend/AdderTree.h"
 #include "fbpcf/frontend/Bit.h"
+#include "fbpcf/frontend/Divider.h"
+#include "fbpcf/frontend/Multiplier.h"
+#include "fbpcf/frontend/ParallelPrefixAdder.h"
+#include "fbpcf/frontend/TreeComparator.h"
 #include "fbpcf/frontend/util.h"
 
 namespace fbpcf::frontend {
 
+/**
+ * An integer of width bits, each of them on its own boolean wire. Integers up
+ * to 64 bits take and return (vectors of) int64_t or uint64_t plaintexts,
+ * wider ones (vectors of) WideInteger<width>.
+ */
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch = false>
 class Int {
-  using UnitIntType =
+  // the type of compile-time constants, sign- or zero-extended to width
+  using ConstantType =
       typename std::conditional<isSigned, int64_t, uint64_t>::type;
+  using UnitIntType = typename std::
+      conditional<(width > 64), WideInteger<width>, ConstantType>::type;
   using IntType = typename std::
       conditional<usingBatch, std::vector<UnitIntType>, UnitIntType>::type;
   using BoolType =
       typename std::conditional<usingBatch, std::vector<bool>, bool>::type;
 
-  static_assert(width <= 64);
+  // integers wider than 64 bits only take WideInteger inputs
+  template <typename T>
+  static constexpr bool isValidUnitInput() {
+    if constexpr (width > 64) {
+      return std::is_same_v<T, UnitIntType>;
+    } else {
+      return std::is_integral_v<T> && (std::is_signed_v<T> == isSigned);
+    }
+  }
 
   template <typename T>
-  struct UnitInputTypeChecker
-      : std::conditional<
-            std::is_integral_v<T> && (std::is_signed_v<T> == isSigned),
-            std::true_type,
-            std::false_type>::type {};
+  struct UnitInputTypeChecker : std::conditional<
+                                    isValidUnitInput<T>(),
+                                    std::true_type,
+                                    std::false_type>::type {};
 
   template <typename T>
   struct VectorInputTypeChecker : std::false_type {};
@@ -45,8 +66,7 @@ class Int {
   template <typename T>
   struct VectorInputTypeChecker<std::vector<T>>
       : std::conditional<
-            usingBatch && std::is_integral_v<T> &&
-                (std::is_signed_v<T> == isSigned),
+            usingBatch && isValidUnitInput<T>(),
             std::true_type,
             std::false_type>::type {};
 
@@ -66,7 +86,7 @@ class Int {
       static_assert(
           InputTypeChecker<T>::value,
           "Need to use proper signed/unsigned integer (vector).");
-      for (int8_t i = 0; i < width; i++) {
+      for (int16_t i = 0; i < width; i++) {
         data_[i] = typename Bit<true, schedulerId, usingBatch>::ExtractedBit(
             extractLsb(v, i));
       }
@@ -79,7 +99,7 @@ class Int {
 
     std::vector<BoolType> getBooleanShares() const {
       std::vector<BoolType> output;
-      for (int8_t i = 0; i < width; i++) {
+      for (int16_t i = 0; i < width; i++) {
         output.push_back(data_[i].getValue());
       }
       return output;
@@ -122,6 +142,10 @@ class Int {
 
   void privateInput(const IntType& v, int partyId);
 
+  /**
+   * Addition and subtraction use the adder circuit picked by
+   * AdderPolicy<schedulerId>, see ParallelPrefixAdder.h.
+   */
   template <bool isSecretOther>
   Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
   operator+(const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>&
@@ -134,6 +158,71 @@ class Int {
 
   Int<isSigned, width, isSecret, schedulerId, usingBatch> operator-() const;
 
+  /**
+   * Multiplication modulo 2^width, i.e. the result wraps around the same way
+   * as addition does. The partial products are summed with a Dadda tree, so a
+   * secret multiplication takes O(log(width)) round trips.
+   */
+  template <bool isSecretOther>
+  Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+  operator*(const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>&
+                other) const;
+
+  /**
+   * Multiply by a constant known at compile time. This is cheaper than
+   * multiplying by a public integer: the constant is decomposed into canonical
+   * signed digits, so only about width / 3 shifted copies of this integer are
+   * summed and no partial product needs an AND. Requires width <= 64.
+   */
+  template <ConstantType constant>
+  Int<isSigned, width, isSecret, schedulerId, usingBatch> multiplyByConstant()
+      const;
+
+  /**
+   * Division and modulo round toward 0 like the ones of C++, so a remainder
+   * has the sign of the dividend. Dividing by 0 gives all ones as quotient,
+   * or 1 for a negative signed dividend, and the dividend as remainder.
+   * A secret division is a restoring division circuit, see Divider.h: its
+   * width steps take O(log(width)) round trips each. A public divisor goes
+   * through the same circuit, since a public Int opened with openToParty
+   * holds a dummy value for the other parties and the circuit must not
+   * depend on it; see divideByConstant() for cheaper divisions.
+   */
+  template <bool isSecretOther>
+  Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+  operator/(const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>&
+                other) const;
+
+  template <bool isSecretOther>
+  Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+  operator%(const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>&
+                other) const;
+
+  /**
+   * Compute both the quotient and the remainder with a single division.
+   */
+  template <bool isSecretOther>
+  std::pair<
+      Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>,
+      Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>>
+  divideWithRemainder(
+      const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other)
+      const;
+
+  /**
+   * Compute the quotient and the remainder of dividing by a non-zero constant
+   * known at compile time, which must fit in width bits. Dividing by a
+   * positive power of two is a shift, i.e. free for unsigned integers and one
+   * addition for signed ones. Any other constant skips the division steps
+   * that can't produce a non-zero quotient bit and subtracts no more bits than
+   * the constant has. Requires width <= 64.
+   */
+  template <ConstantType constant>
+  std::pair<
+      Int<isSigned, width, isSecret, schedulerId, usingBatch>,
+      Int<isSigned, width, isSecret, schedulerId, usingBatch>>
+  divideByConstant() const;
+
   template <bool isSecretOther>
   Bit<isSecret || isSecretOther, schedulerId, usingBatch> operator<(
       const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other)
@@ -187,7 +276,7 @@ class Int {
     return data_[index];
   }
 
-  template <int8_t newWidth>
+  template <int16_t newWidth>
   Int<isSigned, newWidth, isSecret, schedulerId, usingBatch> cast() const;
 
   /**
@@ -217,6 +306,13 @@ class Int {
   std::vector<Int<isSigned, width, isSecret, schedulerId, usingBatch>>
   unbatching(std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) const;
 
+  /**
+   * Select the values at the given positions of this batch into a new batch,
+   * in the order of the positions.
+   */
+  Int<isSigned, width, isSecret, schedulerId, usingBatch> gathering(
+      std::shared_ptr<std::vector<uint32_t>> indexes) const;
+
   /**
    * get the batch size of this Int, requires usingBatch is True
    */
@@ -241,6 +337,17 @@ class Int {
   template <typename T>
   static IntType convertBitsToInt(const std::array<T, width>& data);
 
+  // Divide by other, whose magnitude is known to have at least
+  // minDivisorLength and at most maxDivisorLength significant bits.
+  template <bool isSecretOther>
+  std::pair<
+      Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>,
+      Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>>
+  divideWithBoundedDivisor(
+      const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other,
+      size_t minDivisorLength,
+      size_t maxDivisorLength) const;
+
   // not defining an operator because we only need a private helper
   static void shiftLeft(std::vector<uint64_t>& data);
 
@@ -253,11 +360,12 @@ class Int {
 
   std::array<Bit<isSecret, schedulerId, usingBatch>, width> data_;
 
-  // a uint64_t integer such that the last width bits are 1. Written in this
-  // format to prevent overflow when width = 64
-  static const uint64_t kMask = ((((uint64_t)1 << (width - 1)) - 1) << 1) + 1;
+  // a uint64_t integer such that the last width bits are 1, or all bits are 1
+  // if width >= 64. Written in this format to prevent overflow.
+  static const uint64_t kMask =
+      width >= 64 ? ~uint64_t(0) : (uint64_t(1) << (width % 64)) - 1;
 
-  template <bool, int8_t, bool, int, bool>
+  template <bool, int16_t, bool, int, bool>
   friend class Int;
 };
 
@@ -265,22 +373,22 @@ class Int {
 template <typename T, bool isSecret, int schedulerId>
 struct IntTypeHelper;
 
-template <int8_t width, bool isSecret, int schedulerId>
+template <int16_t width, bool isSecret, int schedulerId>
 struct IntTypeHelper<Signed<width>, isSecret, schedulerId> {
   using type = Int<true, width, isSecret, schedulerId, false>;
 };
 
-template <int8_t width, bool isSecret, int schedulerId>
+template <int16_t width, bool isSecret, int schedulerId>
 struct IntTypeHelper<Unsigned<width>, isSecret, schedulerId> {
   using type = Int<false, width, isSecret, schedulerId, false>;
 };
 
-template <int8_t width, bool isSecret, int schedulerId>
+template <int16_t width, bool isSecret, int schedulerId>
 struct IntTypeHelper<Batch<Signed<width>>, isSecret, schedulerId> {
   using type = Int<true, width, isSecret, schedulerId, true>;
 };
 
-template <int8_t width, bool isSecret, int schedulerId>
+template <int16_t width, bool isSecret, int schedulerId>
 struct IntTypeHelper<Batch<Unsigned<width>>, isSecret, schedulerId> {
   using type = Int<false, width, isSecret, schedulerId, true>;
 };
@@ -292,7 +400,7 @@ using Integer =
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret1,
     bool isSecret2,
     int schedulerId,
@@ -303,7 +411,7 @@ Int<isSigned, width, isSecret1 || isSecret2, schedulerId, usingBatch> max(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret1,
     bool isSecret2,
     int schedulerId,
@@ -315,10 +423,60 @@ Int<isSigned, width, isSecret1 || isSecret2, schedulerId, usingBatch> min(
 /**
  * Returns the absolute value of a signed integer.
  **/
-template <int8_t width, bool isSecret, int schedulerId, bool usingBatch>
+template <int16_t width, bool isSecret, int schedulerId, bool usingBatch>
 Int<true, width, isSecret, schedulerId, usingBatch> abs(
     const Int<true, width, isSecret, schedulerId, usingBatch>& src);
 
+/**
+ * Count the bits that are set, modulo 2^width. Batched bits are counted at
+ * every batch index separately. The bits are added up with a Dadda tree of
+ * full adders, i.e. in O(log(bits.size())) round trips, see
+ * multiplier::addColumns().
+ **/
+template <int16_t width, bool isSecret, int schedulerId, bool usingBatch>
+Int<false, width, isSecret, schedulerId, usingBatch> popcount(
+    const std::vector<Bit<isSecret, schedulerId, usingBatch>>& bits);
+
+/**
+ * Count the bits of a batch that are set, modulo 2^width, as a batch of one
+ * integer. Every round of the adder tree is a single batched AND per bit of
+ * the count, and there are O(log(bits.getBatchSize())) of them, see
+ * adder_tree::reduceBatchColumns().
+ **/
+template <int16_t width, bool isSecret, int schedulerId>
+Int<false, width, isSecret, schedulerId, true> popcount(
+    const Bit<isSecret, schedulerId, true>& bits);
+
+/**
+ * Add up integers modulo 2^outputWidth, in O(log(src.size())) round trips
+ * rather than the src.size() - 1 adders of a chain of additions. Batched
+ * integers are added up at every batch index separately. Choosing outputWidth
+ * wider than width by log2(src.size()) bits keeps the sum from overflowing.
+ **/
+template <
+    int16_t outputWidth,
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+Int<isSigned, outputWidth, isSecret, schedulerId, usingBatch> sum(
+    const std::vector<Int<isSigned, width, isSecret, schedulerId, usingBatch>>&
+        src);
+
+/**
+ * Add up all integers of a batch modulo 2^outputWidth, as a batch of one
+ * integer, in O(log(src.getBatchSize())) round trips.
+ **/
+template <
+    int16_t outputWidth,
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId>
+Int<isSigned, outputWidth, isSecret, schedulerId, true> sum(
+    const Int<isSigned, width, isSecret, schedulerId, true>& src);
+
 } // namespace fbpcf::frontend
 
 #include "fbpcf/frontend/Int_impl.h"
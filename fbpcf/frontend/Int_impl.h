@@ -18,7 +18,7 @@ namespace fbpcf::frontend {
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -36,7 +36,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::Int(const T& v) {
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -56,13 +56,13 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::Int(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
 Int<isSigned, width, isSecret, schedulerId, usingBatch>::Int(
     ExtractedInt&& extractedInt) {
-  for (int8_t i = 0; i < width; i++) {
+  for (int16_t i = 0; i < width; i++) {
     data_[i] =
         Bit<isSecret, schedulerId, usingBatch>(std::move(extractedInt[i]));
   }
@@ -70,7 +70,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::Int(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -83,7 +83,7 @@ void Int<isSigned, width, isSecret, schedulerId, usingBatch>::publicInput(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -97,7 +97,7 @@ void Int<isSigned, width, isSecret, schedulerId, usingBatch>::privateInput(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -109,10 +109,18 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator+(
   // signed int add and unsigned int add are the same
   Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch> rst;
 
+  constexpr auto adderType = AdderPolicy<schedulerId>::getAdderType(width);
+  if constexpr (adderType != AdderType::RippleCarry) {
+    rst.data_ = parallel_prefix::
+        add<false, Bit<isSecret || isSecretOther, schedulerId, usingBatch>>(
+            adderType, data_, other.data_);
+    return rst;
+  }
+
   rst.data_[0] = data_.at(0) ^ other.data_.at(0);
   auto carry = data_.at(0) & other.data_.at(0);
 
-  for (int8_t i = 1; i < width - 1; i++) {
+  for (int16_t i = 1; i < width - 1; i++) {
     auto left = carry ^ data_.at(i);
     auto right = carry ^ other.data_.at(i);
     rst.data_[i] = left ^ other.data_.at(i);
@@ -125,7 +133,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator+(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -137,12 +145,12 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator-() const {
       "Only signed integers have inverse"); // assert that integer is signed
   Int<isSigned, width, isSecret, schedulerId, usingBatch> rst;
 
-  for (int8_t i = 1; i < width; i++) {
+  for (int16_t i = 1; i < width; i++) {
     rst.data_[i] = !data_.at(i);
   }
   auto carry = !data_.at(0);
   rst.data_[0] = data_.at(0);
-  for (int8_t i = 1; i < width; i++) {
+  for (int16_t i = 1; i < width; i++) {
     rst.data_[i] = rst.data_[i] ^ carry;
     carry = (!rst.data_[i]) & carry;
   }
@@ -151,7 +159,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator-() const {
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -163,10 +171,18 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator-(
   // signed int add and unsigned int subtract are the same
   Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch> rst;
 
+  constexpr auto adderType = AdderPolicy<schedulerId>::getAdderType(width);
+  if constexpr (adderType != AdderType::RippleCarry) {
+    rst.data_ = parallel_prefix::
+        add<true, Bit<isSecret || isSecretOther, schedulerId, usingBatch>>(
+            adderType, data_, other.data_);
+    return rst;
+  }
+
   rst.data_[0] = data_.at(0) ^ other.data_.at(0);
   auto carry = !data_.at(0) & other.data_.at(0);
 
-  for (int8_t i = 1; i < width - 1; i++) {
+  for (int16_t i = 1; i < width - 1; i++) {
     // the logic here is:
     // 1. rst.data_[i] is the xor of minuend, subtrahend, and carry over;
     // 2. the new carry over is the old carry over if minuend = subtrahend;
@@ -183,6 +199,179 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator-(
   return rst;
 }
 
+template <
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator*(
+    const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other)
+    const {
+  // the low bits of a product are the same for signed and unsigned int
+  Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch> rst;
+  rst.data_ = multiplier::
+      multiply<Bit<isSecret || isSecretOther, schedulerId, usingBatch>>(
+          data_, other.data_);
+  return rst;
+}
+
+template <
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <typename Int<isSigned, width, isSecret, schedulerId, usingBatch>::
+              ConstantType constant>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::multiplyByConstant()
+    const {
+  static_assert(width <= 64, "Constants have at most 64 bits.");
+  Int<isSigned, width, isSecret, schedulerId, usingBatch> rst;
+  rst.data_ =
+      multiplier::multiplyByConstant<static_cast<uint64_t>(constant)>(data_);
+  return rst;
+}
+
+template <
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator/(
+    const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other)
+    const {
+  return divideWithRemainder(other).first;
+}
+
+template <
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator%(
+    const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other)
+    const {
+  return divideWithRemainder(other).second;
+}
+
+template <
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+std::pair<
+    Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>,
+    Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::divideWithRemainder(
+    const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other)
+    const {
+  return divideWithBoundedDivisor(other, 0, width);
+}
+
+template <
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <typename Int<isSigned, width, isSecret, schedulerId, usingBatch>::
+              ConstantType constant>
+std::pair<
+    Int<isSigned, width, isSecret, schedulerId, usingBatch>,
+    Int<isSigned, width, isSecret, schedulerId, usingBatch>>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::divideByConstant()
+    const {
+  static_assert(width <= 64, "Constants have at most 64 bits.");
+  static_assert(constant != 0, "Can't divide by 0.");
+  if constexpr (isSigned) {
+    static_assert(
+        width == 64 ||
+            (constant >= -(int64_t(1) << (width - 1)) &&
+             constant < (int64_t(1) << (width - 1))),
+        "The constant doesn't fit in width bits.");
+  } else {
+    static_assert(constant <= kMask, "The constant doesn't fit in width bits.");
+  }
+  constexpr uint64_t magnitude = isSigned && constant < 0
+      ? 0 - static_cast<uint64_t>(constant)
+      : static_cast<uint64_t>(constant);
+  constexpr size_t length = divider::getBitLength(magnitude);
+
+  if constexpr (constant > 0 && (magnitude & (magnitude - 1)) == 0) {
+    Int<isSigned, width, isSecret, schedulerId, usingBatch> quotient;
+    Int<isSigned, width, isSecret, schedulerId, usingBatch> remainder;
+    auto [q, r] = divider::divideByPowerOfTwo<isSigned>(data_, length - 1);
+    quotient.data_ = std::move(q);
+    remainder.data_ = std::move(r);
+    return {std::move(quotient), std::move(remainder)};
+  } else if constexpr (usingBatch) {
+    return divideWithBoundedDivisor(
+        Int<isSigned, width, false, schedulerId, usingBatch>(
+            std::vector<ConstantType>(getBatchSize(), constant)),
+        length,
+        length);
+  } else {
+    return divideWithBoundedDivisor(
+        Int<isSigned, width, false, schedulerId, usingBatch>(constant),
+        length,
+        length);
+  }
+}
+
+template <
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+template <bool isSecretOther>
+std::pair<
+    Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>,
+    Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::
+    divideWithBoundedDivisor(
+        const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>&
+            other,
+        size_t minDivisorLength,
+        size_t maxDivisorLength) const {
+  using OutputBitType = Bit<isSecret || isSecretOther, schedulerId, usingBatch>;
+  Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+      quotient;
+  Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch>
+      remainder;
+
+  if constexpr (isSigned) {
+    // divide the magnitudes, then restore the signs
+    auto dividendSign = data_.at(width - 1);
+    auto divisorSign = other.data_.at(width - 1);
+    auto [q, r] = divider::divide<OutputBitType>(
+        divider::conditionalNegate(data_, dividendSign),
+        divider::conditionalNegate(other.data_, divisorSign),
+        minDivisorLength,
+        maxDivisorLength);
+    quotient.data_ = divider::conditionalNegate(q, dividendSign ^ divisorSign);
+    remainder.data_ = divider::conditionalNegate(r, dividendSign);
+  } else {
+    auto [q, r] = divider::divide<OutputBitType>(
+        data_, other.data_, minDivisorLength, maxDivisorLength);
+    quotient.data_ = std::move(q);
+    remainder.data_ = std::move(r);
+  }
+  return {std::move(quotient), std::move(remainder)};
+}
+
 /**
  * The algorithm of comparising two unsigned integers comes as follows:
  * 1. compare the msb: equal, or one is larger than the other.
@@ -203,10 +392,12 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator-(
  * ^ right[i] = carry; otherwise carry ^ left[i] and carry ^ right[i] will be
  * opposite (thus their product will always be 0), and the whole formula can be
  * simplified to right[i]
+ * If ComparatorPolicy<schedulerId> asks for it, a tree comparator with
+ * logarithmic depth is used instead, see TreeComparator.h.
  */
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -215,8 +406,17 @@ Bit<isSecret || isSecretOther, schedulerId, usingBatch>
 Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator<(
     const Int<isSigned, width, isSecretOther, schedulerId, usingBatch>& other)
     const {
+  if constexpr (
+      ComparatorPolicy<schedulerId>::getComparatorType(width) ==
+      ComparatorType::Tree) {
+    return tree_comparator::lessThan<
+        isSigned,
+        Bit<isSecret || isSecretOther, schedulerId, usingBatch>>(
+        data_, other.data_);
+  }
+
   auto carry = (!data_[0]) & other.data_[0];
-  for (int8_t i = 1; i < width - 1; i++) {
+  for (int16_t i = 1; i < width - 1; i++) {
     carry = ((carry ^ data_.at(i)) & (carry ^ other.data_.at(i))) ^
         other.data_.at(i);
   }
@@ -233,7 +433,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator<(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -247,7 +447,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator<=(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -261,7 +461,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator>(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -275,7 +475,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator>=(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -297,11 +497,11 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::operator==(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
-template <int8_t newWidth>
+template <int16_t newWidth>
 Int<isSigned, newWidth, isSecret, schedulerId, usingBatch>
 Int<isSigned, width, isSecret, schedulerId, usingBatch>::cast() const {
   Int<isSigned, newWidth, isSecret, schedulerId, usingBatch> rst;
@@ -350,7 +550,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::cast() const {
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -366,7 +566,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::mux(
     const {
   Int<isSigned, width, isSecret || isSecretOther, schedulerId, usingBatch> sum;
 
-  for (int8_t i = 0; i < width; i++) {
+  for (int16_t i = 0; i < width; i++) {
     sum.data_[i] = (other.data_.at(i) ^ data_.at(i));
   }
 
@@ -380,7 +580,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::mux(
   // composite AND
   auto andResult = choice & sum.data_;
 
-  for (int8_t i = 0; i < width; i++) {
+  for (int16_t i = 0; i < width; i++) {
     rst.data_[i] = data_.at(i) ^ andResult[i];
   }
   return rst;
@@ -388,7 +588,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::mux(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -400,7 +600,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::getValue() const {
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -410,7 +610,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::openToParty(
   static_assert(isSecret, "No need to open a public value.");
   Int<isSigned, width, false, schedulerId, usingBatch> rst;
 
-  for (int8_t i = 0; i < width; i++) {
+  for (int16_t i = 0; i < width; i++) {
     rst.data_[i] = data_.at(i).openToParty(partyId);
   }
   return rst;
@@ -418,7 +618,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::openToParty(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -427,7 +627,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::extractIntShare()
     const {
   static_assert(isSecret, "No need to extract a public value.");
   ExtractedInt rst;
-  for (int8_t i = 0; i < width; i++) {
+  for (int16_t i = 0; i < width; i++) {
     rst[i] = data_.at(i).extractBit();
   }
   return rst;
@@ -435,7 +635,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::extractIntShare()
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -443,24 +643,31 @@ typename Int<isSigned, width, isSecret, schedulerId, usingBatch>::BoolType
 Int<isSigned, width, isSecret, schedulerId, usingBatch>::extractLsb(
     const IntType& v,
     size_t t) {
+  auto extractUnitLsb = [t](const UnitIntType& unit) -> bool {
+    if constexpr (width > 64) {
+      return (unit.at(t / 64) >> (t % 64)) & 1;
+    } else {
+      return (unit >> t) & 1;
+    }
+  };
   if constexpr (usingBatch) {
     std::vector<bool> rst(v.size());
     if (rst.size() == 0) {
       return rst;
     } else {
       for (size_t i = 0; i < rst.size(); i++) {
-        rst[i] = (v.at(i) >> t) & 1;
+        rst[i] = extractUnitLsb(v.at(i));
       }
       return rst;
     }
   } else {
-    return (v >> t) & 1;
+    return extractUnitLsb(v);
   }
 }
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -473,7 +680,7 @@ void Int<isSigned, width, isSecret, schedulerId, usingBatch>::shiftLeft(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -494,7 +701,7 @@ void Int<isSigned, width, isSecret, schedulerId, usingBatch>::addLsb(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -511,13 +718,31 @@ void Int<isSigned, width, isSecret, schedulerId, usingBatch>::processInput(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
 void Int<isSigned, width, isSecret, schedulerId, usingBatch>::
     processSingleInput(UnitIntType& v) const {
-  if constexpr (isSigned) {
+  if constexpr (width > 64) {
+    // the words are already in two's complement, but the bits above width
+    // must be 0, or copies of the sign bit if signed
+    constexpr int16_t topBits = width - (width - 1) / 64 * 64;
+    if constexpr (topBits < 64) {
+      auto top = v.back();
+      auto high = isSigned ? static_cast<int64_t>(top) >> (topBits - 1)
+                           : static_cast<int64_t>(top >> topBits);
+      bool isValid = high == 0 || (isSigned && high == -1);
+      if (!isValid) {
+        throw std::runtime_error(
+            "Input value is out of range! This is a " +
+            std::string(isSigned ? "signed" : "unsigned") + " integer of " +
+            std::to_string(width) +
+            " bits. But the most significant word of this attempt is " +
+            std::to_string(top) + ", Which is not acceptable.");
+      }
+    }
+  } else if constexpr (isSigned) {
     /**
      * We use 2's complement to represent the converted vanilla signed integer.
      * In the following example, we use 8 bits to illustrate the vanilla
@@ -584,33 +809,33 @@ void Int<isSigned, width, isSecret, schedulerId, usingBatch>::
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
 void Int<isSigned, width, isSecret, schedulerId, usingBatch>::
     convertPublicIntToBits(const IntType& v) {
-  for (int8_t i = 0; i < width; i++) {
+  for (int16_t i = 0; i < width; i++) {
     data_[i] = Bit<false, schedulerId, usingBatch>(extractLsb(v, i));
   }
 }
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
 void Int<isSigned, width, isSecret, schedulerId, usingBatch>::
     convertPrivateIntToBits(const IntType& v, int partyId) {
-  for (int8_t i = 0; i < width; i++) {
+  for (int16_t i = 0; i < width; i++) {
     data_[i] = Bit<true, schedulerId, usingBatch>(extractLsb(v, i), partyId);
   }
 }
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -627,7 +852,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -635,7 +860,37 @@ template <typename T>
 typename Int<isSigned, width, isSecret, schedulerId, usingBatch>::IntType
 Int<isSigned, width, isSecret, schedulerId, usingBatch>::convertBitsToInt(
     const std::array<T, width>& data) {
-  if constexpr (usingBatch) {
+  if constexpr (width > 64) {
+    // a set sign bit also sets all the bits above it
+    auto setBit = [](UnitIntType& unit, int16_t i) {
+      if (isSigned && i == width - 1) {
+        unit.back() |= ~uint64_t(0) << (i % 64);
+      } else {
+        unit[i / 64] |= uint64_t(1) << (i % 64);
+      }
+    };
+    if constexpr (usingBatch) {
+      IntType rst;
+      for (int16_t i = 0; i < width; i++) {
+        auto bits = data.at(i).getValue();
+        rst.resize(bits.size(), UnitIntType{});
+        for (size_t j = 0; j < bits.size(); j++) {
+          if (bits.at(j)) {
+            setBit(rst[j], i);
+          }
+        }
+      }
+      return rst;
+    } else {
+      UnitIntType rst{};
+      for (int16_t i = 0; i < width; i++) {
+        if (data.at(i).getValue()) {
+          setBit(rst, i);
+        }
+      }
+      return rst;
+    }
+  } else if constexpr (usingBatch) {
     // processing the msb(s) and use the result as the starting point
     auto tmp = data.at(width - 1).getValue();
     std::vector<uint64_t> buffer(tmp.size(), 0);
@@ -643,7 +898,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::convertBitsToInt(
 
     // starting from processing data.at(width - 2) since data.at(width - 1)
     // has already been processed
-    for (int8_t i = width - 1; i > 0; i--) {
+    for (int16_t i = width - 1; i > 0; i--) {
       shiftLeft(buffer);
       addLsb(buffer, data.at(i - 1).getValue());
     }
@@ -661,7 +916,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::convertBitsToInt(
     }
   } else {
     uint64_t rst = 0;
-    for (int8_t i = width; i > 0; i--) {
+    for (int16_t i = width; i > 0; i--) {
       rst = rst << 1;
       rst += data.at(i - 1).getValue();
     }
@@ -680,7 +935,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::convertBitsToInt(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -703,7 +958,7 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::batchingWith(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -724,7 +979,24 @@ Int<isSigned, width, isSecret, schedulerId, usingBatch>::unbatching(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>
+Int<isSigned, width, isSecret, schedulerId, usingBatch>::gathering(
+    std::shared_ptr<std::vector<uint32_t>> indexes) const {
+  static_assert(usingBatch, "Only batch values needs to rebatch!");
+  Int<isSigned, width, isSecret, schedulerId, usingBatch> rst;
+  for (size_t i = 0; i < width; i++) {
+    rst.data_[i] = data_.at(i).gathering(indexes);
+  }
+  return rst;
+}
+
+template <
+    bool isSigned,
+    int16_t width,
     bool isSecret,
     int schedulerId,
     bool usingBatch>
@@ -736,7 +1008,7 @@ size_t Int<isSigned, width, isSecret, schedulerId, usingBatch>::getBatchSize()
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret1,
     bool isSecret2,
     int schedulerId,
@@ -749,7 +1021,7 @@ Int<isSigned, width, isSecret1 || isSecret2, schedulerId, usingBatch> max(
 
 template <
     bool isSigned,
-    int8_t width,
+    int16_t width,
     bool isSecret1,
     bool isSecret2,
     int schedulerId,
@@ -769,10 +1041,114 @@ Int<isSigned, width, isSecret1 || isSecret2, schedulerId, usingBatch> min(
  * 2^(X-1)-1. Therefore, the absolute value of -2^(X-1) is still -2^(X-1)
  * due to bit overflow.
  **/
-template <int8_t width, bool isSecret, int schedulerId, bool usingBatch>
+template <int16_t width, bool isSecret, int schedulerId, bool usingBatch>
 Int<true, width, isSecret, schedulerId, usingBatch> abs(
     const Int<true, width, isSecret, schedulerId, usingBatch>& src) {
   return src.mux(src[width - 1], -src);
 }
 
+template <int16_t width, bool isSecret, int schedulerId, bool usingBatch>
+Int<false, width, isSecret, schedulerId, usingBatch> popcount(
+    const std::vector<Bit<isSecret, schedulerId, usingBatch>>& bits) {
+  if (bits.empty()) {
+    throw std::invalid_argument("No bits to count.");
+  }
+  std::vector<std::vector<Bit<isSecret, schedulerId, usingBatch>>> columns(
+      width);
+  columns[0] = bits;
+  auto zero = bits.at(0) ^ bits.at(0);
+  auto counted = multiplier::addColumns<width>(std::move(columns), zero);
+
+  Int<false, width, isSecret, schedulerId, usingBatch> rst;
+  for (int16_t i = 0; i < width; i++) {
+    rst[i] = std::move(counted[i]);
+  }
+  return rst;
+}
+
+template <int16_t width, bool isSecret, int schedulerId>
+Int<false, width, isSecret, schedulerId, true> popcount(
+    const Bit<isSecret, schedulerId, true>& bits) {
+  if (bits.getBatchSize() == 0) {
+    throw std::invalid_argument("No bits to count.");
+  }
+  std::vector<std::vector<Bit<isSecret, schedulerId, true>>> columns(width);
+  columns[0].push_back(bits);
+  columns = adder_tree::reduceBatchColumns<width>(std::move(columns));
+  auto zero = columns.at(0).at(0) ^ columns.at(0).at(0);
+  auto counted = multiplier::addColumns<width>(std::move(columns), zero);
+
+  Int<false, width, isSecret, schedulerId, true> rst;
+  for (int16_t i = 0; i < width; i++) {
+    rst[i] = std::move(counted[i]);
+  }
+  return rst;
+}
+
+template <
+    int16_t outputWidth,
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId,
+    bool usingBatch>
+Int<isSigned, outputWidth, isSecret, schedulerId, usingBatch> sum(
+    const std::vector<Int<isSigned, width, isSecret, schedulerId, usingBatch>>&
+        src) {
+  if (src.empty()) {
+    throw std::invalid_argument("No integers to add up.");
+  }
+  std::vector<std::vector<Bit<isSecret, schedulerId, usingBatch>>> columns(
+      outputWidth);
+  for (auto& item : src) {
+    for (int16_t i = 0; i < std::min(width, outputWidth); i++) {
+      columns[i].push_back(isSigned && i == width - 1 ? !item[i] : item[i]);
+    }
+  }
+  auto zero = src.at(0)[0] ^ src.at(0)[0];
+  if constexpr (isSigned) {
+    adder_tree::addSignCorrection<outputWidth>(
+        columns, width - 1, src.size(), !zero);
+  }
+  auto added = multiplier::addColumns<outputWidth>(std::move(columns), zero);
+
+  Int<isSigned, outputWidth, isSecret, schedulerId, usingBatch> rst;
+  for (int16_t i = 0; i < outputWidth; i++) {
+    rst[i] = std::move(added[i]);
+  }
+  return rst;
+}
+
+template <
+    int16_t outputWidth,
+    bool isSigned,
+    int16_t width,
+    bool isSecret,
+    int schedulerId>
+Int<isSigned, outputWidth, isSecret, schedulerId, true> sum(
+    const Int<isSigned, width, isSecret, schedulerId, true>& src) {
+  size_t batchSize = src.getBatchSize();
+  if (batchSize == 0) {
+    throw std::invalid_argument("No integers to add up.");
+  }
+  std::vector<std::vector<Bit<isSecret, schedulerId, true>>> columns(
+      outputWidth);
+  for (int16_t i = 0; i < std::min(width, outputWidth); i++) {
+    columns[i].push_back(isSigned && i == width - 1 ? !src[i] : src[i]);
+  }
+  columns = adder_tree::reduceBatchColumns<outputWidth>(std::move(columns));
+  auto zero = columns.at(0).at(0) ^ columns.at(0).at(0);
+  if constexpr (isSigned) {
+    adder_tree::addSignCorrection<outputWidth>(
+        columns, width - 1, batchSize, !zero);
+  }
+  auto added = multiplier::addColumns<outputWidth>(std::move(columns), zero);
+
+  Int<isSigned, outputWidth, isSecret, schedulerId, true> rst;
+  for (int16_t i = 0; i < outputWidth; i++) {
+    rst[i] = std::move(added[i]);
+  }
+  return rst;
+}
+
 } // namespace fbpcf::frontend
@@ -19,6 +19,7 @@ class MPCTypes {
   static const size_t charLength = 8;
   static const size_t int32Length = 32;
   static const size_t int64Length = 64;
+  static const int8_t fixedPointFractionalBits = 16;
 
  public:
   /** Secure private types **/
@@ -40,6 +41,12 @@ class MPCTypes {
   using SecUnsigned64Int = typename MpcGame<
       schedulerId>::template SecUnsignedInt<int64Length, usingBatch>;
 
+  // integers modulo 2^64 on arithmetic wires
+  using SecArithmeticInt =
+      typename MpcGame<schedulerId>::template SecArithmeticInt<usingBatch>;
+  using SecFixedPoint = typename MpcGame<schedulerId>::
+      template SecFixedPoint<fixedPointFractionalBits, usingBatch>;
+
   /** Public shared types **/
   using PubBool = typename MpcGame<schedulerId>::template PubBit<usingBatch>;
 
@@ -58,6 +65,12 @@ class MPCTypes {
       schedulerId>::template PubUnsignedInt<int32Length, usingBatch>;
   using PubUnsigned64Int = typename MpcGame<
       schedulerId>::template PubUnsignedInt<int64Length, usingBatch>;
+
+  // integers modulo 2^64 on arithmetic wires
+  using PubArithmeticInt =
+      typename MpcGame<schedulerId>::template PubArithmeticInt<usingBatch>;
+  using PubFixedPoint = typename MpcGame<schedulerId>::
+      template PubFixedPoint<fixedPointFractionalBits, usingBatch>;
 };
 
 } // namespace fbpcf::frontend
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "fbpcf/frontend/ParallelPrefixAdder.h"
+
+namespace fbpcf::frontend::multiplier {
+
+/**
+ * Get the canonical signed-digit (non-adjacent form) representation of a
+ * constant modulo 2^width: digits[k] in {-1, 0, 1} and no two adjacent digits
+ * are non-zero, so at most (width + 1) / 2 of them are.
+ */
+constexpr std::array<int8_t, 64> getCanonicalSignedDigits(
+    uint64_t constant,
+    int8_t width) {
+  std::array<int8_t, 64> digits{};
+  for (int8_t k = 0; k < width; k++) {
+    if (constant & 1) {
+      // pick the digit that makes the remainder divisible by 4
+      digits[k] = (constant & 2) ? -1 : 1;
+      constant -= digits[k];
+    }
+    constant >>= 1;
+  }
+  return digits;
+}
+
+// Sum three bits of weight 2^i into a sum of weight 2^i and a carry of weight
+// 2^(i + 1) with a single AND.
+template <typename BitType>
+std::pair<BitType, BitType>
+fullAdder(const BitType& a, const BitType& b, const BitType& c) {
+  auto sum = a ^ b ^ c;
+  auto carry = ((a ^ c) & (b ^ c)) ^ c;
+  return {std::move(sum), std::move(carry)};
+}
+
+/**
+ * Add up the bits of every column modulo 2^width, where column i holds bits of
+ * weight 2^i. The columns are first reduced to at most two bits each by a
+ * Dadda tree of full and half adders, whose stages have no dependency within
+ * themselves and thus cost one round trip each. The two remaining rows are
+ * then added with a Sklansky adder. zero must be a bit of value 0, it pads the
+ * columns that run out of bits.
+ */
+template <size_t width, typename BitType>
+std::array<BitType, width> addColumns(
+    std::vector<std::vector<BitType>> columns,
+    const BitType& zero) {
+  size_t maxHeight = 0;
+  for (auto& column : columns) {
+    maxHeight = std::max(maxHeight, column.size());
+  }
+  std::vector<size_t> targetHeights = {2};
+  while (targetHeights.back() * 3 / 2 < maxHeight) {
+    targetHeights.push_back(targetHeights.back() * 3 / 2);
+  }
+
+  for (auto target = targetHeights.rbegin(); target != targetHeights.rend();
+       target++) {
+    std::vector<std::vector<BitType>> nextColumns(width);
+    for (size_t i = 0; i < width; i++) {
+      auto& column = columns.at(i);
+      size_t height = column.size() + nextColumns.at(i).size();
+      // the carries stay in the bits of weight 2^width, which are dropped
+      auto pushCarry = [&](BitType&& carry) {
+        if (i + 1 < width) {
+          nextColumns[i + 1].push_back(std::move(carry));
+        }
+      };
+      while (height > *target && column.size() >= 2) {
+        auto a = std::move(column.back());
+        column.pop_back();
+        auto b = std::move(column.back());
+        column.pop_back();
+        if (height - *target >= 2 && !column.empty()) {
+          auto c = std::move(column.back());
+          column.pop_back();
+          auto [sum, carry] = fullAdder(a, b, c);
+          nextColumns[i].push_back(std::move(sum));
+          pushCarry(std::move(carry));
+          height -= 2;
+        } else {
+          nextColumns[i].push_back(a ^ b);
+          pushCarry(a & b);
+          height -= 1;
+        }
+      }
+      for (auto& bit : column) {
+        nextColumns[i].push_back(std::move(bit));
+      }
+    }
+    columns = std::move(nextColumns);
+  }
+
+  std::array<BitType, width> rst;
+  size_t start = 0;
+  for (; start < width && columns.at(start).size() < 2; start++) {
+    rst[start] = columns.at(start).empty() ? zero : columns.at(start).at(0);
+  }
+  if (start == width) {
+    return rst;
+  }
+
+  std::vector<BitType> generate;
+  std::vector<BitType> propagate;
+  for (size_t i = start; i < width; i++) {
+    auto& column = columns.at(i);
+    if (column.size() == 2) {
+      propagate.push_back(column.at(0) ^ column.at(1));
+      if (i + 1 < width) {
+        generate.push_back(column.at(0) & column.at(1));
+      }
+    } else {
+      propagate.push_back(column.empty() ? zero : column.at(0));
+      if (i + 1 < width) {
+        generate.push_back(zero);
+      }
+    }
+  }
+  std::vector<BitType> groupPropagate(propagate.begin(), propagate.end() - 1);
+  parallel_prefix::computeCarries(
+      AdderType::Sklansky, generate, groupPropagate);
+  rst[start] = propagate.at(0);
+  for (size_t i = 1; i < propagate.size(); i++) {
+    rst[start + i] = propagate.at(i) ^ generate.at(i - 1);
+  }
+  return rst;
+}
+
+/**
+ * Multiply two little-endian bit arrays modulo 2^width, which is the same for
+ * signed and unsigned integers. Row i of partial products is right[i] AND the
+ * low bits of left, computed as one composite AND.
+ */
+template <
+    typename OutputBitType,
+    typename LeftBitType,
+    typename RightBitType,
+    size_t width>
+std::array<OutputBitType, width> multiply(
+    const std::array<LeftBitType, width>& left,
+    const std::array<RightBitType, width>& right) {
+  std::vector<std::vector<OutputBitType>> columns(width);
+  for (size_t i = 0; i < width; i++) {
+    auto row = right.at(i) &
+        std::vector<LeftBitType>(left.begin(), left.end() - i);
+    for (size_t j = 0; j < row.size(); j++) {
+      columns[i + j].push_back(std::move(row[j]));
+    }
+  }
+  auto zero = columns.at(0).at(0) ^ columns.at(0).at(0);
+  return addColumns<width>(std::move(columns), zero);
+}
+
+/**
+ * Multiply a little-endian bit array with a constant modulo 2^width. With the
+ * canonical signed digits of the constant, only about width / 3 shifted copies
+ * of the input are added up, and no partial product needs an AND. A digit -1
+ * at position k adds -(x << k) = (!x << k) + 2^k; the constant 2^k is folded
+ * into the columns for free with b + 2^k = !b + 2^(k + 1) * b, where b is any
+ * bit of weight 2^k.
+ */
+template <uint64_t constant, typename BitType, size_t width>
+std::array<BitType, width> multiplyByConstant(
+    const std::array<BitType, width>& src) {
+  constexpr auto digits = getCanonicalSignedDigits(constant, width);
+  std::vector<std::vector<BitType>> columns(width);
+  std::vector<bool> constantBits(width + 1, false);
+  for (size_t k = 0; k < width; k++) {
+    if (digits[k] == 0) {
+      continue;
+    }
+    for (size_t j = 0; j + k < width; j++) {
+      columns[j + k].push_back(digits[k] > 0 ? src.at(j) : !src.at(j));
+    }
+    if (digits[k] < 0) {
+      // add 2^k to the constant
+      size_t position = k;
+      while (position < width && constantBits[position]) {
+        constantBits[position++] = false;
+      }
+      constantBits[position] = true;
+    }
+  }
+
+  auto zero = src.at(0) ^ src.at(0);
+  for (size_t k = 0; k < width; k++) {
+    if (!constantBits[k]) {
+      continue;
+    }
+    if (columns[k].empty()) {
+      columns[k].push_back(!zero);
+    } else {
+      auto bit = std::move(columns[k].back());
+      columns[k].back() = !bit;
+      if (k + 1 < width) {
+        columns[k + 1].push_back(std::move(bit));
+      }
+    }
+  }
+  return addColumns<width>(std::move(columns), zero);
+}
+
+} // namespace fbpcf::frontend::multiplier
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace fbpcf::frontend {
+
+/**
+ * The circuits available to add and subtract integers. A ripple-carry adder
+ * uses the fewest AND gates (width - 1), but they all depend on each other, so
+ * a secret addition costs width - 1 round trips. Parallel-prefix adders compute
+ * all carries with logarithmic depth at the cost of more AND gates:
+ * Sklansky: depth log2(width), about width / 2 * log2(width) nodes. Its high
+ * fan-out is cheap in MPC since every fan-out is a single composite AND.
+ * Kogge-Stone: depth log2(width), about width * log2(width) nodes.
+ * Brent-Kung: depth 2 * log2(width) - 1, about 2 * width nodes.
+ */
+enum class AdderType {
+  RippleCarry,
+  Sklansky,
+  KoggeStone,
+  BrentKung,
+};
+
+/**
+ * The compile-time policy that picks the adder Int uses for each width on the
+ * scheduler schedulerId. Ripple-carry adders are used by default, other
+ * adders can be opted in to by specializing this template, e.g.
+ *   template <>
+ *   struct AdderPolicy<0> : ParallelPrefixAdderPolicy {};
+ * The specialization must be visible wherever Int's operators are used with
+ * that schedulerId.
+ */
+template <int schedulerId>
+struct AdderPolicy {
+  static constexpr AdderType getAdderType(int16_t /* width */) {
+    return AdderType::RippleCarry;
+  }
+};
+
+// Favors few round trips: use a Sklansky adder unless the integers are so
+// narrow that a ripple-carry adder is about as shallow.
+struct ParallelPrefixAdderPolicy {
+  static constexpr AdderType getAdderType(int16_t width) {
+    return width <= 4 ? AdderType::RippleCarry : AdderType::Sklansky;
+  }
+};
+
+// Use the same adder regardless of the width.
+template <AdderType adderType>
+struct FixedAdderPolicy {
+  static constexpr AdderType getAdderType(int16_t /* width */) {
+    return adderType;
+  }
+};
+
+namespace parallel_prefix {
+
+// A node of a parallel-prefix network: the group of bits ending at position
+// "to" absorbs the adjacent, less significant group ending at position "from".
+struct Node {
+  size_t to;
+  size_t from;
+};
+
+/**
+ * Get the nodes of a parallel-prefix network over the given number of
+ * positions, grouped into levels. The nodes of a level only read the groups
+ * formed by previous levels, thus can be evaluated in parallel.
+ */
+inline std::vector<std::vector<Node>> getNetwork(AdderType type, size_t size) {
+  std::vector<std::vector<Node>> levels;
+  switch (type) {
+    case AdderType::Sklansky:
+      for (size_t distance = 1; distance < size; distance *= 2) {
+        std::vector<Node> level;
+        for (size_t i = 0; i < size; i++) {
+          if ((i / distance) % 2 == 1) {
+            level.push_back(Node{i, i / distance * distance - 1});
+          }
+        }
+        levels.push_back(std::move(level));
+      }
+      break;
+    case AdderType::KoggeStone:
+      for (size_t distance = 1; distance < size; distance *= 2) {
+        std::vector<Node> level;
+        for (size_t i = distance; i < size; i++) {
+          level.push_back(Node{i, i - distance});
+        }
+        levels.push_back(std::move(level));
+      }
+      break;
+    case AdderType::BrentKung: {
+      size_t distance = 1;
+      for (; distance < size; distance *= 2) {
+        std::vector<Node> level;
+        for (size_t i = 2 * distance - 1; i < size; i += 2 * distance) {
+          level.push_back(Node{i, i - distance});
+        }
+        if (!level.empty()) {
+          levels.push_back(std::move(level));
+        }
+      }
+      for (distance /= 4; distance > 0; distance /= 2) {
+        std::vector<Node> level;
+        for (size_t i = 3 * distance - 1; i < size; i += 2 * distance) {
+          level.push_back(Node{i, i - distance});
+        }
+        if (!level.empty()) {
+          levels.push_back(std::move(level));
+        }
+      }
+      break;
+    }
+    case AdderType::RippleCarry:
+    default:
+      for (size_t i = 1; i < size; i++) {
+        levels.push_back({Node{i, i - 1}});
+      }
+  }
+  return levels;
+}
+
+/**
+ * Run a parallel-prefix network over the generate and propagate bits of each
+ * position. Afterwards generate[i] holds the carry out of position i, i.e. the
+ * generate bit of the group of positions 0 to i. propagate is used as scratch
+ * space. All nodes of a level that absorb the same group share one composite
+ * AND per gate.
+ */
+template <typename BitType>
+void computeCarries(
+    AdderType type,
+    std::vector<BitType>& generate,
+    std::vector<BitType>& propagate) {
+  // the least significant position of the group ending at each position
+  std::vector<size_t> groupStart(generate.size());
+  std::iota(groupStart.begin(), groupStart.end(), 0);
+
+  for (auto& level : getNetwork(type, generate.size())) {
+    std::map<size_t, std::vector<size_t>> targetsBySource;
+    for (auto& node : level) {
+      targetsBySource[node.from].push_back(node.to);
+    }
+
+    // evaluate the whole level before updating any group since a group may
+    // absorb another one while being absorbed itself (e.g. Kogge-Stone).
+    std::vector<std::pair<size_t, BitType>> newGenerate;
+    std::vector<std::pair<size_t, BitType>> newPropagate;
+    std::vector<std::pair<size_t, size_t>> newGroupStart;
+    for (auto& [from, targets] : targetsBySource) {
+      std::vector<BitType> targetPropagate;
+      for (auto to : targets) {
+        targetPropagate.push_back(propagate.at(to));
+      }
+
+      // generate and propagate of a group never hold at the same time, hence
+      // OR can be replaced by XOR.
+      auto carried = generate.at(from) & targetPropagate;
+      for (size_t i = 0; i < targets.size(); i++) {
+        newGenerate.emplace_back(
+            targets[i], generate.at(targets[i]) ^ carried[i]);
+        newGroupStart.emplace_back(targets[i], groupStart.at(from));
+      }
+      // the propagate bit of a group starting at position 0 is never used
+      if (groupStart.at(from) != 0) {
+        auto propagated = propagate.at(from) & targetPropagate;
+        for (size_t i = 0; i < targets.size(); i++) {
+          newPropagate.emplace_back(targets[i], std::move(propagated[i]));
+        }
+      }
+    }
+
+    for (auto& [position, bit] : newGenerate) {
+      generate[position] = std::move(bit);
+    }
+    for (auto& [position, bit] : newPropagate) {
+      propagate[position] = std::move(bit);
+    }
+    for (auto& [position, start] : newGroupStart) {
+      groupStart[position] = start;
+    }
+  }
+}
+
+/**
+ * Add (or subtract) two little-endian bit arrays modulo 2^width with a
+ * parallel-prefix adder. Subtraction is computed as left + !right + 1.
+ */
+template <
+    bool subtract,
+    typename OutputBitType,
+    typename LeftBitType,
+    typename RightBitType,
+    size_t width>
+std::array<OutputBitType, width> add(
+    AdderType type,
+    const std::array<LeftBitType, width>& left,
+    const std::array<RightBitType, width>& right) {
+  std::vector<OutputBitType> generate(width - 1);
+  std::vector<OutputBitType> propagate(width);
+  for (size_t i = 0; i < width; i++) {
+    if constexpr (subtract) {
+      auto negated = !right.at(i);
+      propagate[i] = left.at(i) ^ negated;
+      if (i < width - 1) {
+        generate[i] = left.at(i) & negated;
+      }
+    } else {
+      propagate[i] = left.at(i) ^ right.at(i);
+      if (i < width - 1) {
+        generate[i] = left.at(i) & right.at(i);
+      }
+    }
+  }
+
+  std::array<OutputBitType, width> rst;
+  if constexpr (subtract) {
+    // fold the carry-in of 1 into the least significant position
+    rst[0] = !propagate[0];
+    if (width > 1) {
+      generate[0] = generate[0] ^ propagate[0];
+    }
+  } else {
+    rst[0] = propagate[0];
+  }
+
+  std::vector<OutputBitType> groupPropagate(
+      propagate.begin(), propagate.begin() + (width - 1));
+  computeCarries(type, generate, groupPropagate);
+  for (size_t i = 1; i < width; i++) {
+    rst[i] = propagate[i] ^ generate[i - 1];
+  }
+  return rst;
+}
+
+} // namespace parallel_prefix
+
+} // namespace fbpcf::frontend
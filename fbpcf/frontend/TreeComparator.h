@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace fbpcf::frontend {
+
+/**
+ * The circuits available to compare integers. A ripple comparator uses width
+ * AND gates but has a depth of width, i.e. one round trip per bit. A tree
+ * comparator combines the (less than, equal) pairs of adjacent segments in
+ * log2(width) levels, using one AND per bit plus one composite AND of two
+ * outputs per combination.
+ */
+enum class ComparatorType {
+  Ripple,
+  Tree,
+};
+
+/**
+ * The compile-time policy that picks the comparator Int uses for each width on
+ * the scheduler schedulerId. Ripple comparators are used by default, tree
+ * comparators can be opted in to by specializing this template, e.g.
+ *   template <>
+ *   struct ComparatorPolicy<0> : TreeComparatorPolicy {};
+ * The specialization must be visible wherever Int's operators are used with
+ * that schedulerId.
+ */
+template <int schedulerId>
+struct ComparatorPolicy {
+  static constexpr ComparatorType getComparatorType(int16_t /* width */) {
+    return ComparatorType::Ripple;
+  }
+};
+
+// Favors fewer round trips over fewer AND gates: use a tree comparator unless
+// the integers are so narrow that a ripple comparator is about as shallow.
+struct TreeComparatorPolicy {
+  static constexpr ComparatorType getComparatorType(int16_t width) {
+    return width <= 2 ? ComparatorType::Ripple : ComparatorType::Tree;
+  }
+};
+
+namespace tree_comparator {
+
+/**
+ * Compare two little-endian bit arrays. The most significant bit is a sign bit
+ * if isSigned is true.
+ * Each segment of bits is described by a pair (lt, eq), whether left is less
+ * than respectively equal to right on these bits. Two adjacent segments
+ * combine into lt = lt_high ^ (eq_high & lt_low) and eq = eq_high & eq_low,
+ * where both ANDs share eq_high and are evaluated as one composite AND. The
+ * eq of segments containing the least significant bit is never needed.
+ */
+template <
+    bool isSigned,
+    typename OutputBitType,
+    typename LeftBitType,
+    typename RightBitType,
+    size_t width>
+OutputBitType lessThan(
+    const std::array<LeftBitType, width>& left,
+    const std::array<RightBitType, width>& right) {
+  std::vector<OutputBitType> lessThan(width);
+  std::vector<OutputBitType> equal(width);
+  for (size_t i = 0; i < width; i++) {
+    if (isSigned && i == width - 1) {
+      // a negative left is less than a non-negative right
+      lessThan[i] = left.at(i) & (!right.at(i));
+    } else {
+      lessThan[i] = (!left.at(i)) & right.at(i);
+    }
+    if (i > 0) {
+      equal[i] = !(left.at(i) ^ right.at(i));
+    }
+  }
+
+  while (lessThan.size() > 1) {
+    std::vector<OutputBitType> nextLessThan;
+    std::vector<OutputBitType> nextEqual;
+    for (size_t low = 0; low + 1 < lessThan.size(); low += 2) {
+      auto high = low + 1;
+      if (low == 0) {
+        nextLessThan.push_back(
+            lessThan.at(high) ^ (equal.at(high) & lessThan.at(low)));
+        nextEqual.push_back(OutputBitType());
+      } else {
+        auto combined = equal.at(high) &
+            std::vector<OutputBitType>{lessThan.at(low), equal.at(low)};
+        nextLessThan.push_back(lessThan.at(high) ^ combined.at(0));
+        nextEqual.push_back(std::move(combined.at(1)));
+      }
+    }
+    if (lessThan.size() % 2 == 1) {
+      nextLessThan.push_back(std::move(lessThan.back()));
+      nextEqual.push_back(std::move(equal.back()));
+    }
+    lessThan = std::move(nextLessThan);
+    equal = std::move(nextEqual);
+  }
+  return lessThan.at(0);
+}
+
+} // namespace tree_comparator
+
+} // namespace fbpcf::frontend
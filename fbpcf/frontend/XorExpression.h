@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "fbpcf/frontend/Bit.h"
+#include "fbpcf/scheduler/IScheduler.h"
+
+namespace fbpcf::frontend {
+
+/**
+ * A deferred XOR of bits. XOR-ing a bit into an expression or inverting it
+ * only records the operation; converting the expression into a Bit emits a
+ * single gate with a single output wire, see IScheduler::multiXor(). An
+ * expression such as !(a ^ b ^ c ^ d) thus allocates one wire instead of four,
+ * and avoids the reference counting of the intermediate results.
+ * An expression always starts from a bit, and it is secret iff any of its
+ * operands is.
+ */
+template <bool isSecret, int schedulerId, bool usingBatch = false>
+class XorExpression : public scheduler::SchedulerKeeper<schedulerId> {
+  using WireType =
+      scheduler::IScheduler::WireId<scheduler::IScheduler::Boolean>;
+
+ public:
+  /* implicit */ XorExpression(
+      const Bit<isSecret, schedulerId, usingBatch>& src);
+
+  /* implicit */ XorExpression(Bit<isSecret, schedulerId, usingBatch>&& src);
+
+  /**
+   * XOR another bit or expression into this expression. A public expression
+   * can't take secret operands.
+   */
+  template <bool isSecretOther>
+  XorExpression<isSecret, schedulerId, usingBatch>& operator^=(
+      const Bit<isSecretOther, schedulerId, usingBatch>& other);
+
+  template <bool isSecretOther>
+  XorExpression<isSecret, schedulerId, usingBatch>& operator^=(
+      const XorExpression<isSecretOther, schedulerId, usingBatch>& other);
+
+  template <bool isSecretOther>
+  XorExpression<isSecret || isSecretOther, schedulerId, usingBatch> operator^(
+      const Bit<isSecretOther, schedulerId, usingBatch>& other) const&;
+
+  template <bool isSecretOther>
+  XorExpression<isSecret || isSecretOther, schedulerId, usingBatch> operator^(
+      const Bit<isSecretOther, schedulerId, usingBatch>& other) &&;
+
+  template <bool isSecretOther>
+  XorExpression<isSecret || isSecretOther, schedulerId, usingBatch> operator^(
+      const XorExpression<isSecretOther, schedulerId, usingBatch>& other)
+      const&;
+
+  template <bool isSecretOther>
+  XorExpression<isSecret || isSecretOther, schedulerId, usingBatch> operator^(
+      const XorExpression<isSecretOther, schedulerId, usingBatch>& other) &&;
+
+  XorExpression<isSecret, schedulerId, usingBatch> operator!() const&;
+
+  XorExpression<isSecret, schedulerId, usingBatch> operator!() &&;
+
+  /**
+   * Evaluate this expression. An expression made of a single bit gives that
+   * bit back without any new gate.
+   */
+  Bit<isSecret, schedulerId, usingBatch> toBit() const;
+
+  /* implicit */ operator Bit<isSecret, schedulerId, usingBatch>() const {
+    return toBit();
+  }
+
+ private:
+  XorExpression() = default;
+
+  template <bool isSecretOther>
+  static XorExpression<isSecret || isSecretOther, schedulerId, usingBatch>
+  withOperandsOf(XorExpression<isSecret, schedulerId, usingBatch>&& src);
+
+  std::vector<Bit<true, schedulerId, usingBatch>> privateOperands_;
+  std::vector<Bit<false, schedulerId, usingBatch>> publicOperands_;
+  bool negated_ = false;
+
+  template <bool, int, bool>
+  friend class XorExpression;
+};
+
+template <bool isSecret, bool isSecretOther, int schedulerId, bool usingBatch>
+XorExpression<isSecret || isSecretOther, schedulerId, usingBatch> operator^(
+    const Bit<isSecret, schedulerId, usingBatch>& left,
+    const XorExpression<isSecretOther, schedulerId, usingBatch>& right) {
+  return right ^ left;
+}
+
+} // namespace fbpcf::frontend
+
+#include "fbpcf/frontend/XorExpression_impl.h"
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <utility>
+
+// included for clangd resolution. Should not execute during compilation
+#include "fbpcf/frontend/XorExpression.h"
+
+namespace fbpcf::frontend {
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::XorExpression(
+    const Bit<isSecret, schedulerId, usingBatch>& src) {
+  *this ^= src;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::XorExpression(
+    Bit<isSecret, schedulerId, usingBatch>&& src) {
+  if constexpr (isSecret) {
+    privateOperands_.push_back(std::move(src));
+  } else {
+    publicOperands_.push_back(std::move(src));
+  }
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+XorExpression<isSecret, schedulerId, usingBatch>&
+XorExpression<isSecret, schedulerId, usingBatch>::operator^=(
+    const Bit<isSecretOther, schedulerId, usingBatch>& other) {
+  static_assert(
+      isSecret || !isSecretOther,
+      "A public expression can't take secret operands.");
+  if constexpr (isSecretOther) {
+    privateOperands_.push_back(other);
+  } else {
+    publicOperands_.push_back(other);
+  }
+  return *this;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+XorExpression<isSecret, schedulerId, usingBatch>&
+XorExpression<isSecret, schedulerId, usingBatch>::operator^=(
+    const XorExpression<isSecretOther, schedulerId, usingBatch>& other) {
+  static_assert(
+      isSecret || !isSecretOther,
+      "A public expression can't take secret operands.");
+  privateOperands_.insert(
+      privateOperands_.end(),
+      other.privateOperands_.begin(),
+      other.privateOperands_.end());
+  publicOperands_.insert(
+      publicOperands_.end(),
+      other.publicOperands_.begin(),
+      other.publicOperands_.end());
+  negated_ = negated_ != other.negated_;
+  return *this;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+XorExpression<isSecret || isSecretOther, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::withOperandsOf(
+    XorExpression<isSecret, schedulerId, usingBatch>&& src) {
+  XorExpression<isSecret || isSecretOther, schedulerId, usingBatch> rst;
+  rst.privateOperands_ = std::move(src.privateOperands_);
+  rst.publicOperands_ = std::move(src.publicOperands_);
+  rst.negated_ = src.negated_;
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+XorExpression<isSecret || isSecretOther, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::operator^(
+    const Bit<isSecretOther, schedulerId, usingBatch>& other) const& {
+  return XorExpression<isSecret, schedulerId, usingBatch>(*this) ^ other;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+XorExpression<isSecret || isSecretOther, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::operator^(
+    const Bit<isSecretOther, schedulerId, usingBatch>& other) && {
+  auto rst = withOperandsOf<isSecretOther>(std::move(*this));
+  rst ^= other;
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+XorExpression<isSecret || isSecretOther, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::operator^(
+    const XorExpression<isSecretOther, schedulerId, usingBatch>& other) const& {
+  return XorExpression<isSecret, schedulerId, usingBatch>(*this) ^ other;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+template <bool isSecretOther>
+XorExpression<isSecret || isSecretOther, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::operator^(
+    const XorExpression<isSecretOther, schedulerId, usingBatch>& other) && {
+  auto rst = withOperandsOf<isSecretOther>(std::move(*this));
+  rst ^= other;
+  return rst;
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::operator!() const& {
+  return !XorExpression<isSecret, schedulerId, usingBatch>(*this);
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::operator!() && {
+  negated_ = !negated_;
+  return std::move(*this);
+}
+
+template <bool isSecret, int schedulerId, bool usingBatch>
+Bit<isSecret, schedulerId, usingBatch>
+XorExpression<isSecret, schedulerId, usingBatch>::toBit() const {
+  if (!negated_ && privateOperands_.size() + publicOperands_.size() == 1) {
+    if constexpr (isSecret) {
+      return privateOperands_.at(0);
+    } else {
+      return publicOperands_.at(0);
+    }
+  }
+
+  std::vector<WireType> privateWires;
+  privateWires.reserve(privateOperands_.size());
+  for (auto& bit : privateOperands_) {
+    privateWires.push_back(bit.id_);
+  }
+  std::vector<WireType> publicWires;
+  publicWires.reserve(publicOperands_.size());
+  for (auto& bit : publicOperands_) {
+    publicWires.push_back(bit.id_);
+  }
+
+  Bit<isSecret, schedulerId, usingBatch> rst;
+  if constexpr (usingBatch) {
+    rst.id_ = scheduler::SchedulerKeeper<schedulerId>::getScheduler()
+                  .multiXorBatch(privateWires, publicWires, negated_);
+  } else {
+    rst.id_ = scheduler::SchedulerKeeper<schedulerId>::getScheduler()
+                  .multiXor(privateWires, publicWires, negated_);
+  }
+  return rst;
+}
+
+} // namespace fbpcf::frontend
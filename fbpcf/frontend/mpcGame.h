@@ -9,7 +9,9 @@
 #include <memory>
 #include <type_traits>
 #include <vector>
+#include "fbpcf/frontend/ArithmeticInt.h"
 #include "fbpcf/frontend/Bit.h"
+#include "fbpcf/frontend/FixedPoint.h"
 #include "fbpcf/frontend/Int.h"
 #include "fbpcf/frontend/util.h"
 #include "fbpcf/scheduler/IScheduler.h"
@@ -23,8 +25,20 @@ class MpcGame {
   using BatchedType = typename std::conditional<usingBatch, Batch<T>, T>::type;
 
  public:
-  explicit MpcGame(std::unique_ptr<scheduler::IScheduler> scheduler) {
-    scheduler::SchedulerKeeper<schedulerId>::setScheduler(std::move(scheduler));
+  // A game with a thread-local scheduler only provides the scheduler to the
+  // thread constructing it, so that multiple games with the same schedulerId
+  // can run concurrently on different threads. Such a game must be used and
+  // destroyed on that thread.
+  explicit MpcGame(
+      std::unique_ptr<scheduler::IScheduler> scheduler,
+      bool threadLocalScheduler = false) {
+    if (threadLocalScheduler) {
+      scheduler::SchedulerKeeper<schedulerId>::setThreadLocalScheduler(
+          std::move(scheduler));
+    } else {
+      scheduler::SchedulerKeeper<schedulerId>::setScheduler(
+          std::move(scheduler));
+    }
   }
 
   ~MpcGame() {
@@ -59,6 +73,24 @@ class MpcGame {
   template <size_t width, bool usingBatch = false>
   using SecUnsignedInt =
       Integer<Secret<BatchedType<Unsigned<width>, usingBatch>>, schedulerId>;
+
+  // integers modulo 2^64 on arithmetic wires, these require an
+  // IArithmeticScheduler
+  template <bool usingBatch = false>
+  using PubArithmeticInt =
+      frontend::ArithmeticInt<false, schedulerId, usingBatch>;
+  template <bool usingBatch = false>
+  using SecArithmeticInt =
+      frontend::ArithmeticInt<true, schedulerId, usingBatch>;
+
+  // fixed-point numbers on arithmetic wires, these require an
+  // IArithmeticScheduler
+  template <int8_t fractionalBits, bool usingBatch = false>
+  using PubFixedPoint =
+      frontend::FixedPoint<fractionalBits, false, schedulerId, usingBatch>;
+  template <int8_t fractionalBits, bool usingBatch = false>
+  using SecFixedPoint =
+      frontend::FixedPoint<fractionalBits, true, schedulerId, usingBatch>;
 };
 
 } // namespace fbpcf::frontend
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "fbpcf/frontend/ArithmeticInt.h"
+#include "fbpcf/frontend/Int.h"
+#include "fbpcf/scheduler/PlaintextScheduler.h"
+#include "fbpcf/scheduler/WireKeeper.h"
+
+namespace fbpcf::frontend {
+
+class ArithmeticIntTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    scheduler::SchedulerKeeper<0>::setScheduler(
+        std::make_unique<scheduler::PlaintextScheduler>(
+            scheduler::WireKeeper::createWithUnorderedMap()));
+  }
+
+  void TearDown() override {
+    scheduler::SchedulerKeeper<0>::freeScheduler();
+  }
+};
+
+TEST_F(ArithmeticIntTest, testInputAndOutput) {
+  using SecArithmeticInt = ArithmeticInt<true, 0>;
+  using SecArithmeticIntBatch = ArithmeticInt<true, 0, true>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  for (int i = 0; i < 10; i++) {
+    auto v = dist(e);
+    SecArithmeticInt secret(v, partyId);
+    EXPECT_EQ(secret.openToParty(partyId).getValue(), v);
+
+    SecArithmeticInt recovered(secret.extractIntShare());
+    EXPECT_EQ(recovered.openToParty(partyId).getValue(), v);
+  }
+
+  std::vector<uint64_t> batch{dist(e), dist(e), dist(e)};
+  SecArithmeticIntBatch secretBatch(batch, partyId);
+  EXPECT_EQ(secretBatch.getBatchSize(), batch.size());
+  EXPECT_EQ(secretBatch.openToParty(partyId).getValue(), batch);
+}
+
+TEST_F(ArithmeticIntTest, testArithmetic) {
+  using SecArithmeticInt = ArithmeticInt<true, 0>;
+  using PubArithmeticInt = ArithmeticInt<false, 0>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  for (int i = 0; i < 10; i++) {
+    auto v1 = dist(e);
+    auto v2 = dist(e);
+    SecArithmeticInt secret1(v1, partyId);
+    SecArithmeticInt secret2(v2, partyId);
+    PubArithmeticInt public1(v1);
+    PubArithmeticInt public2(v2);
+
+    EXPECT_EQ((secret1 + secret2).openToParty(partyId).getValue(), v1 + v2);
+    EXPECT_EQ((secret1 + public2).openToParty(partyId).getValue(), v1 + v2);
+    EXPECT_EQ((public1 + secret2).openToParty(partyId).getValue(), v1 + v2);
+    EXPECT_EQ((public1 + public2).getValue(), v1 + v2);
+
+    EXPECT_EQ((secret1 - secret2).openToParty(partyId).getValue(), v1 - v2);
+    EXPECT_EQ((secret1 - public2).openToParty(partyId).getValue(), v1 - v2);
+    EXPECT_EQ((public1 - secret2).openToParty(partyId).getValue(), v1 - v2);
+    EXPECT_EQ((public1 - public2).getValue(), v1 - v2);
+
+    EXPECT_EQ((-secret1).openToParty(partyId).getValue(), -v1);
+    EXPECT_EQ((-public1).getValue(), -v1);
+
+    EXPECT_EQ((secret1 * secret2).openToParty(partyId).getValue(), v1 * v2);
+    EXPECT_EQ((secret1 * public2).openToParty(partyId).getValue(), v1 * v2);
+    EXPECT_EQ((public1 * secret2).openToParty(partyId).getValue(), v1 * v2);
+    EXPECT_EQ((public1 * public2).getValue(), v1 * v2);
+  }
+}
+
+TEST_F(ArithmeticIntTest, testArithmeticBatch) {
+  using SecArithmeticIntBatch = ArithmeticInt<true, 0, true>;
+  using PubArithmeticIntBatch = ArithmeticInt<false, 0, true>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+  size_t batchSize = 9;
+
+  std::vector<uint64_t> v1(batchSize);
+  std::vector<uint64_t> v2(batchSize);
+  std::vector<uint64_t> expectedSum(batchSize);
+  std::vector<uint64_t> expectedDifference(batchSize);
+  std::vector<uint64_t> expectedNegation(batchSize);
+  std::vector<uint64_t> expectedProduct(batchSize);
+  for (size_t i = 0; i < batchSize; i++) {
+    v1[i] = dist(e);
+    v2[i] = dist(e);
+    expectedSum[i] = v1[i] + v2[i];
+    expectedDifference[i] = v1[i] - v2[i];
+    expectedNegation[i] = -v1[i];
+    expectedProduct[i] = v1[i] * v2[i];
+  }
+
+  SecArithmeticIntBatch secret1(v1, partyId);
+  SecArithmeticIntBatch secret2(v2, partyId);
+  PubArithmeticIntBatch public1(v1);
+  PubArithmeticIntBatch public2(v2);
+
+  EXPECT_EQ((secret1 + secret2).openToParty(partyId).getValue(), expectedSum);
+  EXPECT_EQ((secret1 + public2).openToParty(partyId).getValue(), expectedSum);
+  EXPECT_EQ((public1 + secret2).openToParty(partyId).getValue(), expectedSum);
+  EXPECT_EQ((public1 + public2).getValue(), expectedSum);
+
+  EXPECT_EQ(
+      (secret1 - secret2).openToParty(partyId).getValue(), expectedDifference);
+  EXPECT_EQ(
+      (public1 - secret2).openToParty(partyId).getValue(), expectedDifference);
+  EXPECT_EQ((public1 - public2).getValue(), expectedDifference);
+
+  EXPECT_EQ((-secret1).openToParty(partyId).getValue(), expectedNegation);
+  EXPECT_EQ((-public1).getValue(), expectedNegation);
+
+  EXPECT_EQ(
+      (secret1 * secret2).openToParty(partyId).getValue(), expectedProduct);
+  EXPECT_EQ(
+      (secret1 * public2).openToParty(partyId).getValue(), expectedProduct);
+  EXPECT_EQ((public1 * public2).getValue(), expectedProduct);
+}
+
+TEST_F(ArithmeticIntTest, testInnerProduct) {
+  using SecArithmeticInt = ArithmeticInt<true, 0>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+
+  uint64_t expectedValue = 0;
+  SecArithmeticInt rst(0, 0);
+  for (int i = 0; i < 16; i++) {
+    auto v1 = dist(e);
+    auto v2 = dist(e);
+    expectedValue += v1 * v2;
+    rst = rst + SecArithmeticInt(v1, 0) * SecArithmeticInt(v2, 1);
+  }
+  EXPECT_EQ(rst.openToParty(0).getValue(), expectedValue);
+}
+
+// The value of an integer of the given width as a uint64_t, sign extended if
+// it is signed.
+template <bool isSigned, int8_t width>
+uint64_t toUnsigned(uint64_t value) {
+  uint64_t mask = width < 64 ? (uint64_t(1) << width) - 1 : ~uint64_t(0);
+  value &= mask;
+  if (isSigned && (value >> (width - 1)) == 1) {
+    value |= ~mask;
+  }
+  return value;
+}
+
+template <bool isSigned, int8_t width>
+void testConversion() {
+  using UnitType = std::conditional_t<isSigned, int64_t, uint64_t>;
+  using SecInt = Int<isSigned, width, true, 0>;
+  using SecIntBatch = Int<isSigned, width, true, 0, true>;
+  using SecArithmeticInt = ArithmeticInt<true, 0>;
+  using SecArithmeticIntBatch = ArithmeticInt<true, 0, true>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  std::vector<UnitType> intBatch;
+  std::vector<uint64_t> arithmeticBatch;
+  for (int i = 0; i < 20; i++) {
+    auto v = toUnsigned<isSigned, width>(dist(e));
+    intBatch.push_back(static_cast<UnitType>(v));
+    auto arithmeticValue = dist(e);
+    arithmeticBatch.push_back(arithmeticValue);
+
+    SecArithmeticInt converted(SecInt(static_cast<UnitType>(v), partyId));
+    EXPECT_EQ(converted.openToParty(partyId).getValue(), v);
+
+    auto convertedBack = SecArithmeticInt(arithmeticValue, partyId)
+                             .template toInt<isSigned, width>();
+    EXPECT_EQ(
+        convertedBack.openToParty(partyId).getValue(),
+        static_cast<UnitType>(toUnsigned<isSigned, width>(arithmeticValue)));
+  }
+
+  SecArithmeticIntBatch convertedBatch(SecIntBatch(intBatch, partyId));
+  auto values = convertedBatch.openToParty(partyId).getValue();
+  SecArithmeticIntBatch arithmeticInts(arithmeticBatch, partyId);
+  auto valuesBack = arithmeticInts.template toInt<isSigned, width>()
+                        .openToParty(partyId)
+                        .getValue();
+  for (size_t i = 0; i < intBatch.size(); i++) {
+    EXPECT_EQ(values.at(i), static_cast<uint64_t>(intBatch.at(i)));
+    EXPECT_EQ(
+        valuesBack.at(i),
+        static_cast<UnitType>(
+            toUnsigned<isSigned, width>(arithmeticBatch.at(i))));
+  }
+}
+
+TEST_F(ArithmeticIntTest, testConversion) {
+  testConversion<false, 1>();
+  testConversion<false, 8>();
+  testConversion<false, 32>();
+  testConversion<false, 64>();
+  testConversion<true, 1>();
+  testConversion<true, 7>();
+  testConversion<true, 32>();
+  testConversion<true, 64>();
+}
+
+} // namespace fbpcf::frontend
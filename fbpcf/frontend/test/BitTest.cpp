@@ -7,6 +7,8 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 #include "fbpcf/frontend/Bit.h"
 #include "fbpcf/frontend/test/schedulerMock.h"
@@ -488,6 +490,58 @@ TEST(BitTest, testDeallocateWires) {
   scheduler::SchedulerKeeper<0>::freeScheduler();
 }
 
+TEST(BitTest, testThreadLocalSchedulers) {
+  using SecBit = Bit<true, 0>;
+
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+  auto globalBit = std::make_unique<SecBit>(true, 0);
+
+  const int numberOfThreads = 4;
+  std::vector<std::thread> threads;
+  std::vector<bool> results(numberOfThreads);
+  std::vector<std::pair<uint64_t, uint64_t>> wireStatistics(numberOfThreads);
+  for (int i = 0; i < numberOfThreads; i++) {
+    threads.emplace_back([i, &results, &wireStatistics]() {
+      scheduler::SchedulerKeeper<0>::setThreadLocalScheduler(
+          std::make_unique<scheduler::PlaintextScheduler>(
+              scheduler::WireKeeper::createWithUnorderedMap()));
+      {
+        SecBit b1{true, 0};
+        SecBit b2{i % 2 == 0, 0};
+        for (int j = 0; j < i; j++) {
+          b1 = b1 ^ b2;
+        }
+        results[i] = (b1 & b2).openToParty(0).getValue();
+      }
+      wireStatistics[i] = scheduler::SchedulerKeeper<0>::getWireStatistics();
+      scheduler::SchedulerKeeper<0>::freeScheduler();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < numberOfThreads; i++) {
+    bool b1 = true;
+    bool b2 = i % 2 == 0;
+    for (int j = 0; j < i; j++) {
+      b1 ^= b2;
+    }
+    EXPECT_EQ(results[i], b1 & b2);
+    // every thread allocated its wires from its own scheduler
+    testPairEq(wireStatistics[i], {4 + i, 4 + i});
+  }
+
+  // the process-wide scheduler is unaffected
+  testPairEq(scheduler::SchedulerKeeper<0>::getWireStatistics(), {1, 0});
+  EXPECT_TRUE(globalBit->openToParty(0).getValue());
+
+  globalBit = nullptr;
+  scheduler::SchedulerKeeper<0>::freeScheduler();
+}
+
 TEST(BitTest, testReferenceCount) {
   auto mock = std::make_unique<schedulerMock>();
 
@@ -639,6 +693,29 @@ TEST(BitTest, testBatchingAndUnBatching) {
   scheduler::SchedulerKeeper<0>::freeScheduler();
 }
 
+TEST(BitTest, testGathering) {
+  auto mock = std::make_unique<schedulerMock>();
+
+  std::vector<bool> v(5, true);
+  int partyId = 3;
+
+  EXPECT_CALL(
+      *mock, gathering(WireIdEq(1), VectorPtrEq(std::vector<uint32_t>({4, 0}))))
+      .Times(1);
+
+  scheduler::SchedulerKeeper<0>::setScheduler(std::move(mock));
+
+  using SecBitBatch = Bit<true, 0, true>;
+
+  {
+    SecBitBatch b1(v, partyId);
+    auto b2 = b1.gathering(
+        std::make_shared<std::vector<uint32_t>>(std::vector<uint32_t>({4, 0})));
+  }
+
+  scheduler::SchedulerKeeper<0>::freeScheduler();
+}
+
 TEST(BitTest, testBatchSize) {
   scheduler::SchedulerKeeper<0>::setScheduler(
       std::make_unique<scheduler::PlaintextScheduler>(
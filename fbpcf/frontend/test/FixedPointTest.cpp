@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "fbpcf/frontend/FixedPoint.h"
+#include "fbpcf/scheduler/PlaintextScheduler.h"
+#include "fbpcf/scheduler/WireKeeper.h"
+
+namespace fbpcf::frontend {
+
+class FixedPointTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    scheduler::SchedulerKeeper<0>::setScheduler(
+        std::make_unique<scheduler::PlaintextScheduler>(
+            scheduler::WireKeeper::createWithUnorderedMap()));
+  }
+
+  void TearDown() override {
+    scheduler::SchedulerKeeper<0>::freeScheduler();
+  }
+};
+
+const int8_t kFractionalBits = 16;
+const double kPrecision = std::ldexp(1.0, -kFractionalBits);
+
+TEST_F(FixedPointTest, testInputAndOutput) {
+  using SecFixedPoint = FixedPoint<kFractionalBits, true, 0>;
+  using PubFixedPoint = FixedPoint<kFractionalBits, false, 0>;
+  using SecFixedPointBatch = FixedPoint<kFractionalBits, true, 0, true>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  int partyId = 2;
+
+  for (int i = 0; i < 10; i++) {
+    auto v = dist(e);
+    SecFixedPoint secret(v, partyId);
+    EXPECT_NEAR(secret.openToParty(partyId).getValue(), v, kPrecision);
+    PubFixedPoint publicValue(v);
+    EXPECT_NEAR(publicValue.getValue(), v, kPrecision);
+  }
+
+  std::vector<double> batch{dist(e), dist(e), dist(e)};
+  SecFixedPointBatch secretBatch(batch, partyId);
+  EXPECT_EQ(secretBatch.getBatchSize(), batch.size());
+  auto values = secretBatch.openToParty(partyId).getValue();
+  for (size_t i = 0; i < batch.size(); i++) {
+    EXPECT_NEAR(values.at(i), batch.at(i), kPrecision);
+  }
+
+  EXPECT_THROW(SecFixedPoint(1e15, partyId), std::invalid_argument);
+
+  SecFixedPoint converted(ArithmeticInt<true, 0>(uint64_t(-3), partyId));
+  EXPECT_EQ(converted.openToParty(partyId).getValue(), -3.0);
+}
+
+TEST_F(FixedPointTest, testArithmetic) {
+  using SecFixedPoint = FixedPoint<kFractionalBits, true, 0>;
+  using PubFixedPoint = FixedPoint<kFractionalBits, false, 0>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_real_distribution<double> dist(-1e3, 1e3);
+  int partyId = 2;
+
+  for (int i = 0; i < 10; i++) {
+    auto v1 = dist(e);
+    auto v2 = dist(e);
+    SecFixedPoint secret1(v1, partyId);
+    SecFixedPoint secret2(v2, partyId);
+    PubFixedPoint public2(v2);
+
+    EXPECT_NEAR(
+        (secret1 + secret2).openToParty(partyId).getValue(),
+        v1 + v2,
+        2 * kPrecision);
+    EXPECT_NEAR(
+        (secret1 - public2).openToParty(partyId).getValue(),
+        v1 - v2,
+        2 * kPrecision);
+    EXPECT_NEAR((-secret1).openToParty(partyId).getValue(), -v1, kPrecision);
+
+    // the rounding error of each operand is scaled by the other one
+    double tolerance = (std::abs(v1) + std::abs(v2) + 2) * kPrecision;
+    EXPECT_NEAR(
+        (secret1 * secret2).openToParty(partyId).getValue(),
+        v1 * v2,
+        tolerance);
+    EXPECT_NEAR(
+        (public2 * secret1).openToParty(partyId).getValue(),
+        v1 * v2,
+        tolerance);
+  }
+}
+
+TEST_F(FixedPointTest, testArithmeticBatch) {
+  using SecFixedPointBatch = FixedPoint<kFractionalBits, true, 0, true>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_real_distribution<double> dist(-1e3, 1e3);
+  int partyId = 2;
+  size_t batchSize = 9;
+
+  std::vector<double> v1(batchSize);
+  std::vector<double> v2(batchSize);
+  for (size_t i = 0; i < batchSize; i++) {
+    v1[i] = dist(e);
+    v2[i] = dist(e);
+  }
+  SecFixedPointBatch secret1(v1, partyId);
+  SecFixedPointBatch secret2(v2, partyId);
+
+  auto sum = (secret1 + secret2).openToParty(partyId).getValue();
+  auto product = (secret1 * secret2).openToParty(partyId).getValue();
+  for (size_t i = 0; i < batchSize; i++) {
+    EXPECT_NEAR(sum.at(i), v1[i] + v2[i], 2 * kPrecision);
+    EXPECT_NEAR(
+        product.at(i),
+        v1[i] * v2[i],
+        (std::abs(v1[i]) + std::abs(v2[i]) + 2) * kPrecision);
+  }
+}
+
+TEST_F(FixedPointTest, testComparison) {
+  using SecFixedPoint = FixedPoint<kFractionalBits, true, 0>;
+  using PubFixedPoint = FixedPoint<kFractionalBits, false, 0>;
+  using SecFixedPointBatch = FixedPoint<kFractionalBits, true, 0, true>;
+
+  std::vector<double> v1{-2.5, 1.25, 3.0, 100.0, -7.0};
+  std::vector<double> v2{-2.5, 1.0, 3.5, -100.0, -6.5};
+  int partyId = 2;
+
+  for (size_t i = 0; i < v1.size(); i++) {
+    SecFixedPoint secret1(v1[i], partyId);
+    SecFixedPoint secret2(v2[i], partyId);
+    PubFixedPoint public1(v1[i]);
+    PubFixedPoint public2(v2[i]);
+
+    EXPECT_EQ(
+        (secret1 < secret2).openToParty(partyId).getValue(), v1[i] < v2[i]);
+    EXPECT_EQ(
+        (secret1 <= public2).openToParty(partyId).getValue(), v1[i] <= v2[i]);
+    EXPECT_EQ(
+        (public1 > secret2).openToParty(partyId).getValue(), v1[i] > v2[i]);
+    EXPECT_EQ(
+        (secret1 >= secret2).openToParty(partyId).getValue(), v1[i] >= v2[i]);
+    EXPECT_EQ(
+        (secret1 == secret2).openToParty(partyId).getValue(), v1[i] == v2[i]);
+    EXPECT_EQ((public1 < public2).getValue(), v1[i] < v2[i]);
+    EXPECT_EQ((public1 == public2).getValue(), v1[i] == v2[i]);
+  }
+
+  SecFixedPointBatch secret1(v1, partyId);
+  SecFixedPointBatch secret2(v2, partyId);
+  auto lessThan = (secret1 < secret2).openToParty(partyId).getValue();
+  auto equal = (secret1 == secret2).openToParty(partyId).getValue();
+  for (size_t i = 0; i < v1.size(); i++) {
+    EXPECT_EQ(lessThan.at(i), v1[i] < v2[i]);
+    EXPECT_EQ(equal.at(i), v1[i] == v2[i]);
+  }
+}
+
+} // namespace fbpcf::frontend
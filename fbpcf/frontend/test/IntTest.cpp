@@ -10,6 +10,17 @@
 #include <random>
 #include <stdexcept>
 
+#include "fbpcf/frontend/TreeComparator.h"
+
+namespace fbpcf::frontend {
+
+// scheduler 1 uses the tree comparator, it is cross-checked against the
+// default ripple comparator on scheduler 0
+template <>
+struct ComparatorPolicy<1> : TreeComparatorPolicy {};
+
+} // namespace fbpcf::frontend
+
 #include "fbpcf/frontend/Int.h"
 #include "fbpcf/scheduler/PlaintextScheduler.h"
 #include "fbpcf/scheduler/WireKeeper.h"
@@ -641,6 +652,321 @@ TEST(IntTest, testSubtractBatch) {
   }
 }
 
+// Wrap around an arbitrary value the way an Int of the given width does.
+template <bool isSigned, int8_t width>
+auto wrapToWidth(uint64_t value) {
+  uint64_t mask = ~uint64_t(0);
+  if constexpr (width < 64) {
+    mask = (uint64_t(1) << width) - 1;
+  }
+  value &= mask;
+  if constexpr (isSigned) {
+    if ((value >> (width - 1)) == 1) {
+      value |= ~mask;
+    }
+    return static_cast<int64_t>(value);
+  } else {
+    return value;
+  }
+}
+
+template <bool isSigned, int8_t width>
+void testMultiplyWithWidth() {
+  using SecInt = Int<isSigned, width, true, 0>;
+  using PubInt = Int<isSigned, width, false, 0>;
+  using SecIntBatch = Int<isSigned, width, true, 0, true>;
+  using PubIntBatch = Int<isSigned, width, false, 0, true>;
+  using UnitType = std::conditional_t<isSigned, int64_t, uint64_t>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  std::vector<UnitType> batch1 = {0, 1, wrapToWidth<isSigned, width>(-1)};
+  std::vector<UnitType> batch2 = {
+      wrapToWidth<isSigned, width>(-1), 0, wrapToWidth<isSigned, width>(-1)};
+  for (int i = 0; i < 30; i++) {
+    batch1.push_back(wrapToWidth<isSigned, width>(dist(e)));
+    batch2.push_back(wrapToWidth<isSigned, width>(dist(e)));
+  }
+
+  for (size_t i = 0; i < batch1.size(); i++) {
+    auto v1 = batch1.at(i);
+    auto v2 = batch2.at(i);
+    auto product = wrapToWidth<isSigned, width>(uint64_t(v1) * uint64_t(v2));
+    SecInt secret1(v1, partyId);
+    SecInt secret2(v2, partyId);
+    PubInt public1(v1);
+    PubInt public2(v2);
+    EXPECT_EQ((secret1 * secret2).openToParty(partyId).getValue(), product);
+    EXPECT_EQ((secret1 * public2).openToParty(partyId).getValue(), product);
+    EXPECT_EQ((public1 * secret2).openToParty(partyId).getValue(), product);
+    EXPECT_EQ((public1 * public2).getValue(), product);
+  }
+
+  auto secretProducts = (SecIntBatch(batch1, partyId) *
+                         SecIntBatch(batch2, partyId))
+                            .openToParty(partyId)
+                            .getValue();
+  auto mixedProducts = (SecIntBatch(batch1, partyId) * PubIntBatch(batch2))
+                           .openToParty(partyId)
+                           .getValue();
+  for (size_t i = 0; i < batch1.size(); i++) {
+    auto product = wrapToWidth<isSigned, width>(
+        uint64_t(batch1.at(i)) * uint64_t(batch2.at(i)));
+    EXPECT_EQ(secretProducts.at(i), product);
+    EXPECT_EQ(mixedProducts.at(i), product);
+  }
+}
+
+TEST(IntTest, testMultiply) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+
+  testMultiplyWithWidth<false, 1>();
+  testMultiplyWithWidth<false, 8>();
+  testMultiplyWithWidth<false, 32>();
+  testMultiplyWithWidth<false, 64>();
+  testMultiplyWithWidth<true, 5>();
+  testMultiplyWithWidth<true, 33>();
+  testMultiplyWithWidth<true, 64>();
+}
+
+template <
+    bool isSigned,
+    int8_t width,
+    std::conditional_t<isSigned, int64_t, uint64_t> constant>
+void testMultiplyByConstantWithWidth() {
+  using SecIntBatch = Int<isSigned, width, true, 0, true>;
+  using PubInt = Int<isSigned, width, false, 0>;
+  using UnitType = std::conditional_t<isSigned, int64_t, uint64_t>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  std::vector<UnitType> values = {0, 1, wrapToWidth<isSigned, width>(-1)};
+  for (int i = 0; i < 20; i++) {
+    values.push_back(wrapToWidth<isSigned, width>(dist(e)));
+  }
+
+  auto products = SecIntBatch(values, partyId)
+                      .template multiplyByConstant<constant>()
+                      .openToParty(partyId)
+                      .getValue();
+  for (size_t i = 0; i < values.size(); i++) {
+    auto product =
+        wrapToWidth<isSigned, width>(uint64_t(values.at(i)) * constant);
+    EXPECT_EQ(products.at(i), product);
+    EXPECT_EQ(
+        PubInt(values.at(i)).template multiplyByConstant<constant>().getValue(),
+        product);
+  }
+}
+
+TEST(IntTest, testMultiplyByConstant) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+
+  testMultiplyByConstantWithWidth<false, 8, 0>();
+  testMultiplyByConstantWithWidth<false, 8, 1>();
+  testMultiplyByConstantWithWidth<false, 8, 7>();
+  testMultiplyByConstantWithWidth<false, 8, 255>();
+  testMultiplyByConstantWithWidth<false, 32, 12345>();
+  testMultiplyByConstantWithWidth<false, 64, 0xaaaaaaaaaaaaaaaa>();
+  testMultiplyByConstantWithWidth<false, 64, 0xffffffffffffffff>();
+  testMultiplyByConstantWithWidth<true, 5, -1>();
+  testMultiplyByConstantWithWidth<true, 5, 3>();
+  testMultiplyByConstantWithWidth<true, 33, -5>();
+  testMultiplyByConstantWithWidth<true, 64, 1000000007>();
+  testMultiplyByConstantWithWidth<true, 64, -0x5555555555555555>();
+}
+
+template <bool isSigned, int8_t width>
+void testDivideWithWidth() {
+  using SecInt = Int<isSigned, width, true, 0>;
+  using PubInt = Int<isSigned, width, false, 0>;
+  using SecIntBatch = Int<isSigned, width, true, 0, true>;
+  using PubIntBatch = Int<isSigned, width, false, 0, true>;
+  using UnitType = std::conditional_t<isSigned, int64_t, uint64_t>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  // C++ division, except that dividing by 0 gives all ones (or 1 for a
+  // negative dividend) and that the quotient wraps around
+  auto divide = [](UnitType v1, UnitType v2) {
+    if (v2 == 0) {
+      auto quotient = (isSigned && v1 < 0) ? UnitType(1)
+                                           : wrapToWidth<isSigned, width>(-1);
+      return std::make_pair(quotient, v1);
+    }
+    if (isSigned && v2 == UnitType(-1)) {
+      return std::make_pair(
+          wrapToWidth<isSigned, width>(0 - uint64_t(v1)), UnitType(0));
+    }
+    return std::make_pair(UnitType(v1 / v2), UnitType(v1 % v2));
+  };
+
+  auto smallest = wrapToWidth<isSigned, width>(uint64_t(1) << (width - 1));
+  auto seven = wrapToWidth<isSigned, width>(7);
+  std::vector<UnitType> batch1 = {
+      0, 1, wrapToWidth<isSigned, width>(-1), smallest, seven, seven};
+  std::vector<UnitType> batch2 = {
+      wrapToWidth<isSigned, width>(-1),
+      0,
+      wrapToWidth<isSigned, width>(-1),
+      wrapToWidth<isSigned, width>(-1),
+      0,
+      1};
+  for (int i = 0; i < 10; i++) {
+    batch1.push_back(wrapToWidth<isSigned, width>(dist(e)));
+    batch2.push_back(wrapToWidth<isSigned, width>(dist(e)));
+    // a short divisor gives a long quotient
+    batch1.push_back(wrapToWidth<isSigned, width>(dist(e)));
+    batch2.push_back(
+        wrapToWidth<isSigned, width>(dist(e) >> (64 - (width + 1) / 2)));
+  }
+
+  for (size_t i = 0; i < batch1.size(); i++) {
+    auto v1 = batch1.at(i);
+    auto v2 = batch2.at(i);
+    auto [quotient, remainder] = divide(v1, v2);
+    SecInt secret1(v1, partyId);
+    SecInt secret2(v2, partyId);
+    PubInt public1(v1);
+    PubInt public2(v2);
+    EXPECT_EQ((secret1 / secret2).openToParty(partyId).getValue(), quotient);
+    EXPECT_EQ((secret1 % secret2).openToParty(partyId).getValue(), remainder);
+    EXPECT_EQ((secret1 / public2).openToParty(partyId).getValue(), quotient);
+    EXPECT_EQ((secret1 % public2).openToParty(partyId).getValue(), remainder);
+    EXPECT_EQ((public1 / secret2).openToParty(partyId).getValue(), quotient);
+    EXPECT_EQ((public1 / public2).getValue(), quotient);
+  }
+
+  // public powers of two take the generic circuit
+  for (int8_t shift = 0; shift < width - (isSigned ? 1 : 0); shift++) {
+    auto v2 = UnitType(1) << shift;
+    auto [quotients, remainders] =
+        SecIntBatch(batch1, partyId).divideWithRemainder(
+            PubIntBatch(std::vector<UnitType>(batch1.size(), v2)));
+    auto quotientValues = quotients.openToParty(partyId).getValue();
+    auto remainderValues = remainders.openToParty(partyId).getValue();
+    for (size_t i = 0; i < batch1.size(); i++) {
+      auto [quotient, remainder] = divide(batch1.at(i), v2);
+      EXPECT_EQ(quotientValues.at(i), quotient);
+      EXPECT_EQ(remainderValues.at(i), remainder);
+    }
+  }
+
+  auto [secretQuotients, secretRemainders] =
+      SecIntBatch(batch1, partyId)
+          .divideWithRemainder(SecIntBatch(batch2, partyId));
+  auto [mixedQuotients, mixedRemainders] =
+      SecIntBatch(batch1, partyId).divideWithRemainder(PubIntBatch(batch2));
+  auto secretQuotientValues = secretQuotients.openToParty(partyId).getValue();
+  auto secretRemainderValues =
+      secretRemainders.openToParty(partyId).getValue();
+  auto mixedQuotientValues = mixedQuotients.openToParty(partyId).getValue();
+  auto mixedRemainderValues = mixedRemainders.openToParty(partyId).getValue();
+  for (size_t i = 0; i < batch1.size(); i++) {
+    auto [quotient, remainder] = divide(batch1.at(i), batch2.at(i));
+    EXPECT_EQ(secretQuotientValues.at(i), quotient);
+    EXPECT_EQ(secretRemainderValues.at(i), remainder);
+    EXPECT_EQ(mixedQuotientValues.at(i), quotient);
+    EXPECT_EQ(mixedRemainderValues.at(i), remainder);
+  }
+}
+
+TEST(IntTest, testDivide) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+
+  testDivideWithWidth<false, 1>();
+  testDivideWithWidth<false, 8>();
+  testDivideWithWidth<false, 32>();
+  testDivideWithWidth<false, 64>();
+  testDivideWithWidth<true, 2>();
+  testDivideWithWidth<true, 5>();
+  testDivideWithWidth<true, 33>();
+  testDivideWithWidth<true, 64>();
+}
+
+template <
+    bool isSigned,
+    int8_t width,
+    std::conditional_t<isSigned, int64_t, uint64_t> constant>
+void testDivideByConstantWithWidth() {
+  using SecIntBatch = Int<isSigned, width, true, 0, true>;
+  using PubInt = Int<isSigned, width, false, 0>;
+  using UnitType = std::conditional_t<isSigned, int64_t, uint64_t>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  auto smallest = wrapToWidth<isSigned, width>(uint64_t(1) << (width - 1));
+  std::vector<UnitType> values = {
+      0, 1, wrapToWidth<isSigned, width>(-1), smallest, constant};
+  for (int i = 0; i < 20; i++) {
+    values.push_back(wrapToWidth<isSigned, width>(dist(e)));
+  }
+
+  // C++ division, except that the quotient wraps around
+  auto divide = [](UnitType v1, UnitType v2) {
+    if (isSigned && v2 == UnitType(-1)) {
+      return std::make_pair(
+          wrapToWidth<isSigned, width>(0 - uint64_t(v1)), UnitType(0));
+    }
+    return std::make_pair(UnitType(v1 / v2), UnitType(v1 % v2));
+  };
+
+  auto [quotients, remainders] =
+      SecIntBatch(values, partyId).template divideByConstant<constant>();
+  auto quotientValues = quotients.openToParty(partyId).getValue();
+  auto remainderValues = remainders.openToParty(partyId).getValue();
+  for (size_t i = 0; i < values.size(); i++) {
+    auto [quotient, remainder] = divide(values.at(i), constant);
+    EXPECT_EQ(quotientValues.at(i), quotient);
+    EXPECT_EQ(remainderValues.at(i), remainder);
+    auto [publicQuotient, publicRemainder] =
+        PubInt(values.at(i)).template divideByConstant<constant>();
+    EXPECT_EQ(publicQuotient.getValue(), quotient);
+    EXPECT_EQ(publicRemainder.getValue(), remainder);
+  }
+}
+
+TEST(IntTest, testDivideByConstant) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+
+  testDivideByConstantWithWidth<false, 1, 1>();
+  testDivideByConstantWithWidth<false, 8, 1>();
+  testDivideByConstantWithWidth<false, 8, 7>();
+  testDivideByConstantWithWidth<false, 8, 16>();
+  testDivideByConstantWithWidth<false, 8, 255>();
+  testDivideByConstantWithWidth<false, 32, 12345>();
+  testDivideByConstantWithWidth<false, 64, 0x8000000000000000>();
+  testDivideByConstantWithWidth<false, 64, 0xffffffffffffffff>();
+  testDivideByConstantWithWidth<true, 2, -1>();
+  testDivideByConstantWithWidth<true, 5, -16>();
+  testDivideByConstantWithWidth<true, 5, -4>();
+  testDivideByConstantWithWidth<true, 5, 4>();
+  testDivideByConstantWithWidth<true, 33, -5>();
+  testDivideByConstantWithWidth<true, 64, 1000003>();
+  testDivideByConstantWithWidth<true, 64, 1 << 20>();
+  testDivideByConstantWithWidth<true, 64, -0x5555555555555555>();
+}
+
 TEST(IntTest, testComparison) {
   const int8_t width = 64;
 
@@ -931,6 +1257,114 @@ TEST(IntTest, testComparisonBatch) {
   }
 }
 
+// Compare the tree comparator on scheduler 1 with the ripple comparator on
+// scheduler 0 and with plaintext results.
+template <bool isSigned, int8_t width>
+void testTreeComparatorAgainstRipple() {
+  static_assert(
+      ComparatorPolicy<1>::getComparatorType(width) == ComparatorType::Tree);
+  static_assert(
+      ComparatorPolicy<0>::getComparatorType(width) == ComparatorType::Ripple);
+  using UnitType = std::conditional_t<isSigned, int64_t, uint64_t>;
+
+  UnitType largest = width == 64 ? std::numeric_limits<UnitType>::max()
+                                 : (UnitType(1) << (width - isSigned)) - 1;
+  UnitType smallest = isSigned ? -largest - 1 : 0;
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<UnitType> dist(smallest, largest);
+
+  std::vector<UnitType> values = {smallest, largest, 0, 1};
+  if constexpr (isSigned) {
+    values.push_back(-1);
+  }
+  std::vector<UnitType> batch1;
+  std::vector<UnitType> batch2;
+  for (auto v1 : values) {
+    for (auto v2 : values) {
+      batch1.push_back(v1);
+      batch2.push_back(v2);
+    }
+  }
+  for (int i = 0; i < 100; i++) {
+    batch1.push_back(dist(e));
+    // make long common prefixes likely
+    batch2.push_back(i % 2 == 0 ? dist(e) : batch1.back() ^ (i % width));
+  }
+  for (auto& v : batch2) {
+    v = std::max(smallest, std::min(largest, v));
+  }
+
+  int partyId = 2;
+  auto compare = [&](auto secret1, auto secret2, auto public2) {
+    std::vector<std::vector<bool>> rst;
+    for (auto& [r1, r2] :
+         {std::make_pair(secret1 < secret2, secret1 < public2),
+          std::make_pair(secret1 <= secret2, secret1 <= public2),
+          std::make_pair(secret1 > secret2, secret1 > public2),
+          std::make_pair(secret1 >= secret2, secret1 >= public2)}) {
+      rst.push_back(r1.openToParty(partyId).getValue());
+      rst.push_back(r2.openToParty(partyId).getValue());
+    }
+    return rst;
+  };
+
+  using TreeInt = Int<isSigned, width, true, 1, true>;
+  using PublicTreeInt = Int<isSigned, width, false, 1, true>;
+  using RippleInt = Int<isSigned, width, true, 0, true>;
+  using PublicRippleInt = Int<isSigned, width, false, 0, true>;
+  auto treeResults = compare(
+      TreeInt(batch1, partyId),
+      TreeInt(batch2, partyId),
+      PublicTreeInt(batch2));
+  auto rippleResults = compare(
+      RippleInt(batch1, partyId),
+      RippleInt(batch2, partyId),
+      PublicRippleInt(batch2));
+  EXPECT_EQ(treeResults, rippleResults);
+
+  for (size_t i = 0; i < batch1.size(); i++) {
+    bool expected[] = {
+        batch1[i] < batch2[i],
+        batch1[i] <= batch2[i],
+        batch1[i] > batch2[i],
+        batch1[i] >= batch2[i]};
+    for (size_t j = 0; j < 4; j++) {
+      EXPECT_EQ(treeResults.at(2 * j).at(i), expected[j]);
+      EXPECT_EQ(treeResults.at(2 * j + 1).at(i), expected[j]);
+    }
+
+    Int<isSigned, width, true, 1> treeInt(batch1[i], partyId);
+    Int<isSigned, width, false, 1> publicTreeInt(batch2[i]);
+    EXPECT_EQ(
+        (treeInt < publicTreeInt).openToParty(partyId).getValue(),
+        batch1[i] < batch2[i]);
+    EXPECT_EQ(
+        (Int<isSigned, width, false, 1>(batch1[i]) < publicTreeInt).getValue(),
+        batch1[i] < batch2[i]);
+  }
+}
+
+TEST(IntTest, testTreeComparator) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+  scheduler::SchedulerKeeper<1>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+
+  testTreeComparatorAgainstRipple<false, 3>();
+  testTreeComparatorAgainstRipple<false, 7>();
+  testTreeComparatorAgainstRipple<false, 32>();
+  testTreeComparatorAgainstRipple<false, 64>();
+  testTreeComparatorAgainstRipple<true, 3>();
+  testTreeComparatorAgainstRipple<true, 13>();
+  testTreeComparatorAgainstRipple<true, 32>();
+  testTreeComparatorAgainstRipple<true, 64>();
+
+  scheduler::SchedulerKeeper<1>::freeScheduler();
+}
+
 TEST(IntTest, testEqual) {
   const int8_t width = 64;
 
@@ -1388,6 +1822,104 @@ TEST(IntTest, testCastBatch) {
   }
 }
 
+WideInteger<128> toWideInteger(unsigned __int128 v) {
+  return {uint64_t(v), uint64_t(v >> 64)};
+}
+
+TEST(IntTest, testWideInt) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+  using SecInt128 = Integer<Secret<Signed<128>>, 0>;
+  using PubInt128 = Integer<Public<Signed<128>>, 0>;
+  using SecUnsignedInt256 = Int<false, 256, true, 0>;
+  using SecInt100 = Int<true, 100, true, 0>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  for (int i = 0; i < 10; i++) {
+    auto v1 = static_cast<int64_t>(dist(e));
+    auto v2 = static_cast<int64_t>(dist(e));
+    __int128 product = __int128(v1) * v2;
+
+    // a product of 64-bit integers never overflows 128 bits
+    auto secretProduct = Int<true, 64, true, 0>(v1, partyId).cast<128>() *
+        Int<true, 64, true, 0>(v2, partyId).cast<128>();
+    EXPECT_EQ(
+        secretProduct.openToParty(partyId).getValue(),
+        toWideInteger(product));
+    EXPECT_EQ(
+        (SecInt128(toWideInteger(product), partyId) +
+         PubInt128(toWideInteger(1)))
+            .openToParty(partyId)
+            .getValue(),
+        toWideInteger(product + 1));
+    EXPECT_EQ(
+        (SecInt128(toWideInteger(product), partyId) <
+         PubInt128(toWideInteger(0)))
+            .openToParty(partyId)
+            .getValue(),
+        product < 0);
+    EXPECT_EQ(
+        secretProduct.cast<64>().openToParty(partyId).getValue(),
+        static_cast<int64_t>(uint64_t(v1) * uint64_t(v2)));
+  }
+
+  // sums of 128-bit integers carry into the third word of 256-bit integers
+  SecUnsignedInt256 total(WideInteger<256>{0, 0, 0, 0}, partyId);
+  unsigned __int128 expectedLow = 0;
+  uint64_t expectedCarry = 0;
+  for (int i = 0; i < 10; i++) {
+    auto v = ((unsigned __int128)dist(e) << 64) + dist(e);
+    total = total +
+        Int<false, 128, true, 0>(toWideInteger(v), partyId).cast<256>();
+    expectedLow += v;
+    expectedCarry += expectedLow < v;
+  }
+  EXPECT_EQ(
+      total.openToParty(partyId).getValue(),
+      (WideInteger<256>{
+          uint64_t(expectedLow),
+          uint64_t(expectedLow >> 64),
+          expectedCarry,
+          0}));
+
+  // batches sign-extend when casting up
+  std::vector<WideInteger<128>> values;
+  std::vector<WideInteger<256>> extendedValues;
+  for (int i = 0; i < 10; i++) {
+    auto v = toWideInteger(((unsigned __int128)dist(e) << 64) + dist(e));
+    auto extension = static_cast<int64_t>(v[1]) < 0 ? ~uint64_t(0) : 0;
+    values.push_back(v);
+    extendedValues.push_back({v[0], v[1], extension, extension});
+  }
+  auto batch = Int<true, 128, true, 0, true>(values, partyId);
+  EXPECT_EQ(batch.openToParty(partyId).getValue(), values);
+  EXPECT_EQ(
+      batch.cast<256>().openToParty(partyId).getValue(), extendedValues);
+
+  WideInteger<256> allOnes = {~uint64_t(0), ~uint64_t(0), ~uint64_t(0), 0};
+  EXPECT_EQ(
+      (SecUnsignedInt256(allOnes, partyId) +
+       Int<false, 256, false, 0>(WideInteger<256>{1, 0, 0, 0}))
+          .openToParty(partyId)
+          .getValue(),
+      (WideInteger<256>{0, 0, 0, 1}));
+
+  // a signed width that is not a multiple of 64 is sign-extended
+  EXPECT_EQ(
+      SecInt100(WideInteger<100>{~uint64_t(0) - 4, ~uint64_t(0)}, partyId)
+          .openToParty(partyId)
+          .getValue(),
+      (WideInteger<100>{~uint64_t(0) - 4, ~uint64_t(0)}));
+  EXPECT_THROW(
+      SecInt100(WideInteger<100>{0, uint64_t(1) << 40}, partyId),
+      std::runtime_error);
+}
+
 TEST(IntTest, testMux) {
   const int8_t width = 64;
 
@@ -1740,9 +2272,9 @@ TEST(IntTest, testRebatch) {
 
   int partyId = 2;
 
-  int size1 = 5;
-  int size2 = 2;
-  int size3 = 3;
+  size_t size1 = 5;
+  size_t size2 = 2;
+  size_t size3 = 3;
 
   std::vector<int64_t> v1(size1, (int64_t(1) << (width - 1)) - 1);
   std::vector<int64_t> v2(size2, -1 - v1[0]);
@@ -2022,6 +2554,110 @@ TEST(IntTest, testAbs) {
   EXPECT_EQ(r2.getValue(), v);
 }
 
+TEST(IntTest, testPopcount) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<int> dist(0, 1);
+  int partyId = 2;
+
+  for (size_t size : {1, 2, 3, 7, 64, 100, 1000}) {
+    std::vector<bool> values(size);
+    std::vector<Bit<true, 0>> bits;
+    uint64_t expected = 0;
+    for (size_t i = 0; i < size; i++) {
+      values[i] = dist(e);
+      bits.push_back(Bit<true, 0>(values[i], partyId));
+      expected += values[i];
+    }
+
+    auto count = popcount<12>(bits);
+    EXPECT_EQ(count.openToParty(partyId).getValue(), expected);
+    auto batchCount = popcount<12>(Bit<true, 0, true>(values, partyId));
+    EXPECT_THAT(
+        batchCount.openToParty(partyId).getValue(),
+        testing::ElementsAre(expected));
+    // the count wraps around
+    auto narrowCount = popcount<3>(Bit<true, 0, true>(values, partyId));
+    EXPECT_THAT(
+        narrowCount.openToParty(partyId).getValue(),
+        testing::ElementsAre(expected % 8));
+    auto publicCount = popcount<12>(Bit<false, 0, true>(values));
+    EXPECT_THAT(publicCount.getValue(), testing::ElementsAre(expected));
+  }
+
+  // batched bits are counted at every batch index
+  std::vector<Bit<true, 0, true>> bits{
+      Bit<true, 0, true>(std::vector<bool>{1, 0, 1}, partyId),
+      Bit<true, 0, true>(std::vector<bool>{1, 0, 0}, partyId),
+      Bit<true, 0, true>(std::vector<bool>{1, 0, 1}, partyId)};
+  EXPECT_THAT(
+      popcount<2>(bits).openToParty(partyId).getValue(),
+      testing::ElementsAre(3, 0, 2));
+
+  EXPECT_THROW(
+      popcount<8>(std::vector<Bit<true, 0>>()), std::invalid_argument);
+}
+
+TEST(IntTest, testSum) {
+  scheduler::SchedulerKeeper<0>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<int64_t> dist(-128, 127);
+  int partyId = 2;
+
+  for (size_t size : {1, 2, 5, 50, 333}) {
+    std::vector<int64_t> values(size);
+    std::vector<Int<true, 8, true, 0>> integers;
+    int64_t expected = 0;
+    for (size_t i = 0; i < size; i++) {
+      values[i] = dist(e);
+      integers.push_back(Int<true, 8, true, 0>(values[i], partyId));
+      expected += values[i];
+    }
+
+    auto total = sum<20>(integers);
+    EXPECT_EQ(total.openToParty(partyId).getValue(), expected);
+    auto batchTotal = sum<20>(Int<true, 8, true, 0, true>(values, partyId));
+    EXPECT_THAT(
+        batchTotal.openToParty(partyId).getValue(),
+        testing::ElementsAre(expected));
+    // the sum wraps around
+    auto narrowTotal = sum<8>(Int<true, 8, true, 0, true>(values, partyId));
+    EXPECT_THAT(
+        narrowTotal.openToParty(partyId).getValue(),
+        testing::ElementsAre(static_cast<int8_t>(expected)));
+
+    std::vector<uint64_t> unsignedValues(size);
+    uint64_t unsignedExpected = 0;
+    for (size_t i = 0; i < size; i++) {
+      unsignedValues[i] = values[i] + 128;
+      unsignedExpected += unsignedValues[i];
+    }
+    auto unsignedTotal =
+        sum<20>(Int<false, 8, true, 0, true>(unsignedValues, partyId));
+    EXPECT_THAT(
+        unsignedTotal.openToParty(partyId).getValue(),
+        testing::ElementsAre(unsignedExpected));
+    auto publicTotal = sum<20>(Int<false, 8, false, 0, true>(unsignedValues));
+    EXPECT_THAT(
+        publicTotal.getValue(), testing::ElementsAre(unsignedExpected));
+  }
+
+  // batched integers are added up at every batch index
+  std::vector<Int<true, 8, true, 0, true>> integers{
+      Int<true, 8, true, 0, true>(std::vector<int64_t>{-128, 5}, partyId),
+      Int<true, 8, true, 0, true>(std::vector<int64_t>{-128, -7}, partyId),
+      Int<true, 8, true, 0, true>(std::vector<int64_t>{127, 3}, partyId)};
+  EXPECT_THAT(
+      sum<10>(integers).openToParty(partyId).getValue(),
+      testing::ElementsAre(-129, 1));
+}
+
 TEST(IntTest, testBatchSize) {
   const int8_t width = 15;
   scheduler::SchedulerKeeper<0>::setScheduler(
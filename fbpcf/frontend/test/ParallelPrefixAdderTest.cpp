@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "fbpcf/frontend/ParallelPrefixAdder.h"
+
+namespace fbpcf::frontend {
+
+template <>
+struct AdderPolicy<1> : FixedAdderPolicy<AdderType::Sklansky> {};
+
+template <>
+struct AdderPolicy<2> : FixedAdderPolicy<AdderType::KoggeStone> {};
+
+template <>
+struct AdderPolicy<3> : FixedAdderPolicy<AdderType::BrentKung> {};
+
+template <>
+struct AdderPolicy<4> : ParallelPrefixAdderPolicy {};
+
+} // namespace fbpcf::frontend
+
+#include "fbpcf/frontend/Int.h"
+#include "fbpcf/scheduler/PlaintextScheduler.h"
+#include "fbpcf/scheduler/WireKeeper.h"
+
+namespace fbpcf::frontend {
+
+// Check that every node of the network joins two adjacent groups, that every
+// group is updated at most once per level and that all prefixes are formed.
+// Returns the depth of the network.
+size_t testNetwork(AdderType type, size_t size) {
+  // the least significant position of the group ending at each position
+  std::vector<size_t> groupStart(size);
+  for (size_t i = 0; i < size; i++) {
+    groupStart[i] = i;
+  }
+
+  auto levels = parallel_prefix::getNetwork(type, size);
+  for (auto& level : levels) {
+    std::vector<bool> updated(size, false);
+    auto newGroupStart = groupStart;
+    for (auto& node : level) {
+      EXPECT_LT(node.from, node.to);
+      EXPECT_EQ(groupStart.at(node.to), node.from + 1);
+      EXPECT_FALSE(updated.at(node.to));
+      updated[node.to] = true;
+      newGroupStart[node.to] = groupStart.at(node.from);
+    }
+    groupStart = newGroupStart;
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    EXPECT_EQ(groupStart.at(i), 0);
+  }
+  return levels.size();
+}
+
+TEST(ParallelPrefixAdderTest, testNetworks) {
+  for (size_t size = 1; size <= 130; size++) {
+    size_t log = 0;
+    while ((size_t(1) << log) < size) {
+      log++;
+    }
+    EXPECT_EQ(testNetwork(AdderType::RippleCarry, size), size - 1);
+    EXPECT_EQ(testNetwork(AdderType::Sklansky, size), log);
+    EXPECT_EQ(testNetwork(AdderType::KoggeStone, size), log);
+    EXPECT_LE(
+        testNetwork(AdderType::BrentKung, size),
+        std::max(2 * log, size_t(1)) - 1);
+  }
+}
+
+TEST(ParallelPrefixAdderTest, testPolicies) {
+  EXPECT_EQ(AdderPolicy<0>::getAdderType(64), AdderType::RippleCarry);
+  EXPECT_EQ(AdderPolicy<1>::getAdderType(64), AdderType::Sklansky);
+  EXPECT_EQ(AdderPolicy<4>::getAdderType(4), AdderType::RippleCarry);
+  EXPECT_EQ(AdderPolicy<4>::getAdderType(64), AdderType::Sklansky);
+}
+
+// Wrap around an arbitrary value the way an Int of the given width does.
+template <bool isSigned, int8_t width>
+auto wrap(uint64_t value) {
+  uint64_t mask = ~uint64_t(0);
+  if constexpr (width < 64) {
+    mask = (uint64_t(1) << width) - 1;
+  }
+  value &= mask;
+  if constexpr (isSigned) {
+    if ((value >> (width - 1)) == 1) {
+      value |= ~mask;
+    }
+    return static_cast<int64_t>(value);
+  } else {
+    return value;
+  }
+}
+
+template <int schedulerId, bool isSigned, int8_t width>
+void testAddAndSubtract() {
+  using UnitType = std::conditional_t<isSigned, int64_t, uint64_t>;
+  using SecInt = Int<isSigned, width, true, schedulerId>;
+  using PubInt = Int<isSigned, width, false, schedulerId>;
+  using SecIntBatch = Int<isSigned, width, true, schedulerId, true>;
+
+  scheduler::SchedulerKeeper<schedulerId>::setScheduler(
+      std::make_unique<scheduler::PlaintextScheduler>(
+          scheduler::WireKeeper::createWithUnorderedMap()));
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint64_t> dist(0, ~uint64_t(0));
+  int partyId = 2;
+
+  std::vector<UnitType> batch1;
+  std::vector<UnitType> batch2;
+  for (int i = 0; i < 50; i++) {
+    auto v1 = wrap<isSigned, width>(dist(e));
+    auto v2 = wrap<isSigned, width>(dist(e));
+    batch1.push_back(v1);
+    batch2.push_back(v2);
+    auto sum = wrap<isSigned, width>(uint64_t(v1) + uint64_t(v2));
+    auto difference = wrap<isSigned, width>(uint64_t(v1) - uint64_t(v2));
+
+    SecInt secret1(v1, partyId);
+    SecInt secret2(v2, partyId);
+    PubInt public1(v1);
+    PubInt public2(v2);
+
+    EXPECT_EQ((secret1 + secret2).openToParty(partyId).getValue(), sum);
+    EXPECT_EQ((secret1 + public2).openToParty(partyId).getValue(), sum);
+    EXPECT_EQ((public1 + public2).getValue(), sum);
+    EXPECT_EQ((secret1 - secret2).openToParty(partyId).getValue(), difference);
+    EXPECT_EQ((public1 - secret2).openToParty(partyId).getValue(), difference);
+    EXPECT_EQ((public1 - public2).getValue(), difference);
+  }
+
+  SecIntBatch secretBatch1(batch1, partyId);
+  SecIntBatch secretBatch2(batch2, partyId);
+  auto sums = (secretBatch1 + secretBatch2).openToParty(partyId).getValue();
+  auto differences =
+      (secretBatch1 - secretBatch2).openToParty(partyId).getValue();
+  for (size_t i = 0; i < batch1.size(); i++) {
+    auto sum = wrap<isSigned, width>(uint64_t(batch1[i]) + uint64_t(batch2[i]));
+    auto difference =
+        wrap<isSigned, width>(uint64_t(batch1[i]) - uint64_t(batch2[i]));
+    EXPECT_EQ(sums.at(i), sum);
+    EXPECT_EQ(differences.at(i), difference);
+  }
+}
+
+template <int schedulerId>
+void testAdder() {
+  testAddAndSubtract<schedulerId, false, 2>();
+  testAddAndSubtract<schedulerId, false, 5>();
+  testAddAndSubtract<schedulerId, false, 32>();
+  testAddAndSubtract<schedulerId, false, 64>();
+  testAddAndSubtract<schedulerId, true, 7>();
+  testAddAndSubtract<schedulerId, true, 33>();
+  testAddAndSubtract<schedulerId, true, 64>();
+  scheduler::SchedulerKeeper<schedulerId>::freeScheduler();
+}
+
+TEST(ParallelPrefixAdderTest, testSklanskyAdder) {
+  testAddAndSubtract<1, false, 1>();
+  testAdder<1>();
+}
+
+TEST(ParallelPrefixAdderTest, testKoggeStoneAdder) {
+  testAdder<2>();
+}
+
+TEST(ParallelPrefixAdderTest, testBrentKungAdder) {
+  testAdder<3>();
+}
+
+TEST(ParallelPrefixAdderTest, testParallelPrefixAdderPolicy) {
+  testAdder<4>();
+}
+
+} // namespace fbpcf::frontend
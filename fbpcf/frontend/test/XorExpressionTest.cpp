@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "fbpcf/frontend/XorExpression.h"
+#include "fbpcf/scheduler/PlaintextScheduler.h"
+#include "fbpcf/scheduler/WireKeeper.h"
+
+namespace fbpcf::frontend {
+
+class XorExpressionTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    scheduler::SchedulerKeeper<0>::setScheduler(
+        std::make_unique<scheduler::PlaintextScheduler>(
+            scheduler::WireKeeper::createWithUnorderedMap()));
+  }
+
+  void TearDown() override {
+    scheduler::SchedulerKeeper<0>::freeScheduler();
+  }
+};
+
+TEST_F(XorExpressionTest, testXor) {
+  using SecBit = Bit<true, 0>;
+  using PubBit = Bit<false, 0>;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint8_t> dist(0, 1);
+  int partyId = 2;
+
+  for (int i = 0; i < 10; i++) {
+    bool v1 = dist(e);
+    bool v2 = dist(e);
+    bool v3 = dist(e);
+    bool v4 = dist(e);
+    SecBit b1(v1, partyId);
+    SecBit b2(v2, partyId);
+    PubBit b3(v3);
+    PubBit b4(v4);
+
+    SecBit rst1 = XorExpression(b1) ^ b2 ^ b3 ^ b4;
+    EXPECT_EQ(rst1.openToParty(partyId).getValue(), v1 ^ v2 ^ v3 ^ v4);
+
+    SecBit rst2 = !(b3 ^ XorExpression(b1)) ^ !XorExpression(b2);
+    EXPECT_EQ(rst2.openToParty(partyId).getValue(), v1 ^ v2 ^ v3);
+
+    PubBit rst3 = !(XorExpression(b3) ^ b4);
+    EXPECT_EQ(rst3.getValue(), !(v3 ^ v4));
+
+    XorExpression acc(b1);
+    acc ^= b1;
+    acc ^= XorExpression(b3) ^ b4;
+    EXPECT_EQ(acc.toBit().openToParty(partyId).getValue(), v3 ^ v4);
+  }
+}
+
+TEST_F(XorExpressionTest, testXorBatch) {
+  using SecBit = Bit<true, 0, true>;
+  using PubBit = Bit<false, 0, true>;
+
+  std::vector<bool> v1{true, false, true, false};
+  std::vector<bool> v2{true, true, false, false};
+  std::vector<bool> v3{false, true, true, true};
+  int partyId = 2;
+  SecBit b1(v1, partyId);
+  SecBit b2(v2, partyId);
+  PubBit b3(v3);
+
+  SecBit rst = !(XorExpression(b1) ^ b2 ^ b3);
+  EXPECT_EQ(rst.getBatchSize(), v1.size());
+  auto values = rst.openToParty(partyId).getValue();
+  for (size_t i = 0; i < v1.size(); i++) {
+    EXPECT_EQ(values.at(i), !(v1.at(i) ^ v2.at(i) ^ v3.at(i)));
+  }
+}
+
+TEST_F(XorExpressionTest, testSingleGate) {
+  using SecBit = Bit<true, 0>;
+  int partyId = 2;
+  std::vector<SecBit> bits;
+  for (int i = 0; i < 8; i++) {
+    bits.emplace_back(i % 3 == 0, partyId);
+  }
+  auto wires = scheduler::SchedulerKeeper<0>::getWireStatistics().first;
+  auto gates = scheduler::SchedulerKeeper<0>::getGateStatistics().second;
+
+  XorExpression expression(bits.at(0));
+  for (size_t i = 1; i < bits.size(); i++) {
+    expression ^= bits.at(i);
+  }
+  SecBit rst = !expression;
+  // one output wire, and one free gate per XOR and for the inversion
+  EXPECT_EQ(
+      scheduler::SchedulerKeeper<0>::getWireStatistics().first, wires + 1);
+  EXPECT_EQ(
+      scheduler::SchedulerKeeper<0>::getGateStatistics().second,
+      gates + bits.size());
+  EXPECT_EQ(rst.openToParty(partyId).getValue(), false);
+
+  // a single bit is given back as is
+  wires = scheduler::SchedulerKeeper<0>::getWireStatistics().first;
+  SecBit same = XorExpression(bits.at(0));
+  EXPECT_EQ(scheduler::SchedulerKeeper<0>::getWireStatistics().first, wires);
+}
+
+} // namespace fbpcf::frontend
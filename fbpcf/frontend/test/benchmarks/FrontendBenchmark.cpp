@@ -290,6 +290,125 @@ BENCHMARK_COUNTERS(IntSubtractBatchBenchmark, counters) {
   benchmark.runBenchmark(counters);
 }
 
+template <int schedulerId, bool usingBatch>
+class IntMultiplyGame : public IntGame<schedulerId, false, usingBatch> {
+ public:
+  explicit IntMultiplyGame(std::unique_ptr<scheduler::IScheduler> scheduler)
+      : IntGame<schedulerId, false, usingBatch>(std::move(scheduler)) {}
+
+ protected:
+  typename IntGame<schedulerId, false, usingBatch>::SecSignedInt operation(
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt b1,
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt b2)
+      override {
+    return b1 * b2;
+  }
+};
+
+BENCHMARK_COUNTERS(IntMultiplyBenchmark, counters) {
+  FrontendBenchmark<IntMultiplyGame<0, false>, IntMultiplyGame<1, false>>
+      benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+BENCHMARK_COUNTERS(IntMultiplyBatchBenchmark, counters) {
+  FrontendBenchmark<IntMultiplyGame<0, true>, IntMultiplyGame<1, true>>
+      benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+template <int schedulerId, bool usingBatch>
+class IntMultiplyByConstantGame
+    : public IntGame<schedulerId, false, usingBatch> {
+ public:
+  explicit IntMultiplyByConstantGame(
+      std::unique_ptr<scheduler::IScheduler> scheduler)
+      : IntGame<schedulerId, false, usingBatch>(std::move(scheduler)) {}
+
+ protected:
+  typename IntGame<schedulerId, false, usingBatch>::SecSignedInt operation(
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt b1,
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt /* b2 */)
+      override {
+    return b1.template multiplyByConstant<1000003>();
+  }
+};
+
+BENCHMARK_COUNTERS(IntMultiplyByConstantBenchmark, counters) {
+  FrontendBenchmark<
+      IntMultiplyByConstantGame<0, false>,
+      IntMultiplyByConstantGame<1, false>>
+      benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+BENCHMARK_COUNTERS(IntMultiplyByConstantBatchBenchmark, counters) {
+  FrontendBenchmark<
+      IntMultiplyByConstantGame<0, true>,
+      IntMultiplyByConstantGame<1, true>>
+      benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+template <int schedulerId, bool usingBatch>
+class IntDivideGame : public IntGame<schedulerId, false, usingBatch> {
+ public:
+  explicit IntDivideGame(std::unique_ptr<scheduler::IScheduler> scheduler)
+      : IntGame<schedulerId, false, usingBatch>(std::move(scheduler)) {}
+
+ protected:
+  typename IntGame<schedulerId, false, usingBatch>::SecSignedInt operation(
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt b1,
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt b2)
+      override {
+    return b1 / b2;
+  }
+};
+
+BENCHMARK_COUNTERS(IntDivideBenchmark, counters) {
+  FrontendBenchmark<IntDivideGame<0, false>, IntDivideGame<1, false>>
+      benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+BENCHMARK_COUNTERS(IntDivideBatchBenchmark, counters) {
+  FrontendBenchmark<IntDivideGame<0, true>, IntDivideGame<1, true>> benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+template <int schedulerId, bool usingBatch>
+class IntDivideByConstantGame
+    : public IntGame<schedulerId, false, usingBatch> {
+ public:
+  explicit IntDivideByConstantGame(
+      std::unique_ptr<scheduler::IScheduler> scheduler)
+      : IntGame<schedulerId, false, usingBatch>(std::move(scheduler)) {}
+
+ protected:
+  typename IntGame<schedulerId, false, usingBatch>::SecSignedInt operation(
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt b1,
+      typename IntGame<schedulerId, false, usingBatch>::SecSignedInt /* b2 */)
+      override {
+    return b1.template divideByConstant<1000003>().first;
+  }
+};
+
+BENCHMARK_COUNTERS(IntDivideByConstantBenchmark, counters) {
+  FrontendBenchmark<
+      IntDivideByConstantGame<0, false>,
+      IntDivideByConstantGame<1, false>>
+      benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+BENCHMARK_COUNTERS(IntDivideByConstantBatchBenchmark, counters) {
+  FrontendBenchmark<
+      IntDivideByConstantGame<0, true>,
+      IntDivideByConstantGame<1, true>>
+      benchmark;
+  benchmark.runBenchmark(counters);
+}
+
 template <int schedulerId, bool usingBatch>
 class IntMuxGame : public IntGame<schedulerId, false, usingBatch> {
  public:
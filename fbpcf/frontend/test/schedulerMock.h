@@ -130,6 +130,16 @@ class schedulerMock final : public scheduler::IScheduler {
           return WireId<IScheduler::Boolean>(wireId++);
         }));
 
+    ON_CALL(*this, multiXor(_, _, _))
+        .WillByDefault(Invoke([this](auto, auto, auto) {
+          return WireId<IScheduler::Boolean>(wireId++);
+        }));
+
+    ON_CALL(*this, multiXorBatch(_, _, _))
+        .WillByDefault(Invoke([this](auto, auto, auto) {
+          return WireId<IScheduler::Boolean>(wireId++);
+        }));
+
     ON_CALL(*this, batchingUp(_)).WillByDefault(Invoke([this](auto) {
       return WireId<IScheduler::Boolean>(wireId++);
     }));
@@ -142,6 +152,10 @@ class schedulerMock final : public scheduler::IScheduler {
           }
           return rst;
         }));
+
+    ON_CALL(*this, gathering(_, _)).WillByDefault(Invoke([this](auto, auto) {
+      return WireId<IScheduler::Boolean>(wireId++);
+    }));
   }
 
   //======== Below are input processing APIs: ========
@@ -301,6 +315,20 @@ class schedulerMock final : public scheduler::IScheduler {
           WireId<IScheduler::Boolean>,
           WireId<IScheduler::Boolean>));
 
+  MOCK_METHOD3(
+      multiXor,
+      WireId<IScheduler::Boolean>(
+          const std::vector<WireId<IScheduler::Boolean>>&,
+          const std::vector<WireId<IScheduler::Boolean>>&,
+          bool));
+
+  MOCK_METHOD3(
+      multiXorBatch,
+      WireId<IScheduler::Boolean>(
+          const std::vector<WireId<IScheduler::Boolean>>&,
+          const std::vector<WireId<IScheduler::Boolean>>&,
+          bool));
+
   // ------ Not gates ------
 
   MOCK_METHOD1(
@@ -337,6 +365,10 @@ class schedulerMock final : public scheduler::IScheduler {
           WireId<Boolean>,
           std::shared_ptr<std::vector<uint32_t>>));
 
+  MOCK_METHOD2(
+      gathering,
+      WireId<Boolean>(WireId<Boolean>, std::shared_ptr<std::vector<uint32_t>>));
+
   MOCK_METHOD0(deleteEngine, void());
 
   std::pair<uint64_t, uint64_t> getTrafficStatistics() const override {
@@ -14,8 +14,8 @@ namespace fbpcf::mpc_std_lib::compactor {
  * labels to select all 1s items. If it is allowed to reveal the number of 1s
  * items, r, our compaction outputs compactified items of size r. Otherwise, it
  * just runs a compaction algorithm and returns
- * the resulting compactified items of size n (same as the input size) without
- * discarding any items.
+ * the resulting compactified items of size n (same as the input size), in
+ * which the 1s items come first and all other items are labeled 0.
  */
 /**
  * A type T corresponds to a set of values (i.e., a batch) to be
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "fbpcf/mpc_std_lib/compactor/ICompactor.h"
+#include "fbpcf/mpc_std_lib/util/util.h"
+
+namespace fbpcf::mpc_std_lib::compactor {
+
+/*
+ * This compactor runs an order-preserving compaction network (Goodrich,
+ * SPAA'11) and does not need to reveal anything. Every item labeled 1 moves
+ * towards the front by the number of items labeled 0 before it. These
+ * distances are computed by a work-efficient prefix count, and the items then
+ * move in log(n) rounds, by 2^j in round j if bit j of their distance is set.
+ * Items never collide in this network, so each round is a single oblivious
+ * selection between every item and the item 2^j positions behind it,
+ * evaluated on the whole batch at once. For n items, the selections cost
+ * O(n log n) AND gates per bit of payload. The higher distance bits of an item
+ * move along with it, which costs another O(n log^2 n) AND gates in total.
+ * The items labeled 1 end up in front in their original order. The rest of
+ * the output is labeled 0 and does not retain the items labeled 0. If it is
+ * okay to reveal the number of items labeled 1, the output is truncated to
+ * them.
+ */
+
+/*
+ * We assume that there are two parties. In our implementation, a party with a
+ * smaller id is assigned to party0 and the other party is assigned to party1.
+ */
+template <typename T, int schedulerId>
+class NetworkBasedCompactor final
+    : public ICompactor<
+          typename util::SecBatchType<T, schedulerId>::type,
+          typename util::SecBatchType<bool, schedulerId>::type> {
+  using SecBit = frontend::Bit<true, schedulerId, true>;
+
+ public:
+  using SecBatchSrcType = typename util::SecBatchType<T, schedulerId>::type;
+  using SecBatchLabelType =
+      typename util::SecBatchType<bool, schedulerId>::type;
+
+  NetworkBasedCompactor(int myId, int partnerId)
+      : myId_(myId), partnerId_(partnerId) {}
+
+  std::pair<SecBatchSrcType, SecBatchLabelType> compaction(
+      const SecBatchSrcType& src,
+      const SecBatchLabelType& label,
+      uint32_t size,
+      bool shouldRevealSize) const override {
+    if (label.getBatchSize() != size) {
+      throw std::invalid_argument("label size does not match");
+    }
+    auto distance = countUnselectedBefore(label, size);
+
+    auto rstSrc = src;
+    auto rstLabel = label;
+    for (size_t j = 0; j < distance.size(); j++) {
+      uint32_t shift = 1 << j;
+      auto moving = rstLabel & distance.at(j);
+      // whether the item shift positions behind moves here
+      auto arriving = shiftForward(moving, shift, size);
+
+      auto pieces = util::MpcAdapters<T, schedulerId>::unbatching(
+          rstSrc,
+          std::make_shared<std::vector<uint32_t>>(
+              std::vector<uint32_t>{shift, size - shift}));
+      auto shiftedSrc = util::MpcAdapters<T, schedulerId>::batchingWith(
+          pieces.at(1), {pieces.at(0)});
+      rstSrc = util::MpcAdapters<T, schedulerId>::obliviousSwap(
+                   rstSrc, shiftedSrc, arriving)
+                   .first;
+      // moving is a subset of the items labeled 1, and no item arrives at a
+      // position whose item stays.
+      rstLabel = rstLabel ^ moving ^ arriving;
+
+      for (size_t k = j + 1; k < distance.size(); k++) {
+        distance[k] = distance.at(k) ^
+            (arriving &
+             (distance.at(k) ^ shiftForward(distance.at(k), shift, size)));
+      }
+    }
+
+    if (!shouldRevealSize) {
+      return {rstSrc, rstLabel};
+    }
+    return truncate(rstSrc, rstLabel, size);
+  }
+
+ private:
+  // Compute the number of items labeled 0 before each item, as bits from the
+  // least significant one. This is a Blelloch scan: the up-sweep sums up the
+  // counts of blocks of 2^k items, and the down-sweep hands the count before
+  // each block down to its two halves. Each level is one adder on a batch
+  // holding all blocks of that level.
+  std::vector<SecBit> countUnselectedBefore(
+      const SecBatchLabelType& label,
+      uint32_t size) const {
+    size_t depth = 0;
+    while ((size_t(1) << depth) < size) {
+      depth++;
+    }
+    auto unselected = (!label).extractBit().getValue();
+    unselected.resize(size_t(1) << depth, false);
+
+    // blockCounts[k] holds the counts of all blocks of 2^k items
+    std::vector<std::vector<SecBit>> blockCounts{
+        {SecBit(typename SecBit::ExtractedBit(unselected))}};
+    for (size_t k = 0; k < depth; k++) {
+      auto [left, right] = deinterleave(blockCounts.back());
+      blockCounts.push_back(add(left, right, k + 2));
+    }
+
+    // Counts before any item are smaller than 2^depth.
+    std::vector<SecBit> before(
+        depth, SecBit(typename SecBit::ExtractedBit(std::vector<bool>(1))));
+    for (size_t k = depth; k > 0; k--) {
+      auto leftCount = deinterleave(blockCounts.at(k - 1)).first;
+      auto rightBefore = add(before, leftCount, depth);
+      before = interleave(before, rightBefore);
+    }
+
+    for (auto& bit : before) {
+      auto shares = bit.extractBit().getValue();
+      shares.resize(size);
+      bit = SecBit(typename SecBit::ExtractedBit(shares));
+    }
+    return before;
+  }
+
+  // Add two numbers given as bits from the least significant one, and keep
+  // the lowest width bits of the sum.
+  static std::vector<SecBit> add(
+      const std::vector<SecBit>& a,
+      const std::vector<SecBit>& b,
+      size_t width) {
+    std::vector<SecBit> rst(width);
+    SecBit carry;
+    bool hasCarry = false;
+    for (size_t i = 0; i < width; i++) {
+      bool hasA = i < a.size();
+      bool hasB = i < b.size();
+      if (hasA && hasB) {
+        rst[i] = hasCarry ? a.at(i) ^ b.at(i) ^ carry : a.at(i) ^ b.at(i);
+        if (i + 1 < width) {
+          carry = hasCarry ? ((a.at(i) ^ carry) & (b.at(i) ^ carry)) ^ carry
+                           : a.at(i) & b.at(i);
+          hasCarry = true;
+        }
+      } else if (hasA || hasB) {
+        auto& bit = hasA ? a.at(i) : b.at(i);
+        rst[i] = hasCarry ? bit ^ carry : bit;
+        if (hasCarry && i + 1 < width) {
+          carry = bit & carry;
+        }
+      } else if (hasCarry) {
+        rst[i] = carry;
+        hasCarry = false;
+      } else {
+        rst[i] = SecBit(typename SecBit::ExtractedBit(
+            std::vector<bool>(rst.at(0).getBatchSize())));
+      }
+    }
+    return rst;
+  }
+
+  // Split the batch of every bit into the elements at even and odd positions.
+  // This only rearranges the shares of each party.
+  static std::pair<std::vector<SecBit>, std::vector<SecBit>> deinterleave(
+      const std::vector<SecBit>& src) {
+    std::vector<SecBit> even(src.size());
+    std::vector<SecBit> odd(src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+      auto shares = src.at(i).extractBit().getValue();
+      std::vector<bool> evenShares(shares.size() / 2);
+      std::vector<bool> oddShares(shares.size() / 2);
+      for (size_t j = 0; j < evenShares.size(); j++) {
+        evenShares[j] = shares.at(2 * j);
+        oddShares[j] = shares.at(2 * j + 1);
+      }
+      even[i] = SecBit(typename SecBit::ExtractedBit(evenShares));
+      odd[i] = SecBit(typename SecBit::ExtractedBit(oddShares));
+    }
+    return {even, odd};
+  }
+
+  static std::vector<SecBit> interleave(
+      const std::vector<SecBit>& even,
+      const std::vector<SecBit>& odd) {
+    std::vector<SecBit> rst(even.size());
+    for (size_t i = 0; i < even.size(); i++) {
+      auto evenShares = even.at(i).extractBit().getValue();
+      auto oddShares = odd.at(i).extractBit().getValue();
+      std::vector<bool> shares(evenShares.size() * 2);
+      for (size_t j = 0; j < evenShares.size(); j++) {
+        shares[2 * j] = evenShares.at(j);
+        shares[2 * j + 1] = oddShares.at(j);
+      }
+      rst[i] = SecBit(typename SecBit::ExtractedBit(shares));
+    }
+    return rst;
+  }
+
+  // Move the element at position i + shift to position i, and fill the last
+  // shift positions with 0.
+  static SecBit shiftForward(const SecBit& src, uint32_t shift, uint32_t size) {
+    auto shares = src.extractBit().getValue();
+    std::vector<bool> rst(size, false);
+    std::copy(shares.begin() + shift, shares.end(), rst.begin());
+    return SecBit(typename SecBit::ExtractedBit(rst));
+  }
+
+  // The output labels are 1 for exactly the selected items, so opening them
+  // only reveals how many items are selected.
+  std::pair<SecBatchSrcType, SecBatchLabelType> truncate(
+      const SecBatchSrcType& src,
+      const SecBatchLabelType& label,
+      uint32_t size) const {
+    auto party0 =
+        (myId_ < partnerId_) ? myId_ : partnerId_; // a party with a smaller id
+    auto party1 =
+        (myId_ < partnerId_) ? partnerId_ : myId_; // a party with a larger id
+
+    auto revealedLabel0 = util::MpcAdapters<bool, schedulerId>::openToParty(
+        label, party0); // reveal to party0
+    auto revealedLabel1 = util::MpcAdapters<bool, schedulerId>::openToParty(
+        label, party1); // reveal to party1
+    auto plaintextLabel = (myId_ == party0) ? revealedLabel0 : revealedLabel1;
+    uint32_t outputSize =
+        std::count(plaintextLabel.begin(), plaintextLabel.end(), true);
+
+    if (outputSize == 0) {
+      throw std::runtime_error("No item is selected.");
+    }
+    if (outputSize == size) {
+      return {src, label};
+    }
+    auto unbatchSize = std::make_shared<std::vector<uint32_t>>(
+        std::vector<uint32_t>{outputSize, size - outputSize});
+    return {
+        util::MpcAdapters<T, schedulerId>::unbatching(src, unbatchSize).at(0),
+        util::MpcAdapters<bool, schedulerId>::unbatching(label, unbatchSize)
+            .at(0)};
+  }
+
+  int myId_;
+  int partnerId_;
+};
+
+} // namespace fbpcf::mpc_std_lib::compactor
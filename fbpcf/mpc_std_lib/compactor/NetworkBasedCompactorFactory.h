@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "fbpcf/mpc_std_lib/compactor/ICompactorFactory.h"
+#include "fbpcf/mpc_std_lib/compactor/NetworkBasedCompactor.h"
+
+namespace fbpcf::mpc_std_lib::compactor {
+
+template <typename T, int schedulerId>
+class NetworkBasedCompactorFactory final
+    : public ICompactorFactory<
+          typename util::SecBatchType<T, schedulerId>::type,
+          typename util::SecBatchType<bool, schedulerId>::type> {
+ public:
+  using SecBatchSrcType = typename util::SecBatchType<T, schedulerId>::type;
+  using SecBatchLabelType =
+      typename util::SecBatchType<bool, schedulerId>::type;
+  NetworkBasedCompactorFactory(int myId, int partnerId)
+      : myId_(myId), partnerId_(partnerId) {}
+
+  std::unique_ptr<ICompactor<SecBatchSrcType, SecBatchLabelType>> create()
+      override {
+    return std::make_unique<NetworkBasedCompactor<T, schedulerId>>(
+        myId_, partnerId_);
+  }
+
+ private:
+  int myId_;
+  int partnerId_;
+};
+
+} // namespace fbpcf::mpc_std_lib::compactor
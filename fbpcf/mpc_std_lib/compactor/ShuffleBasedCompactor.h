@@ -67,37 +67,18 @@ class ShuffleBasedCompactor final
         shuffledLabel, party1); // reveal to party1
     auto plaintextLabel = (myId_ == party0) ? revealedLabel0 : revealedLabel1;
 
-    // unbatch the batch type shuffledSrc and shuffledLabel into a vector format
-    // to select elements that are labeled as 1.
-    auto unbatchSize = std::make_shared<std::vector<uint32_t>>(size);
-    for (size_t i = 0; i < size; i++) {
-      (*unbatchSize)[i] = 1;
-    }
-    auto shuffledSrcBatches = util::MpcAdapters<T, schedulerId>::unbatching(
-        shuffledSrc, unbatchSize); // unbatch
-    auto shuffledLabelBatches =
-        util::MpcAdapters<LabelT, schedulerId>::unbatching(
-            shuffledLabel, unbatchSize); // unbatch
-
-    // select all 1s items.
-    std::vector<SecBatchSrcType> compactifiedSrc;
-    std::vector<SecBatchLabelType> compactifiedLabel;
-    for (size_t i = 0; i < size; i++) {
+    // gather all 1s items in one rebatching gate.
+    auto indexes = std::make_shared<std::vector<uint32_t>>();
+    for (uint32_t i = 0; i < size; i++) {
       if (plaintextLabel.at(i)) {
-        compactifiedSrc.push_back(shuffledSrcBatches.at(i));
-        compactifiedLabel.push_back(shuffledLabelBatches.at(i));
+        indexes->push_back(i);
       }
     }
 
-    // rebatch
-    auto rstLabel = util::MpcAdapters<LabelT, schedulerId>::batchingWith(
-        compactifiedLabel.at(0),
-        std::vector<SecBatchLabelType>(
-            compactifiedLabel.begin() + 1, compactifiedLabel.end()));
-    auto rstSrc = util::MpcAdapters<T, schedulerId>::batchingWith(
-        compactifiedSrc.at(0),
-        std::vector<SecBatchSrcType>(
-            compactifiedSrc.begin() + 1, compactifiedSrc.end()));
+    auto rstSrc =
+        util::MpcAdapters<T, schedulerId>::gathering(shuffledSrc, indexes);
+    auto rstLabel = util::MpcAdapters<LabelT, schedulerId>::gathering(
+        shuffledLabel, indexes);
     return {rstSrc, rstLabel};
   }
 
@@ -21,6 +21,7 @@
 #include "fbpcf/mpc_std_lib/compactor/DummyCompactorFactory.h"
 #include "fbpcf/mpc_std_lib/compactor/ICompactor.h"
 #include "fbpcf/mpc_std_lib/compactor/ICompactorFactory.h"
+#include "fbpcf/mpc_std_lib/compactor/NetworkBasedCompactorFactory.h"
 #include "fbpcf/mpc_std_lib/compactor/ShuffleBasedCompactor.h"
 #include "fbpcf/mpc_std_lib/compactor/ShuffleBasedCompactorFactory.h"
 #include "fbpcf/mpc_std_lib/permuter/AsWaksmanPermuterFactory.h"
@@ -92,15 +93,14 @@ void compactorTest(
         typename util::SecBatchType<bool, 0>::type>& compactorFactory0,
     ICompactorFactory<
         typename util::SecBatchType<T, 1>::type,
-        typename util::SecBatchType<bool, 1>::type>& compactorFactory1) {
+        typename util::SecBatchType<bool, 1>::type>& compactorFactory1,
+    bool shouldRevealSize = true,
+    uint32_t batchSize = 11) {
   auto agentFactories = engine::communication::getInMemoryAgentFactory(2);
   setupRealBackend<0, 1>(*agentFactories[0], *agentFactories[1]);
   auto compactor0 = compactorFactory0.create();
   auto compactor1 = compactorFactory1.create();
 
-  uint32_t batchSize = 11;
-  bool shouldRevealSize = true;
-
   // Generate test data
   auto [testData, testLabel, expectedData] = generateData(batchSize);
   size_t expectedOutputSize = expectedData.size();
@@ -121,6 +121,21 @@ void compactorTest(
       shouldRevealSize);
   auto [rstData0, rstLabel0] = future0.get();
 
+  if (!shouldRevealSize) {
+    // the selected items come first and the rest is labeled 0
+    ASSERT_EQ(rstLabel0.size(), batchSize);
+    ASSERT_EQ(rstData0.size(), batchSize);
+    for (size_t j = 0; j < batchSize; j++) {
+      ASSERT_EQ(rstLabel0.at(j), j < expectedOutputSize);
+    }
+    rstLabel0.resize(expectedOutputSize);
+    rstData0.resize(expectedOutputSize);
+    // and keep their order
+    for (size_t j = 0; j < expectedOutputSize; j++) {
+      ASSERT_EQ(rstData0.at(j).first, expectedData.at(j).first);
+    }
+  }
+
   ASSERT_EQ(rstLabel0.size(), expectedOutputSize);
   testVectorEq(rstLabel0, std::vector<bool>(expectedOutputSize, true));
   ASSERT_EQ(rstData0.size(), expectedOutputSize);
@@ -185,4 +200,18 @@ TEST(compactorTest, testShuffleBasedCompactor) {
   compactorTest<AttributionValue>(factory0, factory1);
 }
 
+TEST(compactorTest, testNetworkBasedCompactor) {
+  NetworkBasedCompactorFactory<AttributionValue, 0> factory0(0, 1);
+  NetworkBasedCompactorFactory<AttributionValue, 1> factory1(1, 0);
+  compactorTest<AttributionValue>(factory0, factory1);
+}
+
+TEST(compactorTest, testNetworkBasedCompactorWithoutRevealingSize) {
+  NetworkBasedCompactorFactory<AttributionValue, 0> factory0(0, 1);
+  NetworkBasedCompactorFactory<AttributionValue, 1> factory1(1, 0);
+  for (uint32_t batchSize : {1, 2, 11, 64, 100}) {
+    compactorTest<AttributionValue>(factory0, factory1, false, batchSize);
+  }
+}
+
 } // namespace fbpcf::mpc_std_lib::compactor
@@ -16,6 +16,7 @@
 #include "fbpcf/mpc_std_lib/compactor/DummyCompactorFactory.h"
 #include "fbpcf/mpc_std_lib/compactor/ICompactor.h"
 #include "fbpcf/mpc_std_lib/compactor/ICompactorFactory.h"
+#include "fbpcf/mpc_std_lib/compactor/NetworkBasedCompactorFactory.h"
 #include "fbpcf/mpc_std_lib/compactor/ShuffleBasedCompactor.h"
 #include "fbpcf/mpc_std_lib/compactor/ShuffleBasedCompactorFactory.h"
 #include "fbpcf/mpc_std_lib/permuter/AsWaksmanPermuterFactory.h"
@@ -28,8 +29,11 @@ namespace fbpcf::mpc_std_lib::compactor {
 
 const uint32_t batchSize = 1000;
 
-class ShuffleBasedCompactorBenchmark : public engine::util::NetworkedBenchmark {
+class BaseCompactorBenchmark : public engine::util::NetworkedBenchmark {
  public:
+  explicit BaseCompactorBenchmark(bool shouldRevealSize)
+      : shouldRevealSize_(shouldRevealSize) {}
+
   void setup() override {
     auto [agentFactory0, agentFactory1] =
         engine::util::getSocketAgentFactories();
@@ -44,35 +48,12 @@ class ShuffleBasedCompactorBenchmark : public engine::util::NetworkedBenchmark {
     value_ = value;
     label_ = label;
 
-    factory0_ =
-        std::make_unique<ShuffleBasedCompactorFactory<uint32_t, bool, 0>>(
-            0,
-            1,
-            std::make_unique<shuffler::PermuteBasedShufflerFactory<std::pair<
-                frontend::Int<false, 32, true, 0, true>,
-                frontend::Bit<true, 0, true>>>>(
-                0,
-                1,
-                std::make_unique<permuter::AsWaksmanPermuterFactory<
-                    std::pair<uint32_t, bool>,
-                    0>>(0, 1),
-                std::make_unique<engine::util::AesPrgFactory>()));
-    factory1_ =
-        std::make_unique<ShuffleBasedCompactorFactory<uint32_t, bool, 1>>(
-            1,
-            0,
-            std::make_unique<shuffler::PermuteBasedShufflerFactory<std::pair<
-                frontend::Int<false, 32, true, 1, true>,
-                frontend::Bit<true, 1, true>>>>(
-                1,
-                0,
-                std::make_unique<permuter::AsWaksmanPermuterFactory<
-                    std::pair<uint32_t, bool>,
-                    1>>(1, 0),
-                std::make_unique<engine::util::AesPrgFactory>()));
+    setupFactories();
   }
 
  protected:
+  virtual void setupFactories() = 0;
+
   void initSender() override {
     scheduler::SchedulerKeeper<0>::setScheduler(
         scheduler::getLazySchedulerFactoryWithRealEngine(0, *agentFactory0_)
@@ -86,7 +67,8 @@ class ShuffleBasedCompactorBenchmark : public engine::util::NetworkedBenchmark {
     auto secLabel = util::MpcAdapters<bool, 0>::processSecretInputs(label_, 0);
 
     auto [compactifiedValue, compactifiedLabel] =
-        compactor0_->compaction(secValue, secLabel, batchSize, true);
+        compactor0_->compaction(
+            secValue, secLabel, batchSize, shouldRevealSize_);
 
     auto rstLabel =
         util::MpcAdapters<bool, 0>::openToParty(compactifiedLabel, 0);
@@ -107,7 +89,8 @@ class ShuffleBasedCompactorBenchmark : public engine::util::NetworkedBenchmark {
     auto secLabel = util::MpcAdapters<bool, 1>::processSecretInputs(label_, 0);
 
     auto [compactifiedValue, compactifiedLabel] =
-        compactor1_->compaction(secValue, secLabel, batchSize, true);
+        compactor1_->compaction(
+            secValue, secLabel, batchSize, shouldRevealSize_);
 
     auto rstLabel =
         util::MpcAdapters<bool, 1>::openToParty(compactifiedLabel, 0);
@@ -147,12 +130,74 @@ class ShuffleBasedCompactorBenchmark : public engine::util::NetworkedBenchmark {
 
   std::vector<uint32_t> value_;
   std::vector<bool> label_;
+  bool shouldRevealSize_;
+};
+
+class ShuffleBasedCompactorBenchmark : public BaseCompactorBenchmark {
+ public:
+  ShuffleBasedCompactorBenchmark() : BaseCompactorBenchmark(true) {}
+
+ protected:
+  void setupFactories() override {
+    factory0_ =
+        std::make_unique<ShuffleBasedCompactorFactory<uint32_t, bool, 0>>(
+            0,
+            1,
+            std::make_unique<shuffler::PermuteBasedShufflerFactory<std::pair<
+                frontend::Int<false, 32, true, 0, true>,
+                frontend::Bit<true, 0, true>>>>(
+                0,
+                1,
+                std::make_unique<permuter::AsWaksmanPermuterFactory<
+                    std::pair<uint32_t, bool>,
+                    0>>(0, 1),
+                std::make_unique<engine::util::AesPrgFactory>()));
+    factory1_ =
+        std::make_unique<ShuffleBasedCompactorFactory<uint32_t, bool, 1>>(
+            1,
+            0,
+            std::make_unique<shuffler::PermuteBasedShufflerFactory<std::pair<
+                frontend::Int<false, 32, true, 1, true>,
+                frontend::Bit<true, 1, true>>>>(
+                1,
+                0,
+                std::make_unique<permuter::AsWaksmanPermuterFactory<
+                    std::pair<uint32_t, bool>,
+                    1>>(1, 0),
+                std::make_unique<engine::util::AesPrgFactory>()));
+  }
 };
 
 BENCHMARK_COUNTERS(ShuffleBasedCompactor_Benchmark, counters) {
   ShuffleBasedCompactorBenchmark benchmark;
   benchmark.runBenchmark(counters);
 }
+
+class NetworkBasedCompactorBenchmark : public BaseCompactorBenchmark {
+ public:
+  explicit NetworkBasedCompactorBenchmark(bool shouldRevealSize)
+      : BaseCompactorBenchmark(shouldRevealSize) {}
+
+ protected:
+  void setupFactories() override {
+    factory0_ =
+        std::make_unique<NetworkBasedCompactorFactory<uint32_t, 0>>(0, 1);
+    factory1_ =
+        std::make_unique<NetworkBasedCompactorFactory<uint32_t, 1>>(1, 0);
+  }
+};
+
+BENCHMARK_COUNTERS(NetworkBasedCompactor_Benchmark, counters) {
+  NetworkBasedCompactorBenchmark benchmark(true);
+  benchmark.runBenchmark(counters);
+}
+
+BENCHMARK_COUNTERS(
+    NetworkBasedCompactorWithoutRevealingSize_Benchmark,
+    counters) {
+  NetworkBasedCompactorBenchmark benchmark(false);
+  benchmark.runBenchmark(counters);
+}
 } // namespace fbpcf::mpc_std_lib::compactor
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "fbpcf/mpc_std_lib/oram/DpfSinglePointArrayGenerator.h"
+#include <algorithm>
+#include <stdexcept>
+#include "fbpcf/engine/util/util.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+std::vector<std::pair<std::vector<bool>, std::vector<__m128i>>>
+DpfSinglePointArrayGenerator::generateSinglePointArrays(
+    const std::vector<std::vector<bool>>& indexShares,
+    size_t length) {
+  auto width = indexShares.size();
+  if (width == 0) {
+    throw std::invalid_argument("Empty input!");
+  }
+  if (width >= 64) {
+    // width can not be larger than 63, otherwise 2^width will overflow.
+    throw std::invalid_argument("Width is too large!");
+  }
+  if (length > ((uint64_t)1 << width)) {
+    throw std::invalid_argument("Width is too small!");
+  }
+
+  size_t batchSize = indexShares.at(0).size();
+  if (batchSize == 0) {
+    throw std::invalid_argument("Empty input!");
+  }
+  for (auto& item : indexShares) {
+    if (item.size() != batchSize) {
+      throw std::invalid_argument("Inconsistent size.");
+    }
+  }
+
+  if (width != keyWidth_) {
+    keys_.clear();
+  }
+  if (keys_.size() < batchSize) {
+    generateKeys(width, std::max(keyPoolSize_, batchSize - keys_.size()));
+  }
+
+  // open the offsets between the indexes and the points of the keys
+  std::vector<bool> maskedShares(batchSize * width);
+  for (size_t i = 0; i < batchSize; i++) {
+    for (size_t j = 0; j < width; j++) {
+      maskedShares[i * width + j] =
+          indexShares.at(j).at(i) ^ keys_.at(i).pointShare.at(j);
+    }
+  }
+  agent_->sendBool(maskedShares);
+  auto otherMaskedShares = agent_->receiveBool(maskedShares.size());
+  if (otherMaskedShares.size() != maskedShares.size()) {
+    throw std::runtime_error("unexpected size!");
+  }
+
+  ArrayType rst(batchSize);
+  for (size_t i = 0; i < batchSize; i++) {
+    uint64_t offset = 0;
+    for (size_t j = 0; j < width; j++) {
+      auto position = i * width + j;
+      if (maskedShares.at(position) != otherMaskedShares.at(position)) {
+        offset |= (uint64_t)1 << j;
+      }
+    }
+    auto [indicators, seeds] = expandKey(keys_.front());
+    keys_.pop_front();
+
+    rst[i].first = std::vector<bool>(length);
+    rst[i].second = std::vector<__m128i>(length);
+    for (uint64_t j = 0; j < length; j++) {
+      rst[i].first[j] = indicators.at(j ^ offset);
+      rst[i].second[j] = seeds.at(j ^ offset);
+    }
+  }
+  return rst;
+}
+
+void DpfSinglePointArrayGenerator::generateKeys(size_t width, size_t count) {
+  if (width == 0 || width >= 64) {
+    throw std::invalid_argument("Invalid width!");
+  }
+  if (width != keyWidth_) {
+    keys_.clear();
+    keyWidth_ = width;
+  }
+  if (count == 0) {
+    return;
+  }
+
+  std::vector<std::vector<bool>> pointShares(width);
+  for (auto& item : pointShares) {
+    item = prg_->getRandomBits(count);
+  }
+  auto roots = prg_->getRandomM128i(count);
+
+  std::vector<Key> newKeys(count);
+  ArrayType levels(count);
+  for (size_t i = 0; i < count; i++) {
+    newKeys[i].pointShare = std::vector<bool>(width);
+    for (size_t j = 0; j < width; j++) {
+      newKeys[i].pointShare[j] = pointShares.at(j).at(i);
+    }
+    newKeys[i].seed = roots.at(i);
+    levels[i] = {{firstShare_}, {roots.at(i)}};
+  }
+
+  // the same expansion as SinglePointArrayGenerator, on the full domain
+  for (size_t level = 0; level < width; level++) {
+    std::vector<__m128i> delta0(count, _mm_set_epi64x(0, 0));
+    std::vector<__m128i> delta1(count, _mm_set_epi64x(0, 0));
+    for (size_t i = 0; i < count; i++) {
+      levels[i].second = expander_->expand(std::move(levels[i].second));
+      for (size_t j = 0; j < levels.at(i).second.size(); j += 2) {
+        delta0[i] = _mm_xor_si128(delta0.at(i), levels.at(i).second.at(j));
+        delta1[i] = _mm_xor_si128(delta1.at(i), levels.at(i).second.at(j + 1));
+      }
+    }
+    auto [delta, t0, t1] = obliviousDeltaCalculator_->calculateDelta(
+        delta0, delta1, pointShares.at(width - 1 - level));
+    for (size_t i = 0; i < count; i++) {
+      newKeys[i].deltas.push_back(delta.at(i));
+      newKeys[i].t0s.push_back(t0.at(i));
+      newKeys[i].t1s.push_back(t1.at(i));
+      correctLevel(
+          levels[i].first, levels[i].second, delta.at(i), t0.at(i), t1.at(i));
+    }
+  }
+
+  for (auto& key : newKeys) {
+    keys_.push_back(std::move(key));
+  }
+}
+
+void DpfSinglePointArrayGenerator::correctLevel(
+    std::vector<bool>& indicators,
+    std::vector<__m128i>& seeds,
+    __m128i delta,
+    bool t0,
+    bool t1) {
+  std::vector<bool> children(seeds.size());
+  for (size_t j = 0; j < seeds.size(); j += 2) {
+    children[j] = engine::util::getLsb(seeds.at(j));
+    children[j + 1] = engine::util::getLsb(seeds.at(j + 1));
+    if (indicators.at(j >> 1)) {
+      children[j] = children.at(j) ^ t0;
+      children[j + 1] = children.at(j + 1) ^ t1;
+      seeds[j] = _mm_xor_si128(seeds.at(j), delta);
+      seeds[j + 1] = _mm_xor_si128(seeds.at(j + 1), delta);
+    }
+  }
+  indicators = std::move(children);
+}
+
+std::pair<std::vector<bool>, std::vector<__m128i>>
+DpfSinglePointArrayGenerator::expandKey(const Key& key) const {
+  std::vector<bool> indicators{firstShare_};
+  std::vector<__m128i> seeds{key.seed};
+  for (size_t level = 0; level < key.deltas.size(); level++) {
+    seeds = expander_->expand(std::move(seeds));
+    correctLevel(
+        indicators,
+        seeds,
+        key.deltas.at(level),
+        key.t0s.at(level),
+        key.t1s.at(level));
+  }
+  return {std::move(indicators), std::move(seeds)};
+}
+
+} // namespace fbpcf::mpc_std_lib::oram
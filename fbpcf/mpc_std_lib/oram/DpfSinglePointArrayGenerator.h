@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <emmintrin.h>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "fbpcf/engine/communication/IPartyCommunicationAgent.h"
+#include "fbpcf/engine/util/IPrg.h"
+#include "fbpcf/engine/util/util.h"
+#include "fbpcf/mpc_std_lib/oram/IObliviousDeltaCalculator.h"
+#include "fbpcf/mpc_std_lib/oram/ISinglePointArrayGenerator.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+/**
+ * A single point array generator based on two-party distributed point
+ * functions (DPF). The keys of a DPF are compact: a root seed and one
+ * correction per tree level. They are generated for random points secret
+ * shared by both parties, in a protocol independent of any input, which takes
+ * one call to an oblivious delta calculator per level, see
+ * SinglePointArrayGenerator. Generating the arrays of a batch then consumes
+ * one key per array: both parties open the XOR of the index and the random
+ * point of the key in a single round trip, and expand the key locally with
+ * AES, reading it at position j XOR that offset for every position j.
+ * Keys are generated in pools of at least keyPoolSize, so that the rounds of
+ * key generation are amortized over the batches of a pool.
+ */
+class DpfSinglePointArrayGenerator final : public ISinglePointArrayGenerator {
+ public:
+  DpfSinglePointArrayGenerator(
+      bool firstShare /* which value to start with when generating the
+                         array, the two parties must use different values*/
+      ,
+      size_t keyPoolSize,
+      std::unique_ptr<IObliviousDeltaCalculator> obliviousDeltaCalculator,
+      std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent,
+      std::unique_ptr<engine::util::IPrg> prg)
+      : firstShare_(firstShare),
+        keyPoolSize_(keyPoolSize),
+        obliviousDeltaCalculator_(std::move(obliviousDeltaCalculator)),
+        agent_(std::move(agent)),
+        prg_(std::move(prg)) {
+    expander_ = std::make_unique<engine::util::Expander>(
+        0 /* this index is not important, any PUBLIC CONSTANT works*/);
+  }
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::pair<std::vector<bool>, std::vector<__m128i>>>
+  generateSinglePointArrays(
+      const std::vector<std::vector<bool>>& indexShares,
+      size_t length) override;
+
+  /**
+   * Generate keys for count random points of width bits ahead of time, e.g.
+   * before the inputs are known. Keys of a different width are dropped.
+   */
+  void generateKeys(size_t width, size_t count);
+
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() const override {
+    auto calculatorTraffic = obliviousDeltaCalculator_->getTrafficStatistics();
+    auto agentTraffic = agent_->getTrafficStatistics();
+    return {
+        calculatorTraffic.first + agentTraffic.first,
+        calculatorTraffic.second + agentTraffic.second};
+  }
+
+ private:
+  struct Key {
+    // this party's share of the point, from less significant to more
+    // significant
+    std::vector<bool> pointShare;
+    __m128i seed;
+    // the corrections of each level, from the root
+    std::vector<__m128i> deltas;
+    std::vector<bool> t0s;
+    std::vector<bool> t1s;
+  };
+
+  // Derive the indicators of the children from the lsbs of their seeds, and
+  // correct the children of every node whose indicator is set.
+  static void correctLevel(
+      std::vector<bool>& indicators,
+      std::vector<__m128i>& seeds,
+      __m128i delta,
+      bool t0,
+      bool t1);
+
+  std::pair<std::vector<bool>, std::vector<__m128i>> expandKey(
+      const Key& key) const;
+
+  bool firstShare_;
+  size_t keyPoolSize_;
+  std::unique_ptr<IObliviousDeltaCalculator> obliviousDeltaCalculator_;
+  std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent_;
+  std::unique_ptr<engine::util::IPrg> prg_;
+  std::unique_ptr<engine::util::Expander> expander_;
+
+  size_t keyWidth_ = 0;
+  std::deque<Key> keys_;
+};
+
+} // namespace fbpcf::mpc_std_lib::oram
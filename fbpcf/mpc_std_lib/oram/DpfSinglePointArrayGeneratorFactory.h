@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
+#include "fbpcf/engine/util/AesPrgFactory.h"
+#include "fbpcf/engine/util/util.h"
+#include "fbpcf/mpc_std_lib/oram/DpfSinglePointArrayGenerator.h"
+#include "fbpcf/mpc_std_lib/oram/IObliviousDeltaCalculatorFactory.h"
+#include "fbpcf/mpc_std_lib/oram/ISinglePointArrayGeneratorFactory.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+class DpfSinglePointArrayGeneratorFactory final
+    : public ISinglePointArrayGeneratorFactory {
+ public:
+  DpfSinglePointArrayGeneratorFactory(
+      bool firstShare,
+      int32_t peerId,
+      engine::communication::IPartyCommunicationAgentFactory& factory,
+      std::unique_ptr<IObliviousDeltaCalculatorFactory>
+          obliviousCalculatorFactory,
+      size_t keyPoolSize = 0)
+      : firstShare_(firstShare),
+        peerId_(peerId),
+        factory_(factory),
+        obliviousCalculatorFactory_(std::move(obliviousCalculatorFactory)),
+        keyPoolSize_(keyPoolSize) {}
+
+  std::unique_ptr<ISinglePointArrayGenerator> create() override {
+    return std::make_unique<DpfSinglePointArrayGenerator>(
+        firstShare_,
+        keyPoolSize_,
+        obliviousCalculatorFactory_->create(),
+        factory_.create(peerId_, "dpf_single_point_array_generator_traffic"),
+        engine::util::AesPrgFactory().create(
+            engine::util::getRandomM128iFromSystemNoise()));
+  }
+
+ private:
+  bool firstShare_;
+  int32_t peerId_;
+  engine::communication::IPartyCommunicationAgentFactory& factory_;
+  std::unique_ptr<IObliviousDeltaCalculatorFactory> obliviousCalculatorFactory_;
+  size_t keyPoolSize_;
+};
+
+} // namespace fbpcf::mpc_std_lib::oram
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace fbpcf::mpc_std_lib::oram {
+
+/*
+ * A read-write oram of size elements, each of them a string of valueWidth
+ * bits. Both indexes and values are XOR-secret-shared between two parties,
+ * and all elements are zero when the oram is created. An index must be
+ * smaller than the size of the oram.
+ */
+class IReadWriteOram {
+ public:
+  virtual ~IReadWriteOram() = default;
+
+  /**
+   * obliviously read a batch of elements at XOR-secret-shared positions.
+   * @param indexShares this party's shares of the indexes, from share batches
+   * of less significant to share batches of more significant;
+   * @return this party's XOR shares of the elements, from share batches of
+   * less significant to share batches of more significant;
+   */
+  virtual std::vector<std::vector<bool>> obliviousReadBatch(
+      const std::vector<std::vector<bool>>& indexShares) = 0;
+
+  /**
+   * obliviously overwrite a batch of elements at XOR-secret-shared positions
+   * with XOR-secret-shared values. The indexes in a batch must be distinct.
+   * @param indexShares this party's shares of the indexes, from share batches
+   * of less significant to share batches of more significant;
+   * @param values this party's shares of values to write, from share batches
+   * of less significant to share batches of more significant;
+   */
+  virtual void obliviousWriteBatch(
+      const std::vector<std::vector<bool>>& indexShares,
+      const std::vector<std::vector<bool>>& values) = 0;
+
+  /**
+   * Replace the whole content of the oram, e.g. to load a lookup table.
+   * @param values this party's XOR shares of all the elements, from share
+   * batches of less significant to share batches of more significant, each
+   * batch has one share per element;
+   */
+  virtual void initialize(const std::vector<std::vector<bool>>& values) = 0;
+
+  /**
+   * Get the total amount of traffic transmitted.
+   * @return a pair of (sent, received) data in bytes.
+   */
+  virtual std::pair<uint64_t, uint64_t> getTrafficStatistics() const = 0;
+};
+
+} // namespace fbpcf::mpc_std_lib::oram
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include "fbpcf/mpc_std_lib/oram/IReadWriteOram.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+class IReadWriteOramFactory {
+ public:
+  virtual ~IReadWriteOramFactory() = default;
+
+  virtual std::unique_ptr<IReadWriteOram> create(size_t size) = 0;
+};
+
+} // namespace fbpcf::mpc_std_lib::oram
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <emmintrin.h>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -39,6 +41,42 @@ class ISinglePointArrayGenerator {
       const std::vector<std::vector<bool>>& indexShares,
       size_t length) = 0;
 
+  /**
+   * A batch of single point arrays in contiguous memory: the array of the i-th
+   * batch element takes positions [i * length, (i + 1) * length) of both
+   * indicators and keys.
+   */
+  struct FlatArrayType {
+    size_t length;
+    std::vector<uint8_t> indicators;
+    std::vector<__m128i> keys;
+  };
+
+  /**
+   * The same as generateSinglePointArrays, but the arrays are generated in a
+   * FlatArrayType, which saves the allocation of a vector per batch element.
+   */
+  virtual FlatArrayType generateFlatSinglePointArrays(
+      const std::vector<std::vector<bool>>& indexShares,
+      size_t length) {
+    auto arrays = generateSinglePointArrays(indexShares, length);
+    FlatArrayType rst{
+        length,
+        std::vector<uint8_t>(arrays.size() * length),
+        std::vector<__m128i>(arrays.size() * length)};
+    for (size_t i = 0; i < arrays.size(); i++) {
+      std::copy(
+          arrays.at(i).first.begin(),
+          arrays.at(i).first.end(),
+          rst.indicators.begin() + i * length);
+      std::copy(
+          arrays.at(i).second.begin(),
+          arrays.at(i).second.end(),
+          rst.keys.begin() + i * length);
+    }
+    return rst;
+  }
+
   virtual std::pair<uint64_t, uint64_t> getTrafficStatistics() const = 0;
 };
 
@@ -69,32 +69,31 @@ void LinearOram<T, schedulerId>::obliviousAddBatch(
   auto valueForEachIndex =
       generateInputValue(std::move(value), std::move(index), size_, batchSize);
 
-  // party 1's share
-  std::vector<SecBatchT> shares1;
-
-  for (size_t i = 0; i < valueForEachIndex.size(); i++) {
-    std::vector<T> share0ForThisIndex(batchSize, T(0));
-    // generate a random value as party 0's share
-    if (myRole_ == Role::Alice) {
-      for (auto& item : share0ForThisIndex) {
-        item = util::Adapters<T>::generateFromKey(prg_->getRandomM128i());
-        memory_[i] = memory_.at(i) + item;
-      }
+  // generate random values as party 0's shares of all slots at once
+  std::vector<T> shares0(size_ * batchSize, T(0));
+  if (myRole_ == Role::Alice) {
+    auto keys = prg_->getRandomM128i(shares0.size());
+    for (size_t i = 0; i < shares0.size(); i++) {
+      shares0[i] = util::Adapters<T>::generateFromKey(keys.at(i));
+      memory_[i / batchSize] = memory_.at(i / batchSize) + shares0.at(i);
     }
-    auto share0 = util::MpcAdapters<T, schedulerId>::processSecretInputs(
-        share0ForThisIndex, party0Id_);
-    // calculate party 1's share
-    shares1.push_back(valueForEachIndex.at(i) - share0);
   }
-
-  for (size_t i = 0; i < size_; i++) {
-    // open the difference to party 1
-    auto share1Plaintext = util::MpcAdapters<T, schedulerId>::openToParty(
-        shares1.at(i), party1Id_);
-    if (myRole_ == Role::Bob) {
-      for (auto& item : share1Plaintext) {
-        memory_[i] = memory_.at(i) + item;
-      }
+  auto share0 = util::MpcAdapters<T, schedulerId>::processSecretInputs(
+      shares0, party0Id_);
+
+  // concatenate the values of all slots into a single batch, so that party 1's
+  // shares are computed and opened at once, regardless of the ORAM size.
+  auto allValues = util::MpcAdapters<T, schedulerId>::batchingWith(
+      valueForEachIndex.at(0),
+      std::vector<SecBatchT>(
+          valueForEachIndex.begin() + 1, valueForEachIndex.end()));
+
+  // open the differences to party 1
+  auto shares1 = util::MpcAdapters<T, schedulerId>::openToParty(
+      allValues - share0, party1Id_);
+  if (myRole_ == Role::Bob) {
+    for (size_t i = 0; i < shares1.size(); i++) {
+      memory_[i / batchSize] = memory_.at(i / batchSize) + shares1.at(i);
     }
   }
 }
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <emmintrin.h>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "fbpcf/engine/communication/IPartyCommunicationAgent.h"
+#include "fbpcf/engine/util/IPrg.h"
+#include "fbpcf/engine/util/aes.h"
+#include "fbpcf/frontend/Bit.h"
+#include "fbpcf/mpc_std_lib/aes_circuit/IAesCircuit.h"
+#include "fbpcf/mpc_std_lib/oram/IReadWriteOram.h"
+#include "fbpcf/mpc_std_lib/oram/ISinglePointArrayGenerator.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+/**
+ * A read-write ORAM following Floram (Doerner and shelat, CCS'17). Each party
+ * holds an XOR share of the memory, and both hold the same copy of the memory
+ * masked by AES_kA(j) ^ AES_kB(j) at every position j, where kA and kB are
+ * private AES keys of the two parties. An access at a secret index costs
+ * local work linear in the size of the oram but only logarithmic traffic:
+ *  - the masked element is read with a single point array: each party XORs
+ *    the masked elements its array selects, the XOR of the two results is
+ *    the masked element;
+ *  - the masks of the index are computed with an AES circuit, each party
+ *    contributing its own key;
+ *  - a write XORs the difference between the new and the old value into the
+ *    shares of the memory with a single point array, and remembers the
+ *    index and the difference in a stash, which is scanned in circuit by
+ *    every read since the masked copy is stale.
+ * When the stash reaches stashCapacity elements, the masked copy is rebuilt
+ * from the shares of the memory under fresh keys, which costs traffic linear
+ * in the size of the oram.
+ */
+template <int schedulerId>
+class ReadWriteOram final : public IReadWriteOram {
+  using SecBit = frontend::Bit<true, schedulerId, true>;
+
+ public:
+  ReadWriteOram(
+      bool amIParty0,
+      size_t size,
+      size_t valueWidth,
+      size_t stashCapacity,
+      std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent,
+      std::unique_ptr<ISinglePointArrayGenerator> generator,
+      std::unique_ptr<aes_circuit::IAesCircuit<SecBit>> aesCircuit,
+      std::unique_ptr<engine::util::IPrg> prg);
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<bool>> obliviousReadBatch(
+      const std::vector<std::vector<bool>>& indexShares) override;
+
+  /**
+   * @inherit doc
+   */
+  void obliviousWriteBatch(
+      const std::vector<std::vector<bool>>& indexShares,
+      const std::vector<std::vector<bool>>& values) override;
+
+  /**
+   * @inherit doc
+   */
+  void initialize(const std::vector<std::vector<bool>>& values) override;
+
+  /**
+   * @inherit doc
+   */
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() const override {
+    auto generatorTraffic = generator_->getTrafficStatistics();
+    auto oramTraffic = agent_->getTrafficStatistics();
+    return {
+        generatorTraffic.first + oramTraffic.first,
+        generatorTraffic.second + oramTraffic.second};
+  }
+
+ private:
+  // read this party's shares of the elements at the indexes, the single point
+  // arrays of the indexes are kept in arrays.
+  std::vector<__m128i> readShares(
+      const std::vector<std::vector<bool>>& indexShares,
+      ISinglePointArrayGenerator::FlatArrayType& arrays);
+
+  // compute AES_kA(index) ^ AES_kB(index) in circuit, on a batch holding the
+  // indexes twice, once for each key.
+  std::vector<SecBit> maskBits(
+      const std::vector<std::vector<bool>>& indexShares) const;
+
+  // compute the XOR of the differences in the stash at each index in circuit,
+  // on a batch holding each pair of an index and a stash element.
+  std::vector<SecBit> stashBits(
+      const std::vector<std::vector<bool>>& indexShares) const;
+
+  // rebuild the masked copy of the memory under a fresh key and empty the
+  // stash.
+  void refresh();
+
+  // open values of which each party holds an XOR share to both parties
+  std::vector<__m128i> open(const std::vector<__m128i>& shares) const;
+
+  // The AES circuit takes the bytes of a block in memory order, and the bits
+  // of each byte from the most significant one, while util::convertToBits
+  // starts from the least significant bit of each byte.
+  static size_t toAesCircuitOrder(size_t bit) {
+    return (bit & ~(size_t)7) | (7 - (bit & 7));
+  }
+
+  // convert between valueWidth share batches and one __m128i per element
+  std::vector<__m128i> toM128i(
+      const std::vector<std::vector<bool>>& values) const;
+
+  std::vector<std::vector<bool>> fromM128i(
+      const std::vector<__m128i>& values) const;
+
+  bool amIParty0_;
+  size_t size_;
+  size_t indexWidth_;
+  size_t valueWidth_;
+  size_t stashCapacity_;
+  __m128i valueMask_;
+
+  std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent_;
+  std::unique_ptr<ISinglePointArrayGenerator> generator_;
+  std::unique_ptr<aes_circuit::IAesCircuit<SecBit>> aesCircuit_;
+  std::unique_ptr<engine::util::IPrg> prg_;
+
+  // hash the keys of single point arrays into write masks
+  engine::util::Aes hashCipher_;
+  // this party's key of the masked copy
+  engine::util::Aes prf_;
+  std::array<__m128i, 11> expandedKey_;
+
+  std::vector<__m128i> memoryShare_;
+  std::vector<__m128i> maskedMemory_;
+
+  std::vector<std::vector<bool>> stashIndexShares_;
+  std::vector<__m128i> stashDifferenceShares_;
+};
+
+} // namespace fbpcf::mpc_std_lib::oram
+
+#include "fbpcf/mpc_std_lib/oram/ReadWriteOram_impl.h"
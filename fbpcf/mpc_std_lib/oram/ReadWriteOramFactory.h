@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <memory>
+#include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
+#include "fbpcf/engine/util/AesPrgFactory.h"
+#include "fbpcf/engine/util/util.h"
+#include "fbpcf/mpc_std_lib/aes_circuit/AesCircuitFactory.h"
+#include "fbpcf/mpc_std_lib/oram/IReadWriteOramFactory.h"
+#include "fbpcf/mpc_std_lib/oram/ISinglePointArrayGeneratorFactory.h"
+#include "fbpcf/mpc_std_lib/oram/ObliviousDeltaCalculatorFactory.h"
+#include "fbpcf/mpc_std_lib/oram/ReadWriteOram.h"
+#include "fbpcf/mpc_std_lib/oram/SinglePointArrayGeneratorFactory.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+template <int schedulerId>
+class ReadWriteOramFactory final : public IReadWriteOramFactory {
+ public:
+  ReadWriteOramFactory(
+      bool amIParty0,
+      int32_t peerId,
+      size_t valueWidth,
+      engine::communication::IPartyCommunicationAgentFactory& factory,
+      std::unique_ptr<ISinglePointArrayGeneratorFactory>
+          singlePointArrayFactory,
+      size_t stashCapacity = 0 /* 0 means the square root of the size */)
+      : amIParty0_(amIParty0),
+        peerId_(peerId),
+        valueWidth_(valueWidth),
+        factory_(factory),
+        singlePointArrayFactory_(std::move(singlePointArrayFactory)),
+        stashCapacity_(stashCapacity) {}
+
+  std::unique_ptr<IReadWriteOram> create(size_t size) override {
+    return std::make_unique<ReadWriteOram<schedulerId>>(
+        amIParty0_,
+        size,
+        valueWidth_,
+        stashCapacity_ == 0 ? std::ceil(std::sqrt(size)) : stashCapacity_,
+        factory_.create(peerId_, "read_write_oram_traffic"),
+        singlePointArrayFactory_->create(),
+        aes_circuit::AesCircuitFactory<frontend::Bit<true, schedulerId, true>>()
+            .create(),
+        engine::util::AesPrgFactory().create(
+            engine::util::getRandomM128iFromSystemNoise()));
+  }
+
+ private:
+  bool amIParty0_;
+  int32_t peerId_;
+  size_t valueWidth_;
+  engine::communication::IPartyCommunicationAgentFactory& factory_;
+  std::unique_ptr<ISinglePointArrayGeneratorFactory> singlePointArrayFactory_;
+  size_t stashCapacity_;
+};
+
+template <int schedulerId>
+std::unique_ptr<IReadWriteOramFactory> getSecureReadWriteOramFactory(
+    bool amIParty0,
+    int32_t party0Id,
+    int32_t party1Id,
+    size_t valueWidth,
+    engine::communication::IPartyCommunicationAgentFactory& factory,
+    size_t stashCapacity = 0) {
+  return std::make_unique<ReadWriteOramFactory<schedulerId>>(
+      amIParty0,
+      amIParty0 ? party1Id : party0Id,
+      valueWidth,
+      factory,
+      std::make_unique<SinglePointArrayGeneratorFactory>(
+          amIParty0,
+          std::make_unique<ObliviousDeltaCalculatorFactory<schedulerId>>(
+              amIParty0, party0Id, party1Id)),
+      stashCapacity);
+}
+
+} // namespace fbpcf::mpc_std_lib::oram
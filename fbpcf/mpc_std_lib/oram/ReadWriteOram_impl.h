@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include "fbpcf/mpc_std_lib/util/util.h"
+
+// included for clangd resolution. Should not execute during compilation
+#include "fbpcf/mpc_std_lib/oram/ReadWriteOram.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+template <int schedulerId>
+ReadWriteOram<schedulerId>::ReadWriteOram(
+    bool amIParty0,
+    size_t size,
+    size_t valueWidth,
+    size_t stashCapacity,
+    std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent,
+    std::unique_ptr<ISinglePointArrayGenerator> generator,
+    std::unique_ptr<aes_circuit::IAesCircuit<SecBit>> aesCircuit,
+    std::unique_ptr<engine::util::IPrg> prg)
+    : amIParty0_(amIParty0),
+      size_(size),
+      valueWidth_(valueWidth),
+      stashCapacity_(stashCapacity),
+      agent_(std::move(agent)),
+      generator_(std::move(generator)),
+      aesCircuit_(std::move(aesCircuit)),
+      prg_(std::move(prg)),
+      hashCipher_(engine::util::Aes::getFixedKey()),
+      prf_(engine::util::Aes::getFixedKey()),
+      memoryShare_(size, _mm_set_epi64x(0, 0)) {
+  if (size_ == 0) {
+    throw std::invalid_argument("ORAM size can't be zero.");
+  }
+  if (valueWidth_ == 0 || valueWidth_ > 128) {
+    throw std::invalid_argument("Value width must be between 1 and 128.");
+  }
+  indexWidth_ = std::max<size_t>(std::ceil(std::log2(size_)), 1);
+  uint64_t lowMask = -1;
+  uint64_t highMask = -1;
+  if (valueWidth_ < 64) {
+    lowMask = ((uint64_t)1 << valueWidth_) - 1;
+    highMask = 0;
+  } else if (valueWidth_ < 128) {
+    highMask = ((uint64_t)1 << (valueWidth_ - 64)) - 1;
+  }
+  valueMask_ = _mm_set_epi64x(highMask, lowMask);
+  stashIndexShares_ = std::vector<std::vector<bool>>(indexWidth_);
+}
+
+template <int schedulerId>
+std::vector<std::vector<bool>> ReadWriteOram<schedulerId>::obliviousReadBatch(
+    const std::vector<std::vector<bool>>& indexShares) {
+  ISinglePointArrayGenerator::FlatArrayType arrays;
+  return fromM128i(readShares(indexShares, arrays));
+}
+
+template <int schedulerId>
+void ReadWriteOram<schedulerId>::obliviousWriteBatch(
+    const std::vector<std::vector<bool>>& indexShares,
+    const std::vector<std::vector<bool>>& values) {
+  if (values.size() != valueWidth_) {
+    throw std::invalid_argument("Unexpected value width.");
+  }
+  ISinglePointArrayGenerator::FlatArrayType arrays;
+  auto oldValues = readShares(indexShares, arrays);
+  auto batchSize = oldValues.size();
+  for (auto& item : values) {
+    if (item.size() != batchSize) {
+      throw std::invalid_argument("Inconsistent size.");
+    }
+  }
+
+  auto differences = toM128i(values);
+  for (size_t i = 0; i < batchSize; i++) {
+    differences[i] = _mm_xor_si128(differences.at(i), oldValues.at(i));
+  }
+
+  // The masks of the two parties cancel out everywhere but at the index. A
+  // public correction turns the XOR of the two masks at the index into the
+  // difference.
+  hashCipher_.inPlaceHash(arrays.keys);
+  std::vector<__m128i> correctionShares(differences);
+  for (size_t i = 0; i < batchSize; i++) {
+    for (size_t j = i * size_; j < (i + 1) * size_; j++) {
+      correctionShares[i] =
+          _mm_xor_si128(correctionShares.at(i), arrays.keys.at(j));
+    }
+  }
+  auto corrections = open(correctionShares);
+  for (size_t i = 0; i < batchSize; i++) {
+    for (size_t j = 0; j < size_; j++) {
+      auto position = i * size_ + j;
+      auto mask = arrays.indicators.at(position)
+          ? _mm_xor_si128(arrays.keys.at(position), corrections.at(i))
+          : arrays.keys.at(position);
+      memoryShare_[j] =
+          _mm_xor_si128(memoryShare_.at(j), _mm_and_si128(mask, valueMask_));
+    }
+  }
+
+  for (size_t i = 0; i < indexWidth_; i++) {
+    stashIndexShares_[i].insert(
+        stashIndexShares_[i].end(),
+        indexShares.at(i).begin(),
+        indexShares.at(i).end());
+  }
+  stashDifferenceShares_.insert(
+      stashDifferenceShares_.end(), differences.begin(), differences.end());
+  if (stashDifferenceShares_.size() >= stashCapacity_) {
+    refresh();
+  }
+}
+
+template <int schedulerId>
+void ReadWriteOram<schedulerId>::initialize(
+    const std::vector<std::vector<bool>>& values) {
+  if (values.size() != valueWidth_) {
+    throw std::invalid_argument("Unexpected value width.");
+  }
+  for (auto& item : values) {
+    if (item.size() != size_) {
+      throw std::invalid_argument("Unexpected number of values.");
+    }
+  }
+  memoryShare_ = toM128i(values);
+  refresh();
+}
+
+template <int schedulerId>
+std::vector<__m128i> ReadWriteOram<schedulerId>::readShares(
+    const std::vector<std::vector<bool>>& indexShares,
+    ISinglePointArrayGenerator::FlatArrayType& arrays) {
+  if (indexShares.size() < indexWidth_) {
+    throw std::invalid_argument("Input index array size is too small.");
+  }
+  auto batchSize = indexShares.at(0).size();
+  if (batchSize == 0) {
+    throw std::invalid_argument("Input cannot be empty");
+  }
+  for (auto& item : indexShares) {
+    if (item.size() != batchSize) {
+      throw std::invalid_argument("Inconsistent size.");
+    }
+  }
+  if (maskedMemory_.empty()) {
+    refresh();
+  }
+
+  // an index is smaller than size_, the shares of its higher bits are not
+  // needed.
+  std::vector<std::vector<bool>> indexes(
+      indexShares.begin(), indexShares.begin() + indexWidth_);
+  auto masks = maskBits(indexes);
+  auto differences = stashBits(indexes);
+
+  arrays = generator_->generateFlatSinglePointArrays(indexShares, size_);
+  std::vector<__m128i> rst(batchSize, _mm_set_epi64x(0, 0));
+  for (size_t i = 0; i < batchSize; i++) {
+    for (size_t j = 0; j < size_; j++) {
+      if (arrays.indicators.at(i * size_ + j)) {
+        rst[i] = _mm_xor_si128(rst.at(i), maskedMemory_.at(j));
+      }
+    }
+  }
+
+  std::vector<std::vector<bool>> maskShares(128);
+  for (size_t i = 0; i < 128; i++) {
+    auto share = masks.at(toAesCircuitOrder(i)).extractBit().getValue();
+    maskShares[i] = std::vector<bool>(batchSize);
+    for (size_t j = 0; j < batchSize; j++) {
+      maskShares[i][j] = share.at(j) != share.at(batchSize + j);
+    }
+  }
+  auto maskM128i = util::convertFromBits(maskShares);
+  for (size_t i = 0; i < batchSize; i++) {
+    rst[i] = _mm_xor_si128(rst.at(i), maskM128i.at(i));
+  }
+
+  if (!differences.empty()) {
+    std::vector<std::vector<bool>> differenceShares(
+        valueWidth_, std::vector<bool>(batchSize));
+    for (size_t i = 0; i < valueWidth_; i++) {
+      auto share = differences.at(i).extractBit().getValue();
+      for (size_t j = 0; j < share.size(); j++) {
+        differenceShares[i][j % batchSize] =
+            differenceShares.at(i).at(j % batchSize) != share.at(j);
+      }
+    }
+    auto differenceM128i = toM128i(differenceShares);
+    for (size_t i = 0; i < batchSize; i++) {
+      rst[i] = _mm_xor_si128(rst.at(i), differenceM128i.at(i));
+    }
+  }
+
+  for (auto& item : rst) {
+    item = _mm_and_si128(item, valueMask_);
+  }
+  return rst;
+}
+
+template <int schedulerId>
+std::vector<typename ReadWriteOram<schedulerId>::SecBit>
+ReadWriteOram<schedulerId>::maskBits(
+    const std::vector<std::vector<bool>>& indexShares) const {
+  auto batchSize = indexShares.at(0).size();
+
+  // The two halves of the batch are encrypted with the keys of party 0 and
+  // party 1. Each party shares its key with the other party holding a zero
+  // share, which is free.
+  std::vector<SecBit> plaintext(128);
+  for (size_t i = 0; i < 128; i++) {
+    std::vector<bool> shares(2 * batchSize, false);
+    if (i < indexWidth_) {
+      std::copy(
+          indexShares.at(i).begin(), indexShares.at(i).end(), shares.begin());
+      std::copy(
+          indexShares.at(i).begin(),
+          indexShares.at(i).end(),
+          shares.begin() + batchSize);
+    }
+    plaintext[toAesCircuitOrder(i)] =
+        SecBit(typename SecBit::ExtractedBit(shares));
+  }
+
+  std::vector<SecBit> key(aes_circuit::IAesCircuit<SecBit>::kExpandedKeyWidth);
+  auto keyBits = util::convertToBits(
+      std::vector<__m128i>(expandedKey_.begin(), expandedKey_.end()));
+  for (size_t round = 0; round < expandedKey_.size(); round++) {
+    for (size_t i = 0; i < 128; i++) {
+      std::vector<bool> shares(2 * batchSize, false);
+      std::fill(
+          shares.begin() + (amIParty0_ ? 0 : batchSize),
+          shares.begin() + (amIParty0_ ? batchSize : 2 * batchSize),
+          keyBits.at(i).at(round));
+      key[round * 128 + toAesCircuitOrder(i)] =
+          SecBit(typename SecBit::ExtractedBit(shares));
+    }
+  }
+  return aesCircuit_->encrypt(plaintext, key);
+}
+
+template <int schedulerId>
+std::vector<typename ReadWriteOram<schedulerId>::SecBit>
+ReadWriteOram<schedulerId>::stashBits(
+    const std::vector<std::vector<bool>>& indexShares) const {
+  auto batchSize = indexShares.at(0).size();
+  auto stashSize = stashDifferenceShares_.size();
+  if (stashSize == 0) {
+    return {};
+  }
+
+  // position j * batchSize + i compares the i-th index with the j-th element
+  // of the stash.
+  SecBit isEqual;
+  for (size_t i = 0; i < indexWidth_; i++) {
+    std::vector<bool> indexBit(stashSize * batchSize);
+    std::vector<bool> stashBit(stashSize * batchSize);
+    for (size_t j = 0; j < stashSize; j++) {
+      std::copy(
+          indexShares.at(i).begin(),
+          indexShares.at(i).end(),
+          indexBit.begin() + j * batchSize);
+      std::fill(
+          stashBit.begin() + j * batchSize,
+          stashBit.begin() + (j + 1) * batchSize,
+          stashIndexShares_.at(i).at(j));
+    }
+    auto isBitEqual = !(SecBit(typename SecBit::ExtractedBit(indexBit)) ^
+                        SecBit(typename SecBit::ExtractedBit(stashBit)));
+    isEqual = i == 0 ? isBitEqual : isEqual & isBitEqual;
+  }
+
+  auto differenceBits = util::convertToBits(stashDifferenceShares_);
+  std::vector<SecBit> rst(valueWidth_);
+  for (size_t i = 0; i < valueWidth_; i++) {
+    std::vector<bool> differenceBit(stashSize * batchSize);
+    for (size_t j = 0; j < stashSize; j++) {
+      std::fill(
+          differenceBit.begin() + j * batchSize,
+          differenceBit.begin() + (j + 1) * batchSize,
+          differenceBits.at(i).at(j));
+    }
+    rst[i] = SecBit(typename SecBit::ExtractedBit(differenceBit)) & isEqual;
+  }
+  return rst;
+}
+
+template <int schedulerId>
+void ReadWriteOram<schedulerId>::refresh() {
+  auto key = prg_->getRandomM128i(1).at(0);
+  prf_ = engine::util::Aes(key);
+  expandedKey_ = engine::util::Aes::expandEncryptionKey(key);
+
+  std::vector<__m128i> maskedShare(size_);
+  for (size_t i = 0; i < size_; i++) {
+    maskedShare[i] = _mm_set_epi64x(0, i);
+  }
+  prf_.encryptInPlace(maskedShare);
+  for (size_t i = 0; i < size_; i++) {
+    maskedShare[i] = _mm_xor_si128(maskedShare.at(i), memoryShare_.at(i));
+  }
+  maskedMemory_ = open(maskedShare);
+
+  for (auto& item : stashIndexShares_) {
+    item.clear();
+  }
+  stashDifferenceShares_.clear();
+}
+
+template <int schedulerId>
+std::vector<__m128i> ReadWriteOram<schedulerId>::open(
+    const std::vector<__m128i>& shares) const {
+  // only the bytes holding the valueWidth_ lowest bits are sent.
+  auto byteWidth = (valueWidth_ + 7) / 8;
+  std::vector<unsigned char> buffer(shares.size() * byteWidth);
+  for (size_t i = 0; i < shares.size(); i++) {
+    std::memcpy(buffer.data() + i * byteWidth, &shares.at(i), byteWidth);
+  }
+  agent_->send(buffer);
+  auto received = agent_->receive(buffer.size());
+
+  std::vector<__m128i> rst(shares.size());
+  for (size_t i = 0; i < shares.size(); i++) {
+    auto otherShare = _mm_set_epi64x(0, 0);
+    std::memcpy(&otherShare, received.data() + i * byteWidth, byteWidth);
+    rst[i] = _mm_and_si128(
+        _mm_xor_si128(shares.at(i), otherShare), valueMask_);
+  }
+  return rst;
+}
+
+template <int schedulerId>
+std::vector<__m128i> ReadWriteOram<schedulerId>::toM128i(
+    const std::vector<std::vector<bool>>& values) const {
+  std::vector<std::vector<bool>> bits(values);
+  bits.resize(128, std::vector<bool>(values.at(0).size()));
+  return util::convertFromBits(bits);
+}
+
+template <int schedulerId>
+std::vector<std::vector<bool>> ReadWriteOram<schedulerId>::fromM128i(
+    const std::vector<__m128i>& values) const {
+  auto bits = util::convertToBits(values);
+  bits.resize(valueWidth_);
+  return bits;
+}
+
+} // namespace fbpcf::mpc_std_lib::oram
@@ -7,17 +7,55 @@
 
 #include "fbpcf/mpc_std_lib/oram/SinglePointArrayGenerator.h"
 #include <algorithm>
-#include <cmath>
 #include <stdexcept>
+#include <thread>
 #include "fbpcf/engine/util/util.h"
 #include "fbpcf/mpc_std_lib/util/util.h"
 
 namespace fbpcf::mpc_std_lib::oram {
 
+template <typename Task>
+void SinglePointArrayGenerator::runInParallel(
+    size_t batchSize,
+    size_t keysPerElement,
+    Task&& task) const {
+  size_t threadCount = std::min(
+      {threadCount_,
+       batchSize,
+       std::max<size_t>(batchSize * keysPerElement / kMinKeysPerThread, 1)});
+  auto chunkSize = (batchSize + threadCount - 1) / threadCount;
+  std::vector<std::thread> threads;
+  for (size_t begin = chunkSize; begin < batchSize; begin += chunkSize) {
+    auto end = std::min(begin + chunkSize, batchSize);
+    threads.emplace_back([&task, begin, end]() { task(begin, end); });
+  }
+  task(0, std::min(chunkSize, batchSize));
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
 std::vector<std::pair<std::vector<bool>, std::vector<__m128i>>>
 SinglePointArrayGenerator::generateSinglePointArrays(
     const std::vector<std::vector<bool>>& indexShares,
     size_t length) {
+  auto arrays = generateFlatSinglePointArrays(indexShares, length);
+  ArrayType rst(indexShares.at(0).size());
+  for (size_t i = 0; i < rst.size(); i++) {
+    rst[i].first = std::vector<bool>(
+        arrays.indicators.begin() + i * length,
+        arrays.indicators.begin() + (i + 1) * length);
+    rst[i].second = std::vector<__m128i>(
+        arrays.keys.begin() + i * length,
+        arrays.keys.begin() + (i + 1) * length);
+  }
+  return rst;
+}
+
+ISinglePointArrayGenerator::FlatArrayType
+SinglePointArrayGenerator::generateFlatSinglePointArrays(
+    const std::vector<std::vector<bool>>& indexShares,
+    size_t length) {
   auto width = indexShares.size();
   if (width == 0) {
     throw std::invalid_argument("Empty input!");
@@ -33,63 +71,93 @@ SinglePointArrayGenerator::generateSinglePointArrays(
     throw std::invalid_argument("Empty input!");
   }
 
-  ArrayType rst(batchSize, {{firstShare_}, std::vector<__m128i>(1)});
+  FlatArrayType rst{
+      1,
+      std::vector<uint8_t>(batchSize, firstShare_),
+      std::vector<__m128i>(batchSize)};
 
-  for (auto& item : rst) {
-    item.second[0] = engine::util::getRandomM128iFromSystemNoise();
+  for (auto& item : rst.keys) {
+    item = engine::util::getRandomM128iFromSystemNoise();
   }
 
   for (size_t i = 0; i < width; i++) {
-    rst = expandArray(std::move(rst), indexShares.at(width - 1 - i));
     // neededLength is the smallest integer such that neededLength << (width - 1
     // - i) >= length
-    auto neededLength =
-        std::ceil(length * 1.0 / ((uint64_t)1 << (width - 1 - i)));
-    for (auto& item : rst) {
-      item.first.erase(item.first.begin() + neededLength, item.first.end());
-      item.second.erase(item.second.begin() + neededLength, item.second.end());
-    }
+    auto shift = width - 1 - i;
+    size_t neededLength =
+        (length >> shift) + ((length & (((uint64_t)1 << shift) - 1)) != 0);
+    rst = expandArray(
+        std::move(rst), indexShares.at(width - 1 - i), neededLength);
   }
 
   return rst;
 }
 
-ISinglePointArrayGenerator::ArrayType SinglePointArrayGenerator::expandArray(
-    ArrayType&& src,
-    const std::vector<bool>& indicatorShare) const {
-  size_t batchSize = src.size();
-  if (indicatorShare.size() != batchSize) {
+ISinglePointArrayGenerator::FlatArrayType
+SinglePointArrayGenerator::expandArray(
+    FlatArrayType&& src,
+    const std::vector<bool>& indicatorShare,
+    size_t length) const {
+  size_t batchSize = indicatorShare.size();
+  if (src.keys.size() != batchSize * src.length) {
     throw std::invalid_argument("Inconsistent size.");
   }
-  ArrayType rst(batchSize);
+  auto expandedLength = src.length * 2;
+  FlatArrayType rst{
+      expandedLength,
+      std::vector<uint8_t>(batchSize * expandedLength),
+      std::vector<__m128i>(batchSize * expandedLength)};
 
   std::vector<__m128i> delta0(batchSize, _mm_set_epi64x(0, 0));
   std::vector<__m128i> delta1(batchSize, _mm_set_epi64x(0, 0));
 
-  for (size_t i = 0; i < batchSize; i++) {
-    rst[i].second = expander_->expand(std::move(src[i].second));
-    for (size_t j = 0; j < rst.at(i).second.size(); j += 2) {
-      delta0[i] = _mm_xor_si128(delta0.at(i), rst.at(i).second.at(j));
-      delta1[i] = _mm_xor_si128(delta1.at(i), rst.at(i).second.at(j + 1));
+  runInParallel(batchSize, src.length, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      auto children = rst.keys.data() + i * expandedLength;
+      expander_->expand(src.keys.data() + i * src.length, src.length, children);
+      for (size_t j = 0; j < expandedLength; j += 2) {
+        delta0[i] = _mm_xor_si128(delta0[i], children[j]);
+        delta1[i] = _mm_xor_si128(delta1[i], children[j + 1]);
+      }
     }
-  }
+  });
+
   auto [delta, t0, t1] =
       obliviousDeltaCalculator_->calculateDelta(delta0, delta1, indicatorShare);
-  for (size_t i = 0; i < batchSize; i++) {
-    rst[i].first = std::vector<bool>(rst.at(i).second.size());
-
-    for (size_t j = 0; j < rst.at(i).second.size(); j += 2) {
-      rst[i].first[j] = engine::util::getLsb(rst.at(i).second.at(j));
-      rst[i].first[j + 1] = engine::util::getLsb(rst.at(i).second.at(j + 1));
-      if (src.at(i).first.at(j >> 1)) {
-        rst[i].first[j] = rst.at(i).first.at(j) ^ t0.at(i);
-        rst[i].first[j + 1] = rst.at(i).first.at(j + 1) ^ t1.at(i);
-
-        rst[i].second[j] = _mm_xor_si128(rst.at(i).second.at(j), delta.at(i));
-        rst[i].second[j + 1] =
-            _mm_xor_si128(rst.at(i).second.at(j + 1), delta.at(i));
+
+  runInParallel(batchSize, src.length, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      auto parents = src.indicators.data() + i * src.length;
+      auto indicators = rst.indicators.data() + i * expandedLength;
+      auto children = rst.keys.data() + i * expandedLength;
+      for (size_t j = 0; j < expandedLength; j += 2) {
+        indicators[j] = engine::util::getLsb(children[j]);
+        indicators[j + 1] = engine::util::getLsb(children[j + 1]);
+        if (parents[j >> 1]) {
+          indicators[j] ^= t0.at(i);
+          indicators[j + 1] ^= t1.at(i);
+          children[j] = _mm_xor_si128(children[j], delta.at(i));
+          children[j + 1] = _mm_xor_si128(children[j + 1], delta.at(i));
+        }
       }
     }
+  });
+
+  if (length < expandedLength) {
+    // drop the unneeded tails, moving every array towards the front
+    for (size_t i = 0; i < batchSize; i++) {
+      std::copy(
+          rst.indicators.begin() + i * expandedLength,
+          rst.indicators.begin() + i * expandedLength + length,
+          rst.indicators.begin() + i * length);
+      std::copy(
+          rst.keys.begin() + i * expandedLength,
+          rst.keys.begin() + i * expandedLength + length,
+          rst.keys.begin() + i * length);
+    }
+    rst.indicators.resize(batchSize * length);
+    rst.keys.resize(batchSize * length);
+    rst.length = length;
   }
   return rst;
 }
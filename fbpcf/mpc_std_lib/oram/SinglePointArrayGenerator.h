@@ -8,8 +8,10 @@
 #pragma once
 
 #include <emmintrin.h>
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "fbpcf/engine/communication/IPartyCommunicationAgent.h"
@@ -23,6 +25,8 @@ namespace fbpcf::mpc_std_lib::oram {
  * A single point array generator allow two parties jointly generate a pair of
  * single point array. The point position is shared by two parties.
  * This object uses an oblivious delta calculator as an underlying object.
+ * The arrays of a batch are kept in contiguous memory, and the local AES
+ * expansion of each level is split across up to threadCount threads.
  */
 class SinglePointArrayGenerator final : public ISinglePointArrayGenerator {
  public:
@@ -30,9 +34,11 @@ class SinglePointArrayGenerator final : public ISinglePointArrayGenerator {
       bool firstShare /* which value to start with when generating the
                          array, the two parties must use different values*/
       ,
-      std::unique_ptr<IObliviousDeltaCalculator> obliviousDeltaCalculator)
+      std::unique_ptr<IObliviousDeltaCalculator> obliviousDeltaCalculator,
+      size_t threadCount = std::thread::hardware_concurrency())
       : firstShare_(firstShare),
-        obliviousDeltaCalculator_(std::move(obliviousDeltaCalculator)) {
+        obliviousDeltaCalculator_(std::move(obliviousDeltaCalculator)),
+        threadCount_(std::max<size_t>(threadCount, 1)) {
     expander_ = std::make_unique<engine::util::Expander>(
         0 /* this index is not important, any PUBLIC CONSTANT works*/);
   }
@@ -45,17 +51,36 @@ class SinglePointArrayGenerator final : public ISinglePointArrayGenerator {
       const std::vector<std::vector<bool>>& indexShares,
       size_t length) override;
 
+  /**
+   * @inherit doc
+   */
+  FlatArrayType generateFlatSinglePointArrays(
+      const std::vector<std::vector<bool>>& indexShares,
+      size_t length) override;
+
   std::pair<uint64_t, uint64_t> getTrafficStatistics() const override {
     return obliviousDeltaCalculator_->getTrafficStatistics();
   }
 
  private:
-  ArrayType expandArray(
-      ArrayType&& src,
-      const std::vector<bool>& indicatorShare) const;
+  // expand every array of src into 2 * src.length nodes, and keep the first
+  // length of them.
+  FlatArrayType expandArray(
+      FlatArrayType&& src,
+      const std::vector<bool>& indicatorShare,
+      size_t length) const;
+
+  // run task(begin, end) on disjoint ranges covering [0, batchSize), on
+  // enough threads to give each at least kMinKeysPerThread keys to expand.
+  template <typename Task>
+  void runInParallel(size_t batchSize, size_t keysPerElement, Task&& task)
+      const;
+
+  static constexpr size_t kMinKeysPerThread = 1 << 12;
 
   bool firstShare_;
   std::unique_ptr<IObliviousDeltaCalculator> obliviousDeltaCalculator_;
+  size_t threadCount_;
   std::unique_ptr<engine::util::Expander> expander_;
 };
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <thread>
 #include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
 #include "fbpcf/mpc_std_lib/oram/IObliviousDeltaCalculatorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/ISinglePointArrayGeneratorFactory.h"
@@ -21,18 +22,21 @@ class SinglePointArrayGeneratorFactory final
   SinglePointArrayGeneratorFactory(
       bool firstShare,
       std::unique_ptr<IObliviousDeltaCalculatorFactory>
-          obliviousCalculatrFactory)
+          obliviousCalculatrFactory,
+      size_t threadCount = std::thread::hardware_concurrency())
       : firstShare_(firstShare),
-        obliviousCalculatrFactory_(std::move(obliviousCalculatrFactory)) {}
+        obliviousCalculatrFactory_(std::move(obliviousCalculatrFactory)),
+        threadCount_(threadCount) {}
 
   std::unique_ptr<ISinglePointArrayGenerator> create() override {
     return std::make_unique<SinglePointArrayGenerator>(
-        firstShare_, obliviousCalculatrFactory_->create());
+        firstShare_, obliviousCalculatrFactory_->create(), threadCount_);
   }
 
  private:
   bool firstShare_;
   std::unique_ptr<IObliviousDeltaCalculatorFactory> obliviousCalculatrFactory_;
+  size_t threadCount_;
 };
 
 } // namespace fbpcf::mpc_std_lib::oram
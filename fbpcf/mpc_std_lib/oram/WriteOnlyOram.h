@@ -64,7 +64,9 @@ class WriteOnlyOram final : public IWriteOnlyOram<T> {
   }
 
  private:
-  std::vector<std::vector<T>> generateMasks(
+  // the masks of the i-th batch element take positions [i * size_, (i + 1) *
+  // size_)
+  std::vector<T> generateMasks(
       const std::vector<std::vector<bool>>& indexShares,
       const std::vector<std::vector<bool>>& values) const;
 
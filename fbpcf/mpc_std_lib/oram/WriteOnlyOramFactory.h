@@ -10,6 +10,7 @@
 #include <memory>
 #include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
 #include "fbpcf/mpc_std_lib/oram/DifferenceCalculatorFactory.h"
+#include "fbpcf/mpc_std_lib/oram/DpfSinglePointArrayGeneratorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/IDifferenceCalculatorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/ISinglePointArrayGeneratorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/IWriteOnlyOramFactory.h"
@@ -94,4 +95,32 @@ std::unique_ptr<IWriteOnlyOramFactory<T>> getSecureWriteOnlyOramFactory(
           amIParty0, party0Id, party1Id));
 }
 
+/**
+ * A write-only ORAM whose single point arrays come from distributed point
+ * functions, see DpfSinglePointArrayGenerator. Its keys are generated in pools
+ * of at least keyPoolSize.
+ */
+template <typename T, int indicatorSumWidth, int schedulerId>
+std::unique_ptr<IWriteOnlyOramFactory<T>> getDpfWriteOnlyOramFactory(
+    bool amIParty0,
+    int32_t party0Id,
+    int32_t party1Id,
+    engine::communication::IPartyCommunicationAgentFactory& factory,
+    size_t keyPoolSize = 0) {
+  return std::make_unique<WriteOnlyOramFactory<T>>(
+      amIParty0 ? IWriteOnlyOram<T>::Role::Alice : IWriteOnlyOram<T>::Role::Bob,
+      amIParty0 ? party1Id : party0Id,
+      factory,
+      std::make_unique<DpfSinglePointArrayGeneratorFactory>(
+          amIParty0,
+          amIParty0 ? party1Id : party0Id,
+          factory,
+          std::make_unique<ObliviousDeltaCalculatorFactory<schedulerId>>(
+              amIParty0, party0Id, party1Id),
+          keyPoolSize),
+      std::make_unique<
+          DifferenceCalculatorFactory<T, indicatorSumWidth, schedulerId>>(
+          amIParty0, party0Id, party1Id));
+}
+
 } // namespace fbpcf::mpc_std_lib::oram
@@ -60,27 +60,30 @@ void WriteOnlyOram<T>::obliviousAddBatch(
     }
   }
   auto masks = generateMasks(indexShares, values);
-  for (auto& item : masks) {
-    if (item.size() != size_) {
-      throw std::runtime_error("unexpected mask size");
-    }
-    for (size_t i = 0; i < size_; i++) {
-      // a vector of T may not support memory_[i]+= item.at(i), e.g. T = bool
-      memory_[i] = memory_.at(i) + item.at(i);
+  if (masks.size() != batchSize * size_) {
+    throw std::runtime_error("unexpected mask size");
+  }
+  for (size_t i = 0; i < batchSize; i++) {
+    for (size_t j = 0; j < size_; j++) {
+      // a vector of T may not support memory_[j]+= masks.at(i), e.g. T = bool
+      memory_[j] = memory_.at(j) + masks.at(i * size_ + j);
     }
   }
 }
 
 template <typename T>
-std::vector<std::vector<T>> WriteOnlyOram<T>::generateMasks(
+std::vector<T> WriteOnlyOram<T>::generateMasks(
     const std::vector<std::vector<bool>>& indexShares,
     const std::vector<std::vector<bool>>& values) const {
   size_t batchSize = values.at(0).size();
 
   auto indicatorKeyPairs =
-      generator_->generateSinglePointArrays(indexShares, size_);
+      generator_->generateFlatSinglePointArrays(indexShares, size_);
+  if (indicatorKeyPairs.keys.size() != batchSize * size_) {
+    throw std::runtime_error("unexpected single point array size");
+  }
 
-  std::vector<std::vector<T>> rst(batchSize, std::vector<T>(size_));
+  std::vector<T> rst(batchSize * size_);
   std::vector<uint32_t> indicatorShares(batchSize);
   std::vector<T> subtrahendShares(batchSize);
 
@@ -93,21 +96,19 @@ std::vector<std::vector<T>> WriteOnlyOram<T>::generateMasks(
     // However we don't know the secret index. So we calculate the difference of
     // the sums and obliviously pick the ONLY one that differs between two
     // parties.
-    for (size_t j = 0; j < size_; j++) {
-      rst[i][j] = util::Adapters<T>::generateFromKey(
-          indicatorKeyPairs.at(i).second.at(j));
-      subtrahendShares[i] = subtrahendShares[i] + rst.at(i).at(j);
-      indicatorShares[i] += indicatorKeyPairs.at(i).first.at(j);
+    for (size_t j = i * size_; j < (i + 1) * size_; j++) {
+      rst[j] = util::Adapters<T>::generateFromKey(indicatorKeyPairs.keys.at(j));
+      subtrahendShares[i] = subtrahendShares[i] + rst.at(j);
+      indicatorShares[i] += indicatorKeyPairs.indicators.at(j);
     }
   }
 
   auto difference = calculator_->calculateDifferenceBatch(
       indicatorShares, values, subtrahendShares);
   for (size_t i = 0; i < batchSize; i++) {
-    for (size_t j = 0; j < size_; j++) {
-      bool indicator = indicatorKeyPairs.at(i).first.at(j);
-      if (indicator) {
-        rst[i][j] = rst[i][j] + difference.at(i);
+    for (size_t j = i * size_; j < (i + 1) * size_; j++) {
+      if (indicatorKeyPairs.indicators.at(j)) {
+        rst[j] = rst[j] + difference.at(i);
       }
     }
   }
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "fbpcf/engine/communication/test/AgentFactoryCreationHelper.h"
+#include "fbpcf/mpc_std_lib/oram/ReadWriteOramFactory.h"
+#include "fbpcf/mpc_std_lib/oram/test/util.h"
+
+namespace fbpcf::mpc_std_lib::oram {
+
+// XOR-share width bits of each value between the two parties.
+std::pair<std::vector<std::vector<bool>>, std::vector<std::vector<bool>>>
+shareValues(const std::vector<uint64_t>& values, size_t width) {
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::vector<std::vector<bool>> shares0(
+      width, std::vector<bool>(values.size()));
+  std::vector<std::vector<bool>> shares1(
+      width, std::vector<bool>(values.size()));
+  for (size_t i = 0; i < width; i++) {
+    for (size_t j = 0; j < values.size(); j++) {
+      shares0[i][j] = e() & 1;
+      shares1[i][j] = shares0.at(i).at(j) ^ ((values.at(j) >> i) & 1);
+    }
+  }
+  return {shares0, shares1};
+}
+
+std::vector<uint64_t> revealValues(
+    const std::vector<std::vector<bool>>& shares0,
+    const std::vector<std::vector<bool>>& shares1) {
+  std::vector<uint64_t> rst(shares0.at(0).size(), 0);
+  for (size_t i = 0; i < shares0.size(); i++) {
+    for (size_t j = 0; j < rst.size(); j++) {
+      rst[j] |= (uint64_t)(shares0.at(i).at(j) ^ shares1.at(i).at(j)) << i;
+    }
+  }
+  return rst;
+}
+
+struct Access {
+  bool isWrite;
+  std::vector<std::vector<bool>> indexShares;
+  std::vector<std::vector<bool>> valueShares;
+};
+
+std::vector<std::vector<std::vector<bool>>> readWriteOramHelper(
+    std::unique_ptr<IReadWriteOramFactory> factory,
+    size_t oramSize,
+    const std::vector<std::vector<bool>>& initialValues,
+    const std::vector<Access>& accesses) {
+  auto oram = factory->create(oramSize);
+  if (!initialValues.empty()) {
+    oram->initialize(initialValues);
+  }
+  std::vector<std::vector<std::vector<bool>>> rst;
+  for (auto& access : accesses) {
+    if (access.isWrite) {
+      oram->obliviousWriteBatch(access.indexShares, access.valueShares);
+    } else {
+      rst.push_back(oram->obliviousReadBatch(access.indexShares));
+    }
+  }
+  return rst;
+}
+
+void testReadWriteOram(bool withInitialValues) {
+  auto factories = engine::communication::getInMemoryAgentFactory(2);
+  setupRealBackend<0, 1>(*factories[0], *factories[1]);
+
+  const size_t oramSize = 37;
+  const size_t indexWidth = 6;
+  const size_t valueWidth = 20;
+  const size_t stashCapacity = 7;
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+
+  std::vector<uint64_t> expectedMemory(oramSize, 0);
+  std::vector<std::vector<bool>> initialValues0;
+  std::vector<std::vector<bool>> initialValues1;
+  if (withInitialValues) {
+    for (auto& item : expectedMemory) {
+      item = e() & ((1 << valueWidth) - 1);
+    }
+    std::tie(initialValues0, initialValues1) =
+        shareValues(expectedMemory, valueWidth);
+  }
+
+  std::vector<Access> accesses0;
+  std::vector<Access> accesses1;
+  std::vector<std::vector<uint64_t>> expectedReads;
+  for (size_t round = 0; round < 12; round++) {
+    bool isWrite = round % 2 == 0;
+    std::vector<uint64_t> indexes(oramSize);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    std::shuffle(indexes.begin(), indexes.end(), e);
+    indexes.resize(isWrite ? 3 : 9);
+
+    auto [indexShares0, indexShares1] = shareValues(indexes, indexWidth);
+    std::vector<uint64_t> values(indexes.size());
+    for (size_t i = 0; i < indexes.size(); i++) {
+      if (isWrite) {
+        values[i] = e() & ((1 << valueWidth) - 1);
+        expectedMemory[indexes.at(i)] = values.at(i);
+      } else {
+        values[i] = expectedMemory.at(indexes.at(i));
+      }
+    }
+    auto [valueShares0, valueShares1] = shareValues(values, valueWidth);
+    accesses0.push_back({isWrite, indexShares0, valueShares0});
+    accesses1.push_back({isWrite, indexShares1, valueShares1});
+    if (!isWrite) {
+      expectedReads.push_back(values);
+    }
+  }
+
+  auto future0 = std::async(
+      readWriteOramHelper,
+      getSecureReadWriteOramFactory<0>(
+          true, 0, 1, valueWidth, *factories[0], stashCapacity),
+      oramSize,
+      std::cref(initialValues0),
+      std::cref(accesses0));
+  auto future1 = std::async(
+      readWriteOramHelper,
+      getSecureReadWriteOramFactory<1>(
+          false, 0, 1, valueWidth, *factories[1], stashCapacity),
+      oramSize,
+      std::cref(initialValues1),
+      std::cref(accesses1));
+  auto result0 = future0.get();
+  auto result1 = future1.get();
+
+  ASSERT_EQ(result0.size(), expectedReads.size());
+  ASSERT_EQ(result1.size(), expectedReads.size());
+  for (size_t i = 0; i < expectedReads.size(); i++) {
+    EXPECT_EQ(revealValues(result0.at(i), result1.at(i)), expectedReads.at(i));
+  }
+}
+
+TEST(ReadWriteOramTest, testReadWriteOram) {
+  testReadWriteOram(false);
+}
+
+TEST(ReadWriteOramTest, testReadWriteOramWithInitialValues) {
+  testReadWriteOram(true);
+}
+
+} // namespace fbpcf::mpc_std_lib::oram
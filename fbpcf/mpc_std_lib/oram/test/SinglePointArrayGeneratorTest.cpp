@@ -17,6 +17,7 @@
 #include <random>
 
 #include "fbpcf/engine/communication/test/AgentFactoryCreationHelper.h"
+#include "fbpcf/mpc_std_lib/oram/DpfSinglePointArrayGeneratorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/DummyObliviousDeltaCalculatorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/DummySinglePointArrayGenerator.h"
 #include "fbpcf/mpc_std_lib/oram/DummySinglePointArrayGeneratorFactory.h"
@@ -132,4 +133,113 @@ TEST(
   testSinglePointArrayGenerator(std::move(factory0), std::move(factory1));
 }
 
+TEST(
+    SinglePointArrayGeneratorTest,
+    testDpfSinglePointArrayGeneratorWithDummyObliviousDeltaCalculator) {
+  auto factories = engine::communication::getInMemoryAgentFactory(2);
+  auto factory0 = std::make_unique<DpfSinglePointArrayGeneratorFactory>(
+      true,
+      1,
+      *factories[0],
+      std::make_unique<insecure::DummyObliviousDeltaCalculatorFactory>(
+          1, *factories[0]));
+  auto factory1 = std::make_unique<DpfSinglePointArrayGeneratorFactory>(
+      false,
+      0,
+      *factories[1],
+      std::make_unique<insecure::DummyObliviousDeltaCalculatorFactory>(
+          0, *factories[1]));
+  testSinglePointArrayGenerator(std::move(factory0), std::move(factory1));
+}
+
+TEST(
+    SinglePointArrayGeneratorTest,
+    testDpfSinglePointArrayGeneratorWithObliviousDeltaCalculator) {
+  auto factories = engine::communication::getInMemoryAgentFactory(2);
+  setupRealBackend<0, 1>(*factories[0], *factories[1]);
+
+  auto factory0 = std::make_unique<DpfSinglePointArrayGeneratorFactory>(
+      true,
+      1,
+      *factories[0],
+      std::make_unique<ObliviousDeltaCalculatorFactory<0>>(true, 0, 1));
+  auto factory1 = std::make_unique<DpfSinglePointArrayGeneratorFactory>(
+      false,
+      0,
+      *factories[1],
+      std::make_unique<ObliviousDeltaCalculatorFactory<1>>(false, 0, 1));
+  testSinglePointArrayGenerator(std::move(factory0), std::move(factory1));
+}
+
+TEST(SinglePointArrayGeneratorTest, testFlatSinglePointArraysWithThreads) {
+  auto factories = engine::communication::getInMemoryAgentFactory(2);
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint32_t> dist(8192, 16384);
+
+  size_t length = dist(e);
+  size_t width = std::ceil(std::log2(length));
+  size_t batchSize = 64;
+
+  std::vector<std::vector<bool>> party0Input(
+      width, std::vector<bool>(batchSize));
+  std::vector<std::vector<bool>> party1Input(
+      width, std::vector<bool>(batchSize));
+  std::vector<uint32_t> expectedIndex;
+  for (size_t i = 0; i < batchSize; i++) {
+    auto [share0, share1, trueValue] =
+        util::generateSharedRandomBoolVectorForSinglePointArrayGenerator(
+            length);
+    for (size_t j = 0; j < width; j++) {
+      party0Input[j][i] = share0.at(j);
+      party1Input[j][i] = share1.at(j);
+    }
+    expectedIndex.push_back(trueValue);
+  }
+
+  auto task = [length](
+                  std::unique_ptr<ISinglePointArrayGenerator> generator,
+                  const std::vector<std::vector<bool>>& indexShares) {
+    return generator->generateFlatSinglePointArrays(indexShares, length);
+  };
+  auto future0 = std::async(
+      task,
+      std::make_unique<SinglePointArrayGenerator>(
+          true,
+          std::make_unique<insecure::DummyObliviousDeltaCalculatorFactory>(
+              1, *factories[0])
+              ->create(),
+          4),
+      std::cref(party0Input));
+  auto future1 = std::async(
+      task,
+      std::make_unique<SinglePointArrayGenerator>(
+          false,
+          std::make_unique<insecure::DummyObliviousDeltaCalculatorFactory>(
+              0, *factories[1])
+              ->create(),
+          3),
+      std::cref(party1Input));
+
+  auto result0 = future0.get();
+  auto result1 = future1.get();
+
+  EXPECT_EQ(result0.length, length);
+  EXPECT_EQ(result1.length, length);
+  ASSERT_EQ(result0.keys.size(), batchSize * length);
+  ASSERT_EQ(result1.keys.size(), batchSize * length);
+  for (size_t i = 0; i < batchSize; i++) {
+    for (size_t j = 0; j < length; j++) {
+      auto position = i * length + j;
+      bool isPoint = j == expectedIndex.at(i);
+      EXPECT_EQ(
+          result0.indicators.at(position) != result1.indicators.at(position),
+          isPoint);
+      EXPECT_EQ(
+          compareM128i(result0.keys.at(position), result1.keys.at(position)),
+          !isPoint);
+    }
+  }
+}
+
 } // namespace fbpcf::mpc_std_lib::oram
@@ -227,6 +227,34 @@ TEST(WriteOnlyORAMTest, TestWriteOnlyORAMWithSecureComponents) {
       *factories[0], *factories[1]);
 }
 
+template <typename T>
+void runDpfOramTestWithSecureComponents(
+    engine::communication::IPartyCommunicationAgentFactory& agentFactory0,
+    engine::communication::IPartyCommunicationAgentFactory& agentFactory1) {
+  const int8_t indicatorSumWidth = 12;
+  // a pool larger than the batch leaves keys for later batches
+  const size_t keyPoolSize = 1000;
+
+  auto factory0 = getDpfWriteOnlyOramFactory<T, indicatorSumWidth, 0>(
+      true, 0, 1, agentFactory0, keyPoolSize);
+
+  auto factory1 = getDpfWriteOnlyOramFactory<T, indicatorSumWidth, 1>(
+      false, 0, 1, agentFactory1, keyPoolSize);
+
+  size_t oramSize = 30;
+  testWriteOnlyOram<T>(std::move(factory0), std::move(factory1), oramSize);
+}
+
+TEST(WriteOnlyORAMTest, TestDpfWriteOnlyORAMWithSecureComponents) {
+  auto factories = engine::communication::getInMemoryAgentFactory(2);
+  setupRealBackend<0, 1>(*factories[0], *factories[1]);
+
+  runDpfOramTestWithSecureComponents<util::TestIntp>(
+      *factories[0], *factories[1]);
+  runDpfOramTestWithSecureComponents<util::AggregationValue>(
+      *factories[0], *factories[1]);
+}
+
 template <typename T>
 void runLinearOramTestWithSecureComponents(
     engine::communication::IPartyCommunicationAgentFactory& agentFactory0,
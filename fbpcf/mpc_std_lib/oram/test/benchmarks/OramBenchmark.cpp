@@ -6,17 +6,22 @@
  */
 
 #include <folly/Benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
 
 #include "common/init/Init.h"
 
 #include "fbpcf/engine/util/test/benchmarks/BenchmarkHelper.h"
 #include "fbpcf/engine/util/test/benchmarks/NetworkedBenchmark.h"
+#include "fbpcf/frontend/Bit.h"
 #include "fbpcf/mpc_std_lib/oram/DifferenceCalculatorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/IDifferenceCalculatorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/ISinglePointArrayGenerator.h"
 #include "fbpcf/mpc_std_lib/oram/IWriteOnlyOram.h"
 #include "fbpcf/mpc_std_lib/oram/LinearOramFactory.h"
 #include "fbpcf/mpc_std_lib/oram/ObliviousDeltaCalculatorFactory.h"
+#include "fbpcf/mpc_std_lib/oram/ReadWriteOramFactory.h"
 #include "fbpcf/mpc_std_lib/oram/SinglePointArrayGeneratorFactory.h"
 #include "fbpcf/mpc_std_lib/oram/WriteOnlyOramFactory.h"
 #include "fbpcf/mpc_std_lib/util/test/util.h"
@@ -251,13 +256,19 @@ class BaseWriteOnlyOramBenchmark : public engine::util::NetworkedBenchmark {
     agentFactory0_ = std::move(agentFactory0);
     agentFactory1_ = std::move(agentFactory1);
 
-    auto batchSize = 2048;
     auto [input0, input1, _] =
-        util::generateRandomValuesToAdd<uint32_t>(oramSize_, batchSize);
+        util::generateRandomValuesToAdd<uint32_t>(oramSize_, batchSize_);
     input0_ = input0;
     input1_ = input1;
   }
 
+  // Every element of a batch expands into an array of the ORAM size, so larger
+  // ORAMs are measured with smaller batches.
+  void setOramSize(size_t oramSize) {
+    oramSize_ = oramSize;
+    batchSize_ = std::clamp<size_t>((1 << 22) / oramSize, 1, 2048);
+  }
+
  protected:
   void initSender() override {
     scheduler::SchedulerKeeper<0>::setScheduler(
@@ -305,6 +316,7 @@ class BaseWriteOnlyOramBenchmark : public engine::util::NetworkedBenchmark {
       agentFactory1_;
 
   size_t oramSize_ = 150;
+  size_t batchSize_ = 2048;
 
  private:
   std::unique_ptr<IWriteOnlyOram<uint32_t>> sender_;
@@ -382,6 +394,87 @@ BENCHMARK_COUNTERS(WriteOnlyOramSecretRead_Benchmark, counters) {
   benchmark.runBenchmark(counters);
 }
 
+class DpfWriteOnlyOramBenchmark : virtual public BaseWriteOnlyOramBenchmark {
+ protected:
+  std::unique_ptr<IWriteOnlyOramFactory<uint32_t>> getOramFactory(
+      bool amIParty0) override {
+    return amIParty0
+        ? getDpfWriteOnlyOramFactory<uint32_t, indicatorWidth, 0>(
+              true, 0, 1, *agentFactory0_)
+        : getDpfWriteOnlyOramFactory<uint32_t, indicatorWidth, 1>(
+              false, 0, 1, *agentFactory1_);
+  }
+};
+
+class DpfWriteOnlyOramObliviousAddBatchBenchmark
+    : public DpfWriteOnlyOramBenchmark,
+      public ObliviousAddBatchBenchmark {};
+
+BENCHMARK_COUNTERS(DpfWriteOnlyOramObliviousAddBatch_Benchmark, counters) {
+  DpfWriteOnlyOramObliviousAddBatchBenchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+// Compare both write-only ORAMs on ORAM sizes from 2^8 to 2^24.
+template <typename Benchmark>
+void runObliviousAddBatchBenchmark(
+    folly::UserCounters& counters,
+    size_t oramSize) {
+  Benchmark benchmark;
+  benchmark.setOramSize(oramSize);
+  benchmark.runBenchmark(counters);
+}
+
+BENCHMARK_COUNTERS(WriteOnlyOramObliviousAddBatch_2_8_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<WriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 8);
+}
+
+BENCHMARK_COUNTERS(DpfWriteOnlyOramObliviousAddBatch_2_8_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<DpfWriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 8);
+}
+
+BENCHMARK_COUNTERS(WriteOnlyOramObliviousAddBatch_2_12_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<WriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 12);
+}
+
+BENCHMARK_COUNTERS(DpfWriteOnlyOramObliviousAddBatch_2_12_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<DpfWriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 12);
+}
+
+BENCHMARK_COUNTERS(WriteOnlyOramObliviousAddBatch_2_16_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<WriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 16);
+}
+
+BENCHMARK_COUNTERS(DpfWriteOnlyOramObliviousAddBatch_2_16_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<DpfWriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 16);
+}
+
+BENCHMARK_COUNTERS(WriteOnlyOramObliviousAddBatch_2_20_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<WriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 20);
+}
+
+BENCHMARK_COUNTERS(DpfWriteOnlyOramObliviousAddBatch_2_20_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<DpfWriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 20);
+}
+
+BENCHMARK_COUNTERS(WriteOnlyOramObliviousAddBatch_2_24_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<WriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 24);
+}
+
+BENCHMARK_COUNTERS(DpfWriteOnlyOramObliviousAddBatch_2_24_Benchmark, counters) {
+  runObliviousAddBatchBenchmark<DpfWriteOnlyOramObliviousAddBatchBenchmark>(
+      counters, 1 << 24);
+}
+
 class LinearOramBenchmark : virtual public BaseWriteOnlyOramBenchmark {
  protected:
   std::unique_ptr<IWriteOnlyOramFactory<uint32_t>> getOramFactory(
@@ -416,6 +509,233 @@ BENCHMARK_COUNTERS(LinearOramSecretRead_Benchmark, counters) {
   LinearOramSecretReadBenchmark benchmark;
   benchmark.runBenchmark(counters);
 }
+
+class BaseReadWriteOramBenchmark : public engine::util::NetworkedBenchmark {
+ public:
+  void setup() override {
+    auto [agentFactory0, agentFactory1] =
+        engine::util::getSocketAgentFactories();
+    agentFactory0_ = std::move(agentFactory0);
+    agentFactory1_ = std::move(agentFactory1);
+
+    indexWidth_ = std::ceil(std::log2(oramSize_));
+    std::random_device rd;
+    std::mt19937_64 e(rd());
+    auto randomShares = [&e](size_t width, size_t count) {
+      std::vector<std::vector<bool>> rst(width, std::vector<bool>(count));
+      for (auto& row : rst) {
+        for (size_t i = 0; i < count; i++) {
+          row[i] = e() & 1;
+        }
+      }
+      return rst;
+    };
+    memory0_ = randomShares(valueWidth_, oramSize_);
+    memory1_ = randomShares(valueWidth_, oramSize_);
+    indexShares0_ = randomShares(indexWidth_, batchSize_);
+    indexShares1_ = randomShares(indexWidth_, batchSize_);
+    valueShares0_ = randomShares(valueWidth_, batchSize_);
+    valueShares1_ = randomShares(valueWidth_, batchSize_);
+  }
+
+ protected:
+  void initSender() override {
+    scheduler::SchedulerKeeper<0>::setScheduler(
+        scheduler::getLazySchedulerFactoryWithRealEngine(0, *agentFactory0_)
+            ->create());
+    initParty(true);
+  }
+
+  void runSender() override {
+    runMethod(true, indexShares0_, valueShares0_, memory0_);
+  }
+
+  void initReceiver() override {
+    scheduler::SchedulerKeeper<1>::setScheduler(
+        scheduler::getLazySchedulerFactoryWithRealEngine(1, *agentFactory1_)
+            ->create());
+    initParty(false);
+  }
+
+  void runReceiver() override {
+    runMethod(false, indexShares1_, valueShares1_, memory1_);
+  }
+
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() override {
+    return scheduler::SchedulerKeeper<0>::getTrafficStatistics();
+  }
+
+  virtual void initParty(bool amIParty0) = 0;
+
+  virtual void runMethod(
+      bool amIParty0,
+      const std::vector<std::vector<bool>>& indexShares,
+      const std::vector<std::vector<bool>>& valueShares,
+      const std::vector<std::vector<bool>>& memory) = 0;
+
+  std::unique_ptr<engine::communication::IPartyCommunicationAgentFactory>
+      agentFactory0_;
+  std::unique_ptr<engine::communication::IPartyCommunicationAgentFactory>
+      agentFactory1_;
+
+  size_t oramSize_ = 1 << 16;
+  size_t indexWidth_;
+  size_t valueWidth_ = 32;
+  size_t batchSize_ = 16;
+
+  std::vector<std::vector<bool>> memory0_;
+  std::vector<std::vector<bool>> memory1_;
+
+ private:
+  std::vector<std::vector<bool>> indexShares0_;
+  std::vector<std::vector<bool>> indexShares1_;
+  std::vector<std::vector<bool>> valueShares0_;
+  std::vector<std::vector<bool>> valueShares1_;
+};
+
+class ReadWriteOramBenchmark : public BaseReadWriteOramBenchmark {
+ protected:
+  void initParty(bool amIParty0) override {
+    auto& oram = amIParty0 ? sender_ : receiver_;
+    oram = amIParty0 ? getSecureReadWriteOramFactory<0>(
+                           true, 0, 1, valueWidth_, *agentFactory0_)
+                           ->create(oramSize_)
+                     : getSecureReadWriteOramFactory<1>(
+                           false, 0, 1, valueWidth_, *agentFactory1_)
+                           ->create(oramSize_);
+    oram->initialize(amIParty0 ? memory0_ : memory1_);
+  }
+
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() override {
+    auto schedulerTraffic =
+        scheduler::SchedulerKeeper<0>::getTrafficStatistics();
+    auto oramTraffic = sender_->getTrafficStatistics();
+    return {
+        schedulerTraffic.first + oramTraffic.first,
+        schedulerTraffic.second + oramTraffic.second};
+  }
+
+  std::unique_ptr<IReadWriteOram>& getOram(bool amIParty0) {
+    return amIParty0 ? sender_ : receiver_;
+  }
+
+ private:
+  std::unique_ptr<IReadWriteOram> sender_;
+  std::unique_ptr<IReadWriteOram> receiver_;
+};
+
+class ReadWriteOramReadBatchBenchmark : public ReadWriteOramBenchmark {
+ protected:
+  void runMethod(
+      bool amIParty0,
+      const std::vector<std::vector<bool>>& indexShares,
+      const std::vector<std::vector<bool>>&,
+      const std::vector<std::vector<bool>>&) override {
+    getOram(amIParty0)->obliviousReadBatch(indexShares);
+  }
+};
+
+BENCHMARK_COUNTERS(ReadWriteOramReadBatch_Benchmark, counters) {
+  ReadWriteOramReadBatchBenchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+class ReadWriteOramWriteBatchBenchmark : public ReadWriteOramBenchmark {
+ protected:
+  void runMethod(
+      bool amIParty0,
+      const std::vector<std::vector<bool>>& indexShares,
+      const std::vector<std::vector<bool>>& valueShares,
+      const std::vector<std::vector<bool>>&) override {
+    // indexes of a write batch must be distinct, write them one at a time
+    for (size_t i = 0; i < batchSize_; i++) {
+      std::vector<std::vector<bool>> index(indexWidth_, std::vector<bool>(1));
+      std::vector<std::vector<bool>> value(valueWidth_, std::vector<bool>(1));
+      for (size_t j = 0; j < indexWidth_; j++) {
+        index[j][0] = indexShares.at(j).at(i);
+      }
+      for (size_t j = 0; j < valueWidth_; j++) {
+        value[j][0] = valueShares.at(j).at(i);
+      }
+      getOram(amIParty0)->obliviousWriteBatch(index, value);
+    }
+  }
+};
+
+BENCHMARK_COUNTERS(ReadWriteOramWriteBatch_Benchmark, counters) {
+  ReadWriteOramWriteBatchBenchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+// The baseline a read-write ORAM replaces: compare the secret index with every
+// position in circuit and select the matching element.
+class LinearScanReadBatchBenchmark : public BaseReadWriteOramBenchmark {
+ protected:
+  void initParty(bool) override {}
+
+  void runMethod(
+      bool amIParty0,
+      const std::vector<std::vector<bool>>& indexShares,
+      const std::vector<std::vector<bool>>&,
+      const std::vector<std::vector<bool>>& memory) override {
+    if (amIParty0) {
+      linearScan<0>(true, indexShares, memory);
+    } else {
+      linearScan<1>(false, indexShares, memory);
+    }
+  }
+
+ private:
+  template <int schedulerId>
+  void linearScan(
+      bool amIParty0,
+      const std::vector<std::vector<bool>>& indexShares,
+      const std::vector<std::vector<bool>>& memory) {
+    using SecBit = frontend::Bit<true, schedulerId, true>;
+    // one batch holds every pair of a position and an index
+    size_t size = oramSize_ * batchSize_;
+    SecBit isEqual;
+    for (size_t i = 0; i < indexWidth_; i++) {
+      std::vector<bool> indexBit(size);
+      std::vector<bool> positionBit(size);
+      for (size_t j = 0; j < oramSize_; j++) {
+        std::copy(
+            indexShares.at(i).begin(),
+            indexShares.at(i).end(),
+            indexBit.begin() + j * batchSize_);
+        std::fill(
+            positionBit.begin() + j * batchSize_,
+            positionBit.begin() + (j + 1) * batchSize_,
+            amIParty0 && ((j >> i) & 1));
+      }
+      auto isBitEqual = !(SecBit(typename SecBit::ExtractedBit(indexBit)) ^
+                          SecBit(typename SecBit::ExtractedBit(positionBit)));
+      isEqual = i == 0 ? isBitEqual : isEqual & isBitEqual;
+    }
+    for (size_t i = 0; i < valueWidth_; i++) {
+      std::vector<bool> memoryBit(size);
+      for (size_t j = 0; j < oramSize_; j++) {
+        std::fill(
+            memoryBit.begin() + j * batchSize_,
+            memoryBit.begin() + (j + 1) * batchSize_,
+            memory.at(i).at(j));
+      }
+      auto selected = (SecBit(typename SecBit::ExtractedBit(memoryBit)) &
+                       isEqual)
+                          .extractBit()
+                          .getValue();
+      std::vector<bool> rst(batchSize_, false);
+      for (size_t j = 0; j < size; j++) {
+        rst[j % batchSize_] = rst.at(j % batchSize_) ^ selected.at(j);
+      }
+    }
+  }
+};
+
+BENCHMARK_COUNTERS(LinearScanReadBatch_Benchmark, counters) {
+  LinearScanReadBatchBenchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
 } // namespace fbpcf::mpc_std_lib::oram
 
 int main(int argc, char* argv[]) {
@@ -58,4 +58,91 @@ uint32_t AsWaksmanParameterCalculator::fillIntoSecondHalf(
   return findDualIndex(dualIndexAfterPermute);
 }
 
+AsWaksmanNetwork::AsWaksmanNetwork(size_t size) : size_(size) {
+  std::vector<size_t> blocks(1, size);
+  while (blocks.size() * 2 < size) {
+    levels_.push_back(blocks);
+    std::vector<size_t> subBlocks;
+    subBlocks.reserve(blocks.size() * 2);
+    for (auto block : blocks) {
+      subBlocks.push_back(block / 2);
+      subBlocks.push_back(block - block / 2);
+    }
+    blocks = std::move(subBlocks);
+  }
+  levels_.push_back(std::move(blocks));
+
+  auto layerCount = levels_.size() * 2 - 1;
+  firstIndexes_.resize(layerCount);
+  secondIndexes_.resize(layerCount);
+  mergingIndexes_.resize(layerCount);
+  for (size_t level = 0; level + 1 < levels_.size(); level++) {
+    addLayer(level, levels_.at(level), false);
+    addLayer(layerCount - 1 - level, levels_.at(level), true);
+  }
+  addLayer(levels_.size() - 1, levels_.back(), false);
+}
+
+void AsWaksmanNetwork::addLayer(
+    size_t layer,
+    const std::vector<size_t>& blocks,
+    bool isPost) {
+  auto firstIndexes = std::make_shared<std::vector<uint32_t>>();
+  auto secondIndexes = std::make_shared<std::vector<uint32_t>>();
+  size_t start = 0;
+  for (auto block : blocks) {
+    // the last items of the two halves are not swapped after the
+    // sub-networks
+    size_t swapCount = isPost ? (block - 1) / 2 : block / 2;
+    for (size_t i = 0; i < swapCount; i++) {
+      firstIndexes->push_back(start + i);
+      secondIndexes->push_back(start + block / 2 + i);
+    }
+    start += block;
+  }
+
+  auto swapCount = firstIndexes->size();
+  auto mergingIndexes = std::make_shared<std::vector<uint32_t>>(size_);
+  for (size_t i = 0; i < size_; i++) {
+    (*mergingIndexes)[i] = 2 * swapCount + i;
+  }
+  for (size_t i = 0; i < swapCount; i++) {
+    (*mergingIndexes)[firstIndexes->at(i)] = i;
+    (*mergingIndexes)[secondIndexes->at(i)] = swapCount + i;
+  }
+
+  firstIndexes_[layer] = std::move(firstIndexes);
+  secondIndexes_[layer] = std::move(secondIndexes);
+  mergingIndexes_[layer] = std::move(mergingIndexes);
+}
+
+std::vector<std::vector<bool>> AsWaksmanNetwork::getSwapConditions(
+    const std::vector<uint32_t>& order) const {
+  auto layerCount = getLayerCount();
+  std::vector<std::vector<bool>> rst(layerCount);
+  std::vector<std::vector<uint32_t>> orders(1, order);
+  for (size_t level = 0; level + 1 < levels_.size(); level++) {
+    std::vector<std::vector<uint32_t>> subOrders;
+    subOrders.reserve(orders.size() * 2);
+    for (auto& item : orders) {
+      AsWaksmanParameterCalculator calculator(item);
+      auto choice = calculator.getFirstSwapConditions();
+      rst[level].insert(rst[level].end(), choice.begin(), choice.end());
+      choice = calculator.getSecondSwapConditions();
+      auto& postLayer = rst[layerCount - 1 - level];
+      postLayer.insert(postLayer.end(), choice.begin(), choice.end());
+      subOrders.push_back(calculator.getFirstSubPermuteOrder());
+      subOrders.push_back(calculator.getSecondSubPermuteOrder());
+    }
+    orders = std::move(subOrders);
+  }
+  auto& middleLayer = rst[levels_.size() - 1];
+  for (auto& item : orders) {
+    if (item.size() == 2) {
+      middleLayer.push_back(item.at(0) == 1);
+    }
+  }
+  return rst;
+}
+
 } // namespace fbpcf::mpc_std_lib::permuter
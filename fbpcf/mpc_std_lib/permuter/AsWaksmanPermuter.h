@@ -7,16 +7,74 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 #include "fbpcf/mpc_std_lib/permuter/IPermuter.h"
 
 #include "fbpcf/mpc_std_lib/util/util.h"
 
 namespace fbpcf::mpc_std_lib::permuter {
 
+/**
+ * This object lays out an AS-Waksman network level by level. The recursion
+ * keeps every sub-network in place, the first half of a block is followed by
+ * its second half, so the swaps of all blocks at the same level form a single
+ * layer. A network with L levels has 2L - 1 layers: layer l holds the swaps
+ * before the sub-networks of level l, layer 2L - 2 - l the swaps after them,
+ * and the middle layer swaps the blocks of two items at the last level.
+ */
+class AsWaksmanNetwork {
+ public:
+  explicit AsWaksmanNetwork(size_t size);
+
+  size_t getLayerCount() const {
+    return firstIndexes_.size();
+  }
+
+  // the i-th swap of a layer exchanges the items at firstIndexes[i] and
+  // secondIndexes[i]
+  std::shared_ptr<std::vector<uint32_t>> getFirstIndexes(size_t layer) const {
+    return firstIndexes_.at(layer);
+  }
+
+  std::shared_ptr<std::vector<uint32_t>> getSecondIndexes(size_t layer) const {
+    return secondIndexes_.at(layer);
+  }
+
+  // put the swapped items back to their positions, from the first items of
+  // all swaps, followed by the second items and all items before the swaps.
+  std::shared_ptr<std::vector<uint32_t>> getMergingIndexes(size_t layer) const {
+    return mergingIndexes_.at(layer);
+  }
+
+  /**
+   * Compute the swap conditions of every layer to permute to an order.
+   * @param order the i-th output is the order[i]-th input
+   * @return the swap conditions of every layer, in the order of the swaps
+   */
+  std::vector<std::vector<bool>> getSwapConditions(
+      const std::vector<uint32_t>& order) const;
+
+ private:
+  void addLayer(size_t layer, const std::vector<size_t>& blocks, bool isPost);
+
+  size_t size_;
+  // the sizes of the blocks at every level, all blocks at the last level have
+  // at most two items
+  std::vector<std::vector<size_t>> levels_;
+  std::vector<std::shared_ptr<std::vector<uint32_t>>> firstIndexes_;
+  std::vector<std::shared_ptr<std::vector<uint32_t>>> secondIndexes_;
+  std::vector<std::shared_ptr<std::vector<uint32_t>>> mergingIndexes_;
+};
+
 /**
  * This permuter uses the AS-Waksman network to run oblivious permutation. Read
  * more about this network:  Bruno Beauquier, Eric Darrot. On Arbitrary Waksman
  * Networks and their Vulnerability. RR-3788, INRIA. 1999. inria-00072871f
+ * The network is evaluated layer by layer, each layer is a single batch of
+ * oblivious swaps, and the items are moved between layers by gathering.
  **/
 template <typename T, int schedulerId>
 class AsWaksmanPermuter final
@@ -35,20 +93,13 @@ class AsWaksmanPermuter final
       const std::vector<uint32_t>& order) const override;
 
  private:
-  std::pair<SecBatchType, SecBatchType> preSubPermutationSwap(
-      const SecBatchType& src,
-      frontend::Bit<true, schedulerId, true>&& firstSwapConditions,
-      size_t size) const;
-
-  SecBatchType postSubPermutationSwap(
-      SecBatchType&& src0,
-      SecBatchType&& src1,
-      frontend::Bit<true, schedulerId, true>&& secondSwapConditions,
-      size_t size) const;
-
-  SecBatchType processTwoElements(
+  // run the swaps of every layer of the network as one batch, the party
+  // conditionOwnerId provides the swap conditions.
+  SecBatchType evaluateNetwork(
       const SecBatchType& src,
-      frontend::Bit<true, schedulerId, true>&& swapConditions) const;
+      const AsWaksmanNetwork& network,
+      const std::vector<std::vector<bool>>& swapConditions,
+      int conditionOwnerId) const;
 
   int myId_;
   int partnerId_;
@@ -21,30 +21,12 @@ AsWaksmanPermuter<T, schedulerId>::permute_impl(
   if (size == 1) {
     return src;
   }
-  if (size == 2) {
-    std::vector<bool> placeHolder(1);
-    return processTwoElements(
-        src, frontend::Bit<true, schedulerId, true>(placeHolder, partnerId_));
+  AsWaksmanNetwork network(size);
+  std::vector<std::vector<bool>> placeHolders(network.getLayerCount());
+  for (size_t i = 0; i < placeHolders.size(); i++) {
+    placeHolders[i] = std::vector<bool>(network.getFirstIndexes(i)->size());
   }
-
-  std::vector<bool> placeHolder(size / 2);
-  frontend::Bit<true, schedulerId, true> firstSwapConditions(
-      placeHolder, partnerId_);
-
-  auto [first, second] =
-      preSubPermutationSwap(src, std::move(firstSwapConditions), size);
-  auto permutedFirst = permute_impl(std::move(first), size / 2);
-  auto permutedSecond = permute_impl(std::move(second), size - size / 2);
-
-  placeHolder.resize((size - 1) / 2);
-  frontend::Bit<true, schedulerId, true> secondSwapConditions(
-      placeHolder, partnerId_);
-
-  return postSubPermutationSwap(
-      std::move(permutedFirst),
-      std::move(permutedSecond),
-      std::move(secondSwapConditions),
-      size);
+  return evaluateNetwork(src, network, placeHolders, partnerId_);
 }
 
 template <typename T, int schedulerId>
@@ -56,119 +38,36 @@ AsWaksmanPermuter<T, schedulerId>::permute_impl(
   if (size == 1) {
     return src;
   }
-  if (size == 2) {
-    std::vector<bool> swapChoice(1, order.at(0) == 1);
-    return processTwoElements(
-        src, frontend::Bit<true, schedulerId, true>(swapChoice, myId_));
-  }
-  AsWaksmanParameterCalculator calculator(order);
-
-  frontend::Bit<true, schedulerId, true> firstSwapConditions(
-      calculator.getFirstSwapConditions(), myId_);
-
-  auto [first, second] =
-      preSubPermutationSwap(src, std::move(firstSwapConditions), size);
-
-  auto permutedFirst = permute_impl(
-      std::move(first), size / 2, calculator.getFirstSubPermuteOrder());
-
-  auto permutedSecond = permute_impl(
-      std::move(second),
-      size - size / 2,
-      calculator.getSecondSubPermuteOrder());
-
-  frontend::Bit<true, schedulerId, true> secondSwapConditions(
-      calculator.getSecondSwapConditions(), myId_);
-
-  return postSubPermutationSwap(
-      std::move(permutedFirst),
-      std::move(permutedSecond),
-      std::move(secondSwapConditions),
-      size);
-}
-
-template <typename T, int schedulerId>
-std::pair<
-    typename AsWaksmanPermuter<T, schedulerId>::SecBatchType,
-    typename AsWaksmanPermuter<T, schedulerId>::SecBatchType>
-AsWaksmanPermuter<T, schedulerId>::preSubPermutationSwap(
-    const SecBatchType& src,
-    frontend::Bit<true, schedulerId, true>&& firstSwapConditions,
-    size_t size) const {
-  // unbatch to 3 pieces if size is odd, 2 pieces if even
-  auto unbatchSize = std::make_shared<std::vector<uint32_t>>(2 + (size & 1));
-  (*unbatchSize)[0] = size / 2;
-  (*unbatchSize)[1] = size / 2;
-  if ((size & 1) == 1) {
-    (*unbatchSize)[2] = 1;
-  }
-  auto batches =
-      util::MpcAdapters<T, schedulerId>::unbatching(src, unbatchSize);
-  if ((size & 1) == 0) {
-    return util::MpcAdapters<T, schedulerId>::obliviousSwap(
-        std::move(batches[0]),
-        std::move(batches[1]),
-        std::move(firstSwapConditions));
-  } else {
-    auto [first, second] = util::MpcAdapters<T, schedulerId>::obliviousSwap(
-        std::move(batches[0]),
-        std::move(batches[1]),
-        std::move(firstSwapConditions));
-    auto fullSecond = util::MpcAdapters<T, schedulerId>::batchingWith(
-        std::move(second), {std::move(batches[2])});
-    return {first, fullSecond};
-  }
+  AsWaksmanNetwork network(size);
+  return evaluateNetwork(
+      src, network, network.getSwapConditions(order), myId_);
 }
 
 template <typename T, int schedulerId>
 typename AsWaksmanPermuter<T, schedulerId>::SecBatchType
-AsWaksmanPermuter<T, schedulerId>::postSubPermutationSwap(
-    SecBatchType&& src0,
-    SecBatchType&& src1,
-    frontend::Bit<true, schedulerId, true>&& secondSwapConditions,
-    size_t size) const {
-  auto unbatchSize = std::make_shared<std::vector<uint32_t>>(2);
-  (*unbatchSize)[0] = (size - 1) / 2;
-  (*unbatchSize)[1] = 1;
-  auto secondBatches =
-      util::MpcAdapters<T, schedulerId>::unbatching(src1, unbatchSize);
-  if ((size & 1) == 0) {
-    auto firstBatches =
-        util::MpcAdapters<T, schedulerId>::unbatching(src0, unbatchSize);
-    auto [first, second] = util::MpcAdapters<T, schedulerId>::obliviousSwap(
-        std::move(firstBatches[0]),
-        std::move(secondBatches[0]),
-        std::move(secondSwapConditions));
-    return util::MpcAdapters<T, schedulerId>::batchingWith(
-        first,
-        {std::move(firstBatches[1]),
-         std::move(second),
-         std::move(secondBatches[1])});
-  } else {
+AsWaksmanPermuter<T, schedulerId>::evaluateNetwork(
+    const SecBatchType& src,
+    const AsWaksmanNetwork& network,
+    const std::vector<std::vector<bool>>& swapConditions,
+    int conditionOwnerId) const {
+  auto rst = src;
+  for (size_t layer = 0; layer < network.getLayerCount(); layer++) {
+    if (swapConditions.at(layer).empty()) {
+      continue;
+    }
     auto [first, second] = util::MpcAdapters<T, schedulerId>::obliviousSwap(
-        std::move(src0),
-        std::move(secondBatches[0]),
-        std::move(secondSwapConditions));
-    return util::MpcAdapters<T, schedulerId>::batchingWith(
-        first, {std::move(second), std::move(secondBatches[1])});
+        util::MpcAdapters<T, schedulerId>::gathering(
+            rst, network.getFirstIndexes(layer)),
+        util::MpcAdapters<T, schedulerId>::gathering(
+            rst, network.getSecondIndexes(layer)),
+        frontend::Bit<true, schedulerId, true>(
+            swapConditions.at(layer), conditionOwnerId));
+    rst = util::MpcAdapters<T, schedulerId>::gathering(
+        util::MpcAdapters<T, schedulerId>::batchingWith(
+            first, {std::move(second), std::move(rst)}),
+        network.getMergingIndexes(layer));
   }
-}
-
-template <typename T, int schedulerId>
-typename AsWaksmanPermuter<T, schedulerId>::SecBatchType
-AsWaksmanPermuter<T, schedulerId>::processTwoElements(
-    const SecBatchType& src,
-    frontend::Bit<true, schedulerId, true>&& swapConditions) const {
-  auto unbatchSize = std::make_shared<std::vector<uint32_t>>(2);
-  (*unbatchSize)[0] = 1;
-  (*unbatchSize)[1] = 1;
-  auto batches =
-      util::MpcAdapters<T, schedulerId>::unbatching(src, unbatchSize);
-  auto [first, second] = util::MpcAdapters<T, schedulerId>::obliviousSwap(
-      std::move(batches[0]), std::move(batches[1]), swapConditions);
-
-  return util::MpcAdapters<T, schedulerId>::batchingWith(
-      first, {std::move(second)});
+  return rst;
 }
 
 } // namespace fbpcf::mpc_std_lib::permuter
@@ -60,12 +60,12 @@ void party1Task(
 
 void permuterTestWithEagerScheduler(
     IPermuterFactory<frontend::Bit<true, 0, true>>& permuterFactory0,
-    IPermuterFactory<frontend::Bit<true, 1, true>>& permuterFactory1) {
+    IPermuterFactory<frontend::Bit<true, 1, true>>& permuterFactory1,
+    size_t size) {
   auto agentFactories = engine::communication::getInMemoryAgentFactory(2);
   setupRealBackend<0, 1>(*agentFactories[0], *agentFactories[1]);
   auto permuter0 = permuterFactory0.create();
   auto permuter1 = permuterFactory1.create();
-  size_t size = 17;
   auto [originalData, order, expectedOutput] = getPermuterTestDataBinary(size);
   auto future0 =
       std::async(party0Task, std::move(permuter0), originalData, order);
@@ -79,14 +79,13 @@ void permuterTestWithEagerScheduler(
 
 void permuterTestWithLazyScheduler(
     IPermuterFactory<frontend::Bit<true, 0, true>>& permuterFactory0,
-    IPermuterFactory<frontend::Bit<true, 1, true>>& permuterFactory1) {
+    IPermuterFactory<frontend::Bit<true, 1, true>>& permuterFactory1,
+    size_t size) {
   auto agentFactories = engine::communication::getInMemoryAgentFactory(2);
   setupRealBackendWithLazyScheduler<0, 1>(
       *agentFactories[0], *agentFactories[1]);
   auto permuter0 = permuterFactory0.create();
   auto permuter1 = permuterFactory1.create();
-
-  size_t size = 17;
   auto [originalData, order, expectedOutput] = getPermuterTestDataBinary(size);
 
   auto future0 =
@@ -103,16 +102,18 @@ TEST(permuterTestBit, testDummyPermuter) {
   insecure::DummyPermuterFactory<bool, 0> factory0(0, 1);
   insecure::DummyPermuterFactory<bool, 1> factory1(1, 0);
 
-  permuterTestWithEagerScheduler(factory0, factory1);
-  permuterTestWithLazyScheduler(factory0, factory1);
+  permuterTestWithEagerScheduler(factory0, factory1, 17);
+  permuterTestWithLazyScheduler(factory0, factory1, 17);
 }
 
 TEST(permuterTestBit, testAsWaksmanPermuter) {
   AsWaksmanPermuterFactory<bool, 0> factory0(0, 1);
   AsWaksmanPermuterFactory<bool, 1> factory1(1, 0);
 
-  permuterTestWithEagerScheduler(factory0, factory1);
-  permuterTestWithLazyScheduler(factory0, factory1);
+  for (size_t size : {1, 2, 3, 17, 64, 100}) {
+    permuterTestWithEagerScheduler(factory0, factory1, size);
+    permuterTestWithLazyScheduler(factory0, factory1, size);
+  }
 }
 
 } // namespace fbpcf::mpc_std_lib::permuter
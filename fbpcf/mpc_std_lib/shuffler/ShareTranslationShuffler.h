@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fbpcf/engine/util/IPrg.h"
+#include "fbpcf/mpc_std_lib/shuffler/IShuffler.h"
+#include "fbpcf/mpc_std_lib/shuffler/ShareTranslator.h"
+#include "fbpcf/mpc_std_lib/util/secureRandomPermutation.h"
+#include "fbpcf/mpc_std_lib/util/util.h"
+
+namespace fbpcf::mpc_std_lib::shuffler {
+
+/**
+ * This shuffler lets each party permute the shares with a random permutation
+ * of its own through a share translator, instead of evaluating a permutation
+ * network with oblivious swaps. Both permutations take a constant number of
+ * rounds and traffic close to linear in the size of the values.
+ **/
+template <typename T, int schedulerId>
+class ShareTranslationShuffler final
+    : public IShuffler<typename util::SecBatchType<T, schedulerId>::type> {
+ public:
+  using SecBatchType = typename util::SecBatchType<T, schedulerId>::type;
+
+  ShareTranslationShuffler(
+      int myId,
+      int partnerId,
+      std::unique_ptr<ShareTranslator> translator,
+      std::unique_ptr<engine::util::IPrg> prg)
+      : myId_(myId),
+        partnerId_(partnerId),
+        translator_(std::move(translator)),
+        prg_(std::move(prg)) {}
+
+  SecBatchType shuffle(const SecBatchType& src, uint32_t size) const override {
+    auto shares = extractShares(src);
+    auto myRandomPermutation =
+        fbpcf::mpc_std_lib::util::secureRandomPermutation(size, *prg_);
+    if (myId_ < partnerId_) {
+      shares = translator_->permute(shares, myRandomPermutation);
+      shares = translator_->permute(shares, size);
+    } else {
+      shares = translator_->permute(shares, size);
+      shares = translator_->permute(shares, myRandomPermutation);
+    }
+    return recoverShares(shares);
+  }
+
+  /**
+   * Get the total amount of traffic transmitted by the share translator.
+   * @return a pair of (sent, received) data in bytes.
+   */
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() const {
+    return translator_->getTrafficStatistics();
+  }
+
+ private:
+  static std::vector<std::vector<bool>> extractShares(const SecBatchType& src) {
+    if constexpr (std::is_same_v<T, bool>) {
+      return {
+          util::MpcAdapters<T, schedulerId>::extractBatchSharedSecrets(src)};
+    } else {
+      return util::MpcAdapters<T, schedulerId>::extractBatchSharedSecrets(src);
+    }
+  }
+
+  static SecBatchType recoverShares(
+      const std::vector<std::vector<bool>>& shares) {
+    if constexpr (std::is_same_v<T, bool>) {
+      return util::MpcAdapters<T, schedulerId>::recoverBatchSharedSecrets(
+          shares.at(0));
+    } else {
+      return util::MpcAdapters<T, schedulerId>::recoverBatchSharedSecrets(
+          shares);
+    }
+  }
+
+  int myId_;
+  int partnerId_;
+  std::unique_ptr<ShareTranslator> translator_;
+  std::unique_ptr<engine::util::IPrg> prg_;
+};
+
+} // namespace fbpcf::mpc_std_lib::shuffler
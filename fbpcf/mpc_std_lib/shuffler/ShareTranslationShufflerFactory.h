@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/IRandomCorrelatedObliviousTransferFactory.h"
+#include "fbpcf/engine/util/AesPrgFactory.h"
+#include "fbpcf/engine/util/util.h"
+#include "fbpcf/mpc_std_lib/shuffler/IShufflerFactory.h"
+#include "fbpcf/mpc_std_lib/shuffler/ShareTranslationShuffler.h"
+#include "fbpcf/mpc_std_lib/walr_multiplication/util/COTWithRandomMessageFactory.h"
+
+namespace fbpcf::mpc_std_lib::shuffler {
+
+template <typename T, int schedulerId>
+class ShareTranslationShufflerFactory final
+    : public IShufflerFactory<
+          typename util::SecBatchType<T, schedulerId>::type> {
+ public:
+  ShareTranslationShufflerFactory(
+      int myId,
+      int partnerId,
+      engine::communication::IPartyCommunicationAgentFactory& agentFactory,
+      std::unique_ptr<engine::tuple_generator::oblivious_transfer::
+                          IRandomCorrelatedObliviousTransferFactory>
+          rcotFactory)
+      : myId_(myId),
+        partnerId_(partnerId),
+        agentFactory_(agentFactory),
+        cotFactory_(std::make_unique<walr::util::COTWithRandomMessageFactory>(
+            std::move(rcotFactory))) {}
+
+  std::unique_ptr<
+      IShuffler<typename util::SecBatchType<T, schedulerId>::type>>
+  create() override {
+    auto agent =
+        agentFactory_.create(partnerId_, "share_translation_shuffler_traffic");
+    // The OTs run by party0 as the sender are set up first.
+    std::unique_ptr<walr::util::COTWithRandomMessage> cotSender;
+    std::unique_ptr<walr::util::COTWithRandomMessage> cotReceiver;
+    if (myId_ < partnerId_) {
+      cotSender = createCotSender();
+      cotReceiver = createCotReceiver();
+    } else {
+      cotReceiver = createCotReceiver();
+      cotSender = createCotSender();
+    }
+    return std::make_unique<ShareTranslationShuffler<T, schedulerId>>(
+        myId_,
+        partnerId_,
+        std::make_unique<ShareTranslator>(
+            std::move(agent),
+            std::move(cotSender),
+            std::move(cotReceiver),
+            engine::util::AesPrgFactory().create(
+                engine::util::getRandomM128iFromSystemNoise())),
+        engine::util::AesPrgFactory().create(
+            engine::util::getRandomM128iFromSystemNoise()));
+  }
+
+ private:
+  std::unique_ptr<walr::util::COTWithRandomMessage> createCotSender() {
+    auto delta = engine::util::getRandomM128iFromSystemNoise();
+    engine::util::setLsbTo1(delta);
+    return cotFactory_->create(
+        delta,
+        agentFactory_.create(
+            partnerId_, "share_translation_shuffler_cot_sender_traffic"),
+        agentFactory_.create(
+            partnerId_, "share_translation_shuffler_rcot_sender_traffic"));
+  }
+
+  std::unique_ptr<walr::util::COTWithRandomMessage> createCotReceiver() {
+    return cotFactory_->create(
+        agentFactory_.create(
+            partnerId_, "share_translation_shuffler_cot_receiver_traffic"),
+        agentFactory_.create(
+            partnerId_, "share_translation_shuffler_rcot_receiver_traffic"));
+  }
+
+  int myId_;
+  int partnerId_;
+  engine::communication::IPartyCommunicationAgentFactory& agentFactory_;
+  std::unique_ptr<walr::util::COTWithRandomMessageFactory> cotFactory_;
+};
+
+} // namespace fbpcf::mpc_std_lib::shuffler
@@ -0,0 +1,538 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "fbpcf/mpc_std_lib/shuffler/ShareTranslator.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "fbpcf/mpc_std_lib/util/util.h"
+
+namespace fbpcf::mpc_std_lib::shuffler {
+
+namespace {
+
+// the depth of a tree with at least size leaves
+size_t getDepth(size_t size) {
+  size_t depth = 0;
+  while ((size_t(1) << depth) < size) {
+    depth++;
+  }
+  return depth;
+}
+
+} // namespace
+
+ShareTranslator::ShareTranslator(
+    std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent,
+    std::unique_ptr<walr::util::COTWithRandomMessage> cotSender,
+    std::unique_ptr<walr::util::COTWithRandomMessage> cotReceiver,
+    std::unique_ptr<engine::util::IPrg> prg)
+    : agent_(std::move(agent)),
+      cotSender_(std::move(cotSender)),
+      cotReceiver_(std::move(cotReceiver)),
+      prg_(std::move(prg)),
+      expander_(0 /* this index is not important, any PUBLIC CONSTANT works*/),
+      hashCipher_(engine::util::Aes::getFixedKey()) {}
+
+std::vector<std::vector<bool>> ShareTranslator::permute(
+    const std::vector<std::vector<bool>>& shares,
+    const std::vector<uint32_t>& order) {
+  auto size = order.size();
+  for (auto& item : shares) {
+    if (item.size() != size) {
+      throw std::invalid_argument("Inconsistent size.");
+    }
+  }
+  if (size < 2 || shares.empty()) {
+    return shares;
+  }
+  auto grid = getGrid(size, shares.size());
+  auto paddedSize = grid.rows * grid.columns;
+
+  // the padding items stay where they are
+  std::vector<uint32_t> paddedOrder(order);
+  paddedOrder.resize(paddedSize);
+  for (size_t i = size; i < paddedSize; i++) {
+    paddedOrder[i] = i;
+  }
+  auto localOrders = decompose(paddedOrder, grid);
+  auto blockSizes = getBlockSizes(grid);
+
+  // Learn the nodes of level t that are not on the path to the leaf at the
+  // position of the input: the XOR of the nodes on the other side.
+  std::vector<bool> choices;
+  for (size_t layer = 0; layer < 3; layer++) {
+    auto depth = getDepth(blockSizes.at(layer));
+    for (auto position : localOrders.at(layer)) {
+      for (size_t t = 0; t < depth; t++) {
+        choices.push_back(!((position >> (depth - 1 - t)) & 1));
+      }
+    }
+  }
+  auto pads = cotReceiver_->receive(choices);
+  hashCipher_.inPlaceHash(pads);
+  auto ciphertexts = agent_->receiveT<__m128i>(2 * choices.size());
+  std::vector<__m128i> siblingSums(choices.size());
+  for (size_t i = 0; i < choices.size(); i++) {
+    siblingSums[i] =
+        _mm_xor_si128(ciphertexts.at(2 * i + choices.at(i)), pads.at(i));
+  }
+
+  std::array<std::vector<__m128i>, 3> deltas;
+  size_t offset = 0;
+  for (size_t layer = 0; layer < 3; layer++) {
+    deltas[layer] = generateAsReceiver(
+        localOrders.at(layer),
+        blockSizes.at(layer),
+        grid,
+        siblingSums.data() + offset);
+    offset += paddedSize * getDepth(blockSizes.at(layer));
+  }
+
+  auto bitWidth = shares.size();
+  auto correction1 = receiveValues(grid, bitWidth);
+  auto correction2 = receiveValues(grid, bitWidth);
+  auto maskedShares = receiveValues(grid, bitWidth);
+
+  // chain the three layers into b = order(a) ^ delta
+  auto delta = transpose(deltas.at(0), grid.rows, grid.columns, grid.width);
+  xorInPlace(delta, correction1);
+  delta = permuteBlocks(delta, localOrders.at(1), grid.rows, grid.width);
+  xorInPlace(delta, deltas.at(1));
+  delta = transpose(delta, grid.columns, grid.rows, grid.width);
+  xorInPlace(delta, correction2);
+  delta = permuteBlocks(delta, localOrders.at(2), grid.columns, grid.width);
+  xorInPlace(delta, deltas.at(2));
+
+  // order(x ^ a) ^ delta = order(x) ^ b, where b is the new share of the other
+  // party.
+  auto values = toBlocks(shares, grid);
+  xorInPlace(values, maskedShares);
+  auto rst = permuteBlocks(values, paddedOrder, paddedSize, grid.width);
+  xorInPlace(rst, delta);
+  return fromBlocks(rst, grid, bitWidth, size);
+}
+
+std::vector<std::vector<bool>> ShareTranslator::permute(
+    const std::vector<std::vector<bool>>& shares,
+    size_t size) {
+  for (auto& item : shares) {
+    if (item.size() != size) {
+      throw std::invalid_argument("Inconsistent size.");
+    }
+  }
+  if (size < 2 || shares.empty()) {
+    return shares;
+  }
+  auto grid = getGrid(size, shares.size());
+  auto paddedSize = grid.rows * grid.columns;
+  auto blockSizes = getBlockSizes(grid);
+
+  size_t otCount = 0;
+  for (auto blockSize : blockSizes) {
+    otCount += paddedSize * getDepth(blockSize);
+  }
+  std::vector<__m128i> levelSums(2 * otCount);
+  std::array<std::pair<std::vector<__m128i>, std::vector<__m128i>>, 3>
+      correlations;
+  size_t offset = 0;
+  for (size_t layer = 0; layer < 3; layer++) {
+    correlations[layer] = generateAsSender(
+        blockSizes.at(layer), grid, levelSums.data() + 2 * offset);
+    offset += paddedSize * getDepth(blockSizes.at(layer));
+  }
+
+  auto [pads0, pads1] = cotSender_->send(otCount);
+  hashCipher_.inPlaceHash(pads0);
+  hashCipher_.inPlaceHash(pads1);
+  for (size_t i = 0; i < otCount; i++) {
+    levelSums[2 * i] = _mm_xor_si128(levelSums.at(2 * i), pads0.at(i));
+    levelSums[2 * i + 1] =
+        _mm_xor_si128(levelSums.at(2 * i + 1), pads1.at(i));
+  }
+  agent_->sendT(levelSums);
+
+  auto& [a0, b0] = correlations[0];
+  auto& [a1, b1] = correlations[1];
+  auto& [a2, b2] = correlations[2];
+  auto bitWidth = shares.size();
+
+  // The inputs of the next layer are the outputs of this layer.
+  auto correction1 = transpose(b0, grid.rows, grid.columns, grid.width);
+  xorInPlace(correction1, a1);
+  sendValues(correction1, grid, bitWidth);
+  auto correction2 = transpose(b1, grid.columns, grid.rows, grid.width);
+  xorInPlace(correction2, a2);
+  sendValues(correction2, grid, bitWidth);
+
+  auto maskedShares = toBlocks(shares, grid);
+  xorInPlace(maskedShares, a0);
+  sendValues(maskedShares, grid, bitWidth);
+
+  return fromBlocks(b2, grid, bitWidth, size);
+}
+
+std::pair<uint64_t, uint64_t> ShareTranslator::getTrafficStatistics() const {
+  auto senderTraffic = cotSender_->getTrafficStatistics();
+  auto receiverTraffic = cotReceiver_->getTrafficStatistics();
+  auto translatorTraffic = agent_->getTrafficStatistics();
+  return {
+      senderTraffic.first + receiverTraffic.first + translatorTraffic.first,
+      senderTraffic.second + receiverTraffic.second +
+          translatorTraffic.second};
+}
+
+ShareTranslator::Grid ShareTranslator::getGrid(
+    size_t size,
+    size_t bitWidth) {
+  size_t columns = size_t(1) << (getDepth(size) / 2);
+  Grid grid{(size + columns - 1) / columns, columns, (bitWidth + 127) / 128};
+  while (maskCiphers_.size() + 1 < grid.width) {
+    maskCiphers_.emplace_back(_mm_set_epi64x(2, maskCiphers_.size()));
+  }
+  return grid;
+}
+
+std::array<size_t, 3> ShareTranslator::getBlockSizes(const Grid& grid) {
+  return {grid.columns, grid.rows, grid.columns};
+}
+
+std::array<std::vector<uint32_t>, 3> ShareTranslator::decompose(
+    const std::vector<uint32_t>& order,
+    const Grid& grid) {
+  auto size = order.size();
+  std::vector<uint32_t> edges(size);
+  for (size_t i = 0; i < size; i++) {
+    edges[i] = i;
+  }
+  std::vector<uint32_t> color(size);
+  colorEdges(order, grid, edges, grid.columns, 0, color);
+
+  // The item from column c of input row i to output row j goes through column
+  // c of row i after the first layer and through row j of column c after the
+  // second one.
+  std::array<std::vector<uint32_t>, 3> rst{
+      std::vector<uint32_t>(size),
+      std::vector<uint32_t>(size),
+      std::vector<uint32_t>(size)};
+  for (size_t i = 0; i < size; i++) {
+    auto inputRow = order.at(i) / grid.columns;
+    auto outputRow = i / grid.columns;
+    auto c = color.at(i);
+    rst[0][inputRow * grid.columns + c] = order.at(i) % grid.columns;
+    rst[1][c * grid.rows + outputRow] = inputRow;
+    rst[2][i] = c;
+  }
+  return rst;
+}
+
+void ShareTranslator::colorEdges(
+    const std::vector<uint32_t>& order,
+    const Grid& grid,
+    const std::vector<uint32_t>& edges,
+    size_t degree,
+    uint32_t firstColor,
+    std::vector<uint32_t>& color) {
+  if (degree == 1) {
+    for (auto edge : edges) {
+      color[edge] = firstColor;
+    }
+    return;
+  }
+
+  // Pair up the edges at every input row and at every output row. Following
+  // the two kinds of pairs in turn walks cycles of even length, and every
+  // other edge of a cycle goes to the second half. Every row then has half of
+  // its edges in either half.
+  auto size = edges.size();
+  std::vector<uint32_t> inputPartner(size);
+  std::vector<uint32_t> outputPartner(size);
+  std::vector<int64_t> inputPending(grid.rows, -1);
+  std::vector<int64_t> outputPending(grid.rows, -1);
+  auto pairUp = [](int64_t& pending,
+                   std::vector<uint32_t>& partner,
+                   uint32_t edge) {
+    if (pending < 0) {
+      pending = edge;
+    } else {
+      partner[edge] = pending;
+      partner[pending] = edge;
+      pending = -1;
+    }
+  };
+  for (size_t i = 0; i < size; i++) {
+    pairUp(
+        inputPending[order.at(edges.at(i)) / grid.columns], inputPartner, i);
+    pairUp(outputPending[edges.at(i) / grid.columns], outputPartner, i);
+  }
+
+  std::vector<int8_t> half(size, -1);
+  for (size_t start = 0; start < size; start++) {
+    auto edge = start;
+    while (half.at(edge) < 0) {
+      half[edge] = 0;
+      half[inputPartner.at(edge)] = 1;
+      edge = outputPartner.at(inputPartner.at(edge));
+    }
+  }
+
+  std::vector<uint32_t> firstHalf;
+  std::vector<uint32_t> secondHalf;
+  firstHalf.reserve(size / 2);
+  secondHalf.reserve(size / 2);
+  for (size_t i = 0; i < size; i++) {
+    (half.at(i) == 0 ? firstHalf : secondHalf).push_back(edges.at(i));
+  }
+  colorEdges(order, grid, firstHalf, degree / 2, firstColor, color);
+  colorEdges(
+      order, grid, secondHalf, degree / 2, firstColor + degree / 2, color);
+}
+
+std::pair<std::vector<__m128i>, std::vector<__m128i>>
+ShareTranslator::generateAsSender(
+    size_t blockSize,
+    const Grid& grid,
+    __m128i* levelSums) {
+  auto paddedSize = grid.rows * grid.columns;
+  auto depth = getDepth(blockSize);
+  auto leafCount = size_t(1) << depth;
+  auto width = grid.width;
+  std::vector<__m128i> a(paddedSize * width, _mm_setzero_si128());
+  std::vector<__m128i> b(paddedSize * width, _mm_setzero_si128());
+
+  std::vector<__m128i> nodes;
+  std::vector<__m128i> children;
+  for (size_t block = 0; block < paddedSize / blockSize; block++) {
+    // the trees of all rows of the block are expanded level by level
+    nodes = prg_->getRandomM128i(blockSize);
+    for (size_t t = 0; t < depth; t++) {
+      children.resize(nodes.size() * 2);
+      expander_.expand(nodes.data(), nodes.size(), children.data());
+      std::swap(nodes, children);
+      auto levelSize = size_t(2) << t;
+      for (size_t i = 0; i < blockSize; i++) {
+        auto sums = levelSums + 2 * ((block * blockSize + i) * depth + t);
+        sums[0] = _mm_setzero_si128();
+        sums[1] = _mm_setzero_si128();
+        for (size_t j = 0; j < levelSize; j++) {
+          sums[j & 1] = _mm_xor_si128(sums[j & 1], nodes.at(i * levelSize + j));
+        }
+      }
+    }
+
+    auto masks = expandLeaves(nodes, width);
+    for (size_t i = 0; i < blockSize; i++) {
+      auto rowSum = b.data() + (block * blockSize + i) * width;
+      for (size_t j = 0; j < blockSize; j++) {
+        auto columnSum = a.data() + (block * blockSize + j) * width;
+        auto mask = masks.data() + (i * leafCount + j) * width;
+        for (size_t k = 0; k < width; k++) {
+          rowSum[k] = _mm_xor_si128(rowSum[k], mask[k]);
+          columnSum[k] = _mm_xor_si128(columnSum[k], mask[k]);
+        }
+      }
+    }
+  }
+  return {std::move(a), std::move(b)};
+}
+
+std::vector<__m128i> ShareTranslator::generateAsReceiver(
+    const std::vector<uint32_t>& localOrder,
+    size_t blockSize,
+    const Grid& grid,
+    const __m128i* siblingSums) const {
+  auto paddedSize = grid.rows * grid.columns;
+  auto depth = getDepth(blockSize);
+  auto leafCount = size_t(1) << depth;
+  auto width = grid.width;
+  std::vector<__m128i> delta(paddedSize * width);
+
+  std::vector<__m128i> nodes;
+  std::vector<__m128i> children;
+  std::vector<size_t> path;
+  std::vector<__m128i> rowSums(blockSize * width);
+  std::vector<__m128i> columnSums(blockSize * width);
+  for (size_t block = 0; block < paddedSize / blockSize; block++) {
+    auto blockOrder = localOrder.data() + block * blockSize;
+    // The unknown node on the path is kept as 0. Its children are unknown as
+    // well, but its sibling is the XOR of the nodes on its side.
+    nodes.assign(blockSize, _mm_setzero_si128());
+    path.assign(blockSize, 0);
+    for (size_t t = 0; t < depth; t++) {
+      children.resize(nodes.size() * 2);
+      expander_.expand(nodes.data(), nodes.size(), children.data());
+      std::swap(nodes, children);
+      auto levelSize = size_t(2) << t;
+      for (size_t i = 0; i < blockSize; i++) {
+        auto level = nodes.data() + i * levelSize;
+        bool bit = (blockOrder[i] >> (depth - 1 - t)) & 1;
+        level[2 * path.at(i)] = _mm_setzero_si128();
+        level[2 * path.at(i) + 1] = _mm_setzero_si128();
+        auto sibling = siblingSums[(block * blockSize + i) * depth + t];
+        for (size_t j = !bit; j < levelSize; j += 2) {
+          sibling = _mm_xor_si128(sibling, level[j]);
+        }
+        level[2 * path.at(i) + !bit] = sibling;
+        path[i] = 2 * path.at(i) + bit;
+      }
+    }
+
+    auto masks = expandLeaves(nodes, width);
+    std::fill(rowSums.begin(), rowSums.end(), _mm_setzero_si128());
+    std::fill(columnSums.begin(), columnSums.end(), _mm_setzero_si128());
+    for (size_t i = 0; i < blockSize; i++) {
+      for (size_t j = 0; j < blockSize; j++) {
+        if (j == blockOrder[i]) {
+          continue;
+        }
+        auto mask = masks.data() + (i * leafCount + j) * width;
+        for (size_t k = 0; k < width; k++) {
+          rowSums[i * width + k] =
+              _mm_xor_si128(rowSums[i * width + k], mask[k]);
+          columnSums[j * width + k] =
+              _mm_xor_si128(columnSums[j * width + k], mask[k]);
+        }
+      }
+    }
+    for (size_t i = 0; i < blockSize; i++) {
+      for (size_t k = 0; k < width; k++) {
+        delta[(block * blockSize + i) * width + k] = _mm_xor_si128(
+            rowSums.at(i * width + k),
+            columnSums.at(blockOrder[i] * width + k));
+      }
+    }
+  }
+  return delta;
+}
+
+std::vector<__m128i> ShareTranslator::expandLeaves(
+    const std::vector<__m128i>& leaves,
+    size_t width) const {
+  std::vector<__m128i> rst(leaves.size() * width);
+  for (size_t i = 0; i < leaves.size(); i++) {
+    rst[i * width] = leaves.at(i);
+  }
+  std::vector<__m128i> tmp;
+  for (size_t k = 1; k < width; k++) {
+    tmp = leaves;
+    maskCiphers_.at(k - 1).encryptInPlace(tmp.data(), tmp.size());
+    for (size_t i = 0; i < leaves.size(); i++) {
+      rst[i * width + k] = _mm_xor_si128(tmp.at(i), leaves.at(i));
+    }
+  }
+  return rst;
+}
+
+std::vector<__m128i> ShareTranslator::toBlocks(
+    const std::vector<std::vector<bool>>& shares,
+    const Grid& grid) {
+  auto paddedSize = grid.rows * grid.columns;
+  std::vector<__m128i> rst(paddedSize * grid.width);
+  for (size_t k = 0; k < grid.width; k++) {
+    std::vector<std::vector<bool>> bits(128, std::vector<bool>(paddedSize));
+    for (size_t i = 0; i < 128 && k * 128 + i < shares.size(); i++) {
+      auto& share = shares.at(k * 128 + i);
+      std::copy(share.begin(), share.end(), bits[i].begin());
+    }
+    auto blocks = util::convertFromBits(bits);
+    for (size_t j = 0; j < paddedSize; j++) {
+      rst[j * grid.width + k] = blocks.at(j);
+    }
+  }
+  return rst;
+}
+
+std::vector<std::vector<bool>> ShareTranslator::fromBlocks(
+    const std::vector<__m128i>& blocks,
+    const Grid& grid,
+    size_t bitWidth,
+    size_t size) {
+  std::vector<std::vector<bool>> rst(bitWidth);
+  std::vector<__m128i> column(size);
+  for (size_t k = 0; k < grid.width; k++) {
+    for (size_t j = 0; j < size; j++) {
+      column[j] = blocks.at(j * grid.width + k);
+    }
+    auto bits = util::convertToBits(column);
+    for (size_t i = 0; i < 128 && k * 128 + i < bitWidth; i++) {
+      rst[k * 128 + i] = std::move(bits[i]);
+    }
+  }
+  return rst;
+}
+
+std::vector<__m128i> ShareTranslator::permuteBlocks(
+    const std::vector<__m128i>& src,
+    const std::vector<uint32_t>& localOrder,
+    size_t blockSize,
+    size_t width) {
+  std::vector<__m128i> rst(src.size());
+  for (size_t i = 0; i < localOrder.size(); i++) {
+    auto from = (i - i % blockSize + localOrder.at(i)) * width;
+    std::copy(
+        src.begin() + from,
+        src.begin() + from + width,
+        rst.begin() + i * width);
+  }
+  return rst;
+}
+
+std::vector<__m128i> ShareTranslator::transpose(
+    const std::vector<__m128i>& src,
+    size_t rows,
+    size_t columns,
+    size_t width) {
+  std::vector<__m128i> rst(src.size());
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t c = 0; c < columns; c++) {
+      auto from = (i * columns + c) * width;
+      std::copy(
+          src.begin() + from,
+          src.begin() + from + width,
+          rst.begin() + (c * rows + i) * width);
+    }
+  }
+  return rst;
+}
+
+void ShareTranslator::xorInPlace(
+    std::vector<__m128i>& dst,
+    const std::vector<__m128i>& src) {
+  for (size_t i = 0; i < dst.size(); i++) {
+    dst[i] = _mm_xor_si128(dst.at(i), src.at(i));
+  }
+}
+
+void ShareTranslator::sendValues(
+    const std::vector<__m128i>& src,
+    const Grid& grid,
+    size_t bitWidth) {
+  auto byteWidth = (bitWidth + 7) / 8;
+  auto count = grid.rows * grid.columns;
+  std::vector<unsigned char> buffer(count * byteWidth);
+  for (size_t i = 0; i < count; i++) {
+    std::memcpy(
+        buffer.data() + i * byteWidth, src.data() + i * grid.width, byteWidth);
+  }
+  agent_->send(buffer);
+}
+
+std::vector<__m128i> ShareTranslator::receiveValues(
+    const Grid& grid,
+    size_t bitWidth) {
+  auto byteWidth = (bitWidth + 7) / 8;
+  auto count = grid.rows * grid.columns;
+  auto buffer = agent_->receive(count * byteWidth);
+  std::vector<__m128i> rst(count * grid.width, _mm_setzero_si128());
+  for (size_t i = 0; i < count; i++) {
+    std::memcpy(
+        rst.data() + i * grid.width, buffer.data() + i * byteWidth, byteWidth);
+  }
+  return rst;
+}
+
+} // namespace fbpcf::mpc_std_lib::shuffler
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <emmintrin.h>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "fbpcf/engine/communication/IPartyCommunicationAgent.h"
+#include "fbpcf/engine/util/IPrg.h"
+#include "fbpcf/engine/util/aes.h"
+#include "fbpcf/engine/util/util.h"
+#include "fbpcf/mpc_std_lib/walr_multiplication/util/COTWithRandomMessage.h"
+
+namespace fbpcf::mpc_std_lib::shuffler {
+
+/**
+ * A share translator permutes XOR-shared values with a permutation known to
+ * one of the two parties, following the share translation of Chase, Ghosh and
+ * Poburinnaya (Secret-Shared Shuffle, ASIACRYPT'20).
+ * For a permutation sigma of B items, the party who knows sigma learns Delta
+ * and the other party learns a and b, such that b[i] = a[sigma[i]] ^ Delta[i].
+ * The other party expands a random GGM tree for every i, the party who knows
+ * sigma learns all leaves of tree i but the sigma[i]-th one through log(B)
+ * OTs. The leaf (i, j) is the mask of the j-th input at the i-th output: b[i]
+ * is the XOR of the masks of row i, a[j] the XOR of the masks of column j,
+ * and Delta[i] is the XOR of the masks of row i and column sigma[i] known to
+ * the party who knows sigma.
+ * A permutation of n items is split into three layers of permutations of
+ * blocks of about sqrt(n) items (a Clos network), the other party sends the
+ * XOR of the outputs of a layer and the inputs of the next one. Permuting the
+ * values then takes a single message of the XOR of its shares and a.
+ * The traffic is O(n log n) blocks for the OTs, independent of the width of
+ * the values, and three times the size of the values, in a constant number of
+ * rounds; the local work is O(n sqrt(n)) AES calls per 128 bits of value.
+ */
+class ShareTranslator {
+ public:
+  ShareTranslator(
+      std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent,
+      std::unique_ptr<walr::util::COTWithRandomMessage> cotSender,
+      std::unique_ptr<walr::util::COTWithRandomMessage> cotReceiver,
+      std::unique_ptr<engine::util::IPrg> prg);
+
+  /**
+   * Permute shared values with a permutation of this party.
+   * @param shares this party's shares of the values, one vector per bit
+   * @param order the permutation, the i-th output is the order[i]-th input
+   * @return this party's shares of the permuted values
+   */
+  std::vector<std::vector<bool>> permute(
+      const std::vector<std::vector<bool>>& shares,
+      const std::vector<uint32_t>& order);
+
+  /**
+   * Permute shared values with a permutation of the other party.
+   * @param shares this party's shares of the values, one vector per bit
+   * @param size the number of values
+   * @return this party's shares of the permuted values
+   */
+  std::vector<std::vector<bool>> permute(
+      const std::vector<std::vector<bool>>& shares,
+      size_t size);
+
+  /**
+   * Get the total amount of traffic transmitted.
+   * @return a pair of (sent, received) data in bytes.
+   */
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() const;
+
+ private:
+  // The values are padded into a grid of rows * columns items, where columns
+  // is a power of 2. The first and the last layers permute the rows, the
+  // middle layer permutes the columns.
+  struct Grid {
+    size_t rows;
+    size_t columns;
+    size_t width; // the number of blocks of each value
+  };
+
+  // this also prepares the ciphers for the masks of the values
+  Grid getGrid(size_t size, size_t bitWidth);
+
+  // the size of the blocks permuted by each layer
+  static std::array<size_t, 3> getBlockSizes(const Grid& grid);
+
+  // split a permutation of the grid into the permutations of the three
+  // layers, each mapping an output to an input in the same block.
+  static std::array<std::vector<uint32_t>, 3> decompose(
+      const std::vector<uint32_t>& order,
+      const Grid& grid);
+
+  // color the edges from the input row to the output row of every item, such
+  // that no two edges at a row share a color. Every row has degree edges.
+  static void colorEdges(
+      const std::vector<uint32_t>& order,
+      const Grid& grid,
+      const std::vector<uint32_t>& edges,
+      size_t degree,
+      uint32_t firstColor,
+      std::vector<uint32_t>& color);
+
+  // As the other party, compute a and b of a layer. The XORs of the left and
+  // of the right nodes at every level of every tree are written to levelSums.
+  std::pair<std::vector<__m128i>, std::vector<__m128i>> generateAsSender(
+      size_t blockSize,
+      const Grid& grid,
+      __m128i* levelSums);
+
+  // As the party who knows the permutation, compute Delta of a layer from the
+  // XOR of the nodes not on the path to the punctured leaf at every level.
+  std::vector<__m128i> generateAsReceiver(
+      const std::vector<uint32_t>& localOrder,
+      size_t blockSize,
+      const Grid& grid,
+      const __m128i* siblingSums) const;
+
+  // expand every leaf into the width blocks of a mask
+  std::vector<__m128i> expandLeaves(
+      const std::vector<__m128i>& leaves,
+      size_t width) const;
+
+  static std::vector<__m128i> toBlocks(
+      const std::vector<std::vector<bool>>& shares,
+      const Grid& grid);
+
+  static std::vector<std::vector<bool>> fromBlocks(
+      const std::vector<__m128i>& blocks,
+      const Grid& grid,
+      size_t bitWidth,
+      size_t size);
+
+  // the j-th output of a block is the localOrder[j]-th input of the block
+  static std::vector<__m128i> permuteBlocks(
+      const std::vector<__m128i>& src,
+      const std::vector<uint32_t>& localOrder,
+      size_t blockSize,
+      size_t width);
+
+  // src holds rows of columns items, the output holds the columns as rows
+  static std::vector<__m128i> transpose(
+      const std::vector<__m128i>& src,
+      size_t rows,
+      size_t columns,
+      size_t width);
+
+  static void xorInPlace(
+      std::vector<__m128i>& dst,
+      const std::vector<__m128i>& src);
+
+  // only the bytes holding the bits of the values are sent
+  void sendValues(
+      const std::vector<__m128i>& src,
+      const Grid& grid,
+      size_t bitWidth);
+
+  std::vector<__m128i> receiveValues(const Grid& grid, size_t bitWidth);
+
+  std::unique_ptr<engine::communication::IPartyCommunicationAgent> agent_;
+  std::unique_ptr<walr::util::COTWithRandomMessage> cotSender_;
+  std::unique_ptr<walr::util::COTWithRandomMessage> cotReceiver_;
+  std::unique_ptr<engine::util::IPrg> prg_;
+
+  engine::util::Expander expander_;
+  // hash the OT messages into pads
+  engine::util::Aes hashCipher_;
+  // derive all blocks of a mask but the first one from a leaf, one cipher
+  // per block
+  std::vector<engine::util::Aes> maskCiphers_;
+};
+
+} // namespace fbpcf::mpc_std_lib::shuffler
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "fbpcf/engine/communication/test/AgentFactoryCreationHelper.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/DummyRandomCorrelatedObliviousTransferFactory.h"
+#include "fbpcf/engine/util/AesPrgFactory.h"
+#include "fbpcf/engine/util/util.h"
+#include "fbpcf/mpc_std_lib/shuffler/ShareTranslator.h"
+#include "fbpcf/mpc_std_lib/walr_multiplication/util/COTWithRandomMessageFactory.h"
+
+namespace fbpcf::mpc_std_lib::shuffler {
+
+std::unique_ptr<ShareTranslator> createShareTranslator(
+    engine::communication::IPartyCommunicationAgentFactory& factory,
+    int partnerId,
+    bool isSenderFirst) {
+  walr::util::COTWithRandomMessageFactory cotFactory(
+      std::make_unique<engine::tuple_generator::oblivious_transfer::insecure::
+                           DummyRandomCorrelatedObliviousTransferFactory>());
+  auto agent = factory.create(partnerId, "share_translator_test_traffic");
+  auto createSender = [&]() {
+    auto delta = engine::util::getRandomM128iFromSystemNoise();
+    engine::util::setLsbTo1(delta);
+    return cotFactory.create(
+        delta,
+        factory.create(partnerId, "share_translator_test_cot_traffic"),
+        factory.create(partnerId, "share_translator_test_rcot_traffic"));
+  };
+  auto createReceiver = [&]() {
+    return cotFactory.create(
+        factory.create(partnerId, "share_translator_test_cot_traffic"),
+        factory.create(partnerId, "share_translator_test_rcot_traffic"));
+  };
+  std::unique_ptr<walr::util::COTWithRandomMessage> sender;
+  std::unique_ptr<walr::util::COTWithRandomMessage> receiver;
+  if (isSenderFirst) {
+    sender = createSender();
+    receiver = createReceiver();
+  } else {
+    receiver = createReceiver();
+    sender = createSender();
+  }
+  return std::make_unique<ShareTranslator>(
+      std::move(agent),
+      std::move(sender),
+      std::move(receiver),
+      engine::util::AesPrgFactory().create(
+          engine::util::getRandomM128iFromSystemNoise()));
+}
+
+void testShareTranslator(size_t size, size_t width) {
+  auto factories = engine::communication::getInMemoryAgentFactory(2);
+  auto translator0 = createShareTranslator(*factories[0], 1, true);
+  auto translator1 = createShareTranslator(*factories[1], 0, false);
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::vector<std::vector<bool>> values(width, std::vector<bool>(size));
+  std::vector<std::vector<bool>> shares0(width, std::vector<bool>(size));
+  std::vector<std::vector<bool>> shares1(width, std::vector<bool>(size));
+  for (size_t i = 0; i < width; i++) {
+    for (size_t j = 0; j < size; j++) {
+      values[i][j] = e() & 1;
+      shares0[i][j] = e() & 1;
+      shares1[i][j] = values.at(i).at(j) ^ shares0.at(i).at(j);
+    }
+  }
+  std::vector<uint32_t> order0(size);
+  std::iota(order0.begin(), order0.end(), 0);
+  std::shuffle(order0.begin(), order0.end(), e);
+  std::vector<uint32_t> order1(size);
+  std::iota(order1.begin(), order1.end(), 0);
+  std::shuffle(order1.begin(), order1.end(), e);
+
+  // party 0 permutes with order0 first, then party 1 permutes with order1
+  auto future0 = std::async([&]() {
+    auto rst = translator0->permute(shares0, order0);
+    return translator0->permute(rst, size);
+  });
+  auto future1 = std::async([&]() {
+    auto rst = translator1->permute(shares1, size);
+    return translator1->permute(rst, order1);
+  });
+  auto rst0 = future0.get();
+  auto rst1 = future1.get();
+
+  ASSERT_EQ(rst0.size(), width);
+  ASSERT_EQ(rst1.size(), width);
+  for (size_t i = 0; i < width; i++) {
+    ASSERT_EQ(rst0.at(i).size(), size);
+    ASSERT_EQ(rst1.at(i).size(), size);
+    for (size_t j = 0; j < size; j++) {
+      EXPECT_EQ(
+          rst0.at(i).at(j) ^ rst1.at(i).at(j),
+          values.at(i).at(order0.at(order1.at(j))));
+    }
+  }
+}
+
+TEST(ShareTranslatorTest, testPermute) {
+  testShareTranslator(2, 1);
+  testShareTranslator(3, 7);
+  testShareTranslator(16, 32);
+  testShareTranslator(37, 1);
+  testShareTranslator(100, 130);
+  testShareTranslator(1000, 64);
+}
+
+} // namespace fbpcf::mpc_std_lib::shuffler
@@ -14,11 +14,13 @@
 #include <unordered_map>
 
 #include "fbpcf/engine/communication/test/AgentFactoryCreationHelper.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/DummyRandomCorrelatedObliviousTransferFactory.h"
 #include "fbpcf/engine/util/AesPrgFactory.h"
 #include "fbpcf/mpc_std_lib/permuter/AsWaksmanPermuterFactory.h"
 #include "fbpcf/mpc_std_lib/permuter/DummyPermuterFactory.h"
 #include "fbpcf/mpc_std_lib/shuffler/NonShufflerFactory.h"
 #include "fbpcf/mpc_std_lib/shuffler/PermuteBasedShufflerFactory.h"
+#include "fbpcf/mpc_std_lib/shuffler/ShareTranslationShufflerFactory.h"
 #include "fbpcf/mpc_std_lib/util/test/util.h"
 #include "fbpcf/mpc_std_lib/util/util.h"
 #include "fbpcf/scheduler/SchedulerHelper.h"
@@ -108,4 +110,22 @@ TEST(shufflerTestBit, testPermuteBasedShufflerWithAsWaksmanPermuter) {
   shufflerTest(factory0, factory1);
 }
 
+TEST(shufflerTestBit, testShareTranslationShuffler) {
+  auto agentFactories = engine::communication::getInMemoryAgentFactory(2);
+  ShareTranslationShufflerFactory<bool, 0> factory0(
+      0,
+      1,
+      *agentFactories[0],
+      std::make_unique<engine::tuple_generator::oblivious_transfer::insecure::
+                           DummyRandomCorrelatedObliviousTransferFactory>());
+  ShareTranslationShufflerFactory<bool, 1> factory1(
+      1,
+      0,
+      *agentFactories[1],
+      std::make_unique<engine::tuple_generator::oblivious_transfer::insecure::
+                           DummyRandomCorrelatedObliviousTransferFactory>());
+
+  shufflerTest(factory0, factory1);
+}
+
 } // namespace fbpcf::mpc_std_lib::shuffler
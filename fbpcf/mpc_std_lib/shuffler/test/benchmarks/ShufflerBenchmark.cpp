@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <folly/Benchmark.h>
+#include <numeric>
+
+#include "common/init/Init.h"
+
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/ExtenderBasedRandomCorrelatedObliviousTransferFactory.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/IknpShRandomCorrelatedObliviousTransferFactory.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/NpBaseObliviousTransferFactory.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/ferret/RcotExtenderFactory.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/ferret/RegularErrorMultiPointCotFactory.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/ferret/SinglePointCotFactory.h"
+#include "fbpcf/engine/tuple_generator/oblivious_transfer/ferret/TenLocalLinearMatrixMultiplierFactory.h"
+#include "fbpcf/engine/util/AesPrgFactory.h"
+#include "fbpcf/engine/util/test/benchmarks/BenchmarkHelper.h"
+#include "fbpcf/engine/util/test/benchmarks/NetworkedBenchmark.h"
+#include "fbpcf/mpc_std_lib/permuter/AsWaksmanPermuterFactory.h"
+#include "fbpcf/mpc_std_lib/shuffler/IShuffler.h"
+#include "fbpcf/mpc_std_lib/shuffler/IShufflerFactory.h"
+#include "fbpcf/mpc_std_lib/shuffler/PermuteBasedShufflerFactory.h"
+#include "fbpcf/mpc_std_lib/shuffler/ShareTranslationShufflerFactory.h"
+#include "fbpcf/mpc_std_lib/util/util.h"
+#include "fbpcf/scheduler/IScheduler.h"
+#include "fbpcf/scheduler/LazySchedulerFactory.h"
+
+namespace fbpcf::mpc_std_lib::shuffler {
+
+const uint32_t batchSize = 10000;
+
+class BaseShufflerBenchmark : public engine::util::NetworkedBenchmark {
+ public:
+  void setup() override {
+    auto [agentFactory0, agentFactory1] =
+        engine::util::getSocketAgentFactories();
+    agentFactory0_ = std::move(agentFactory0);
+    agentFactory1_ = std::move(agentFactory1);
+
+    value_ = std::vector<uint32_t>(batchSize);
+    std::iota(value_.begin(), value_.end(), 0);
+
+    setupFactories();
+  }
+
+ protected:
+  virtual void setupFactories() = 0;
+
+  void initSender() override {
+    scheduler::SchedulerKeeper<0>::setScheduler(
+        scheduler::getLazySchedulerFactoryWithRealEngine(0, *agentFactory0_)
+            ->create());
+    shuffler0_ = factory0_->create();
+  }
+
+  void runSender() override {
+    auto secValue =
+        util::MpcAdapters<uint32_t, 0>::processSecretInputs(value_, 0);
+    auto shuffled = shuffler0_->shuffle(secValue, batchSize);
+    util::MpcAdapters<uint32_t, 0>::openToParty(shuffled, 0);
+  }
+
+  void initReceiver() override {
+    scheduler::SchedulerKeeper<1>::setScheduler(
+        scheduler::getLazySchedulerFactoryWithRealEngine(1, *agentFactory1_)
+            ->create());
+    shuffler1_ = factory1_->create();
+  }
+
+  void runReceiver() override {
+    auto secValue =
+        util::MpcAdapters<uint32_t, 1>::processSecretInputs(value_, 0);
+    auto shuffled = shuffler1_->shuffle(secValue, batchSize);
+    util::MpcAdapters<uint32_t, 1>::openToParty(shuffled, 0);
+  }
+
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() override {
+    return scheduler::SchedulerKeeper<0>::getTrafficStatistics();
+  }
+
+  std::unique_ptr<engine::communication::IPartyCommunicationAgentFactory>
+      agentFactory0_;
+  std::unique_ptr<engine::communication::IPartyCommunicationAgentFactory>
+      agentFactory1_;
+
+  std::unique_ptr<
+      IShufflerFactory<typename util::SecBatchType<uint32_t, 0>::type>>
+      factory0_;
+  std::unique_ptr<
+      IShufflerFactory<typename util::SecBatchType<uint32_t, 1>::type>>
+      factory1_;
+
+  std::unique_ptr<IShuffler<typename util::SecBatchType<uint32_t, 0>::type>>
+      shuffler0_;
+  std::unique_ptr<IShuffler<typename util::SecBatchType<uint32_t, 1>::type>>
+      shuffler1_;
+
+ private:
+  std::vector<uint32_t> value_;
+};
+
+class AsWaksmanShufflerBenchmark final : public BaseShufflerBenchmark {
+ protected:
+  void setupFactories() override {
+    factory0_ = std::make_unique<PermuteBasedShufflerFactory<
+        typename util::SecBatchType<uint32_t, 0>::type>>(
+        0,
+        1,
+        std::make_unique<permuter::AsWaksmanPermuterFactory<uint32_t, 0>>(
+            0, 1),
+        std::make_unique<engine::util::AesPrgFactory>());
+    factory1_ = std::make_unique<PermuteBasedShufflerFactory<
+        typename util::SecBatchType<uint32_t, 1>::type>>(
+        1,
+        0,
+        std::make_unique<permuter::AsWaksmanPermuterFactory<uint32_t, 1>>(
+            1, 0),
+        std::make_unique<engine::util::AesPrgFactory>());
+  }
+};
+
+BENCHMARK_COUNTERS(AsWaksmanShuffler_Benchmark, counters) {
+  AsWaksmanShufflerBenchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+class ShareTranslationShufflerBenchmark final : public BaseShufflerBenchmark {
+ protected:
+  void setupFactories() override {
+    factory0_ = std::make_unique<ShareTranslationShufflerFactory<uint32_t, 0>>(
+        0, 1, *agentFactory0_, getRcotFactory());
+    factory1_ = std::make_unique<ShareTranslationShufflerFactory<uint32_t, 1>>(
+        1, 0, *agentFactory1_, getRcotFactory());
+  }
+
+  std::pair<uint64_t, uint64_t> getTrafficStatistics() override {
+    auto schedulerTraffic =
+        scheduler::SchedulerKeeper<0>::getTrafficStatistics();
+    auto shufflerTraffic =
+        static_cast<ShareTranslationShuffler<uint32_t, 0>&>(*shuffler0_)
+            .getTrafficStatistics();
+    return {
+        schedulerTraffic.first + shufflerTraffic.first,
+        schedulerTraffic.second + shufflerTraffic.second};
+  }
+
+ private:
+  std::unique_ptr<engine::tuple_generator::oblivious_transfer::
+                      IRandomCorrelatedObliviousTransferFactory>
+  getRcotFactory() {
+    return std::make_unique<
+        engine::tuple_generator::oblivious_transfer::
+            ExtenderBasedRandomCorrelatedObliviousTransferFactory>(
+        std::make_unique<engine::tuple_generator::oblivious_transfer::
+                             IknpShRandomCorrelatedObliviousTransferFactory>(
+            std::make_unique<engine::tuple_generator::oblivious_transfer::
+                                 NpBaseObliviousTransferFactory>()),
+        std::make_unique<engine::tuple_generator::oblivious_transfer::ferret::
+                             RcotExtenderFactory>(
+            std::make_unique<
+                engine::tuple_generator::oblivious_transfer::ferret::
+                    TenLocalLinearMatrixMultiplierFactory>(),
+            std::make_unique<engine::tuple_generator::oblivious_transfer::
+                                 ferret::RegularErrorMultiPointCotFactory>(
+                std::make_unique<engine::tuple_generator::oblivious_transfer::
+                                     ferret::SinglePointCotFactory>())),
+        engine::tuple_generator::oblivious_transfer::ferret::kExtendedSize,
+        engine::tuple_generator::oblivious_transfer::ferret::kBaseSize,
+        engine::tuple_generator::oblivious_transfer::ferret::kWeight);
+  }
+};
+
+BENCHMARK_COUNTERS(ShareTranslationShuffler_Benchmark, counters) {
+  ShareTranslationShufflerBenchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+} // namespace fbpcf::mpc_std_lib::shuffler
+
+int main(int argc, char* argv[]) {
+  facebook::initFacebook(&argc, &argv);
+  folly::runBenchmarks();
+  return 0;
+}
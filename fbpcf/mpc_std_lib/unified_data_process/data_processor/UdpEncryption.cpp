@@ -6,6 +6,8 @@
  */
 
 #include "fbpcf/mpc_std_lib/unified_data_process/data_processor/UdpEncryption.h"
+#include <cstring>
+#include <future>
 #include <stdexcept>
 #include <string>
 #include "fbpcf/primitive/mac/S2v.h"
@@ -44,12 +46,47 @@ void UdpEncryption::processMyData(
         " but get " + std::to_string(plaintextData.at(0).size()));
   }
 
-  auto [ciphertext, nonce] =
-      UdpUtil::localEncryption(plaintextData, prgKey_, indexes);
-  agent_->send(nonce);
-  for (size_t i = 0; i < ciphertext.size(); i++) {
-    agent_->sendSingleT<uint64_t>(indexes.at(i));
-    agent_->send(ciphertext.at(i));
+  if (indexes.size() != plaintextData.size()) {
+    throw std::invalid_argument(
+        "indexes size and plaintextData size are not the same.");
+  }
+
+  auto nonce = UdpUtil::generateNonce(plaintextData);
+  {
+    std::vector<unsigned char> nonceData(kBlockSize);
+    _mm_storeu_si128((__m128i*)nonceData.data(), nonce);
+    agent_->send(nonceData);
+  }
+
+  // encrypt the next frame while the current one is being sent
+  engine::util::Aes cipher(prgKey_);
+  auto rowsPerFrame = getRowsPerFrame(myDataWidth_);
+  auto frameCount = (plaintextData.size() + rowsPerFrame - 1) / rowsPerFrame;
+  auto prepareFrame = [&](size_t frame) {
+    auto begin = frame * rowsPerFrame;
+    auto end = std::min(begin + rowsPerFrame, plaintextData.size());
+    std::vector<unsigned char> rst(
+        (end - begin) * (sizeof(uint64_t) + myDataWidth_));
+    memcpy(
+        rst.data(), indexes.data() + begin, (end - begin) * sizeof(uint64_t));
+    UdpUtil::encryptRows(
+        plaintextData,
+        cipher,
+        nonce,
+        indexes,
+        begin,
+        end,
+        rst.data() + (end - begin) * sizeof(uint64_t));
+    return rst;
+  };
+
+  auto nextFrame = std::async(std::launch::async, prepareFrame, 0);
+  for (size_t i = 0; i < frameCount; i++) {
+    auto frame = nextFrame.get();
+    if (i + 1 < frameCount) {
+      nextFrame = std::async(std::launch::async, prepareFrame, i + 1);
+    }
+    agent_->send(frame);
   }
 }
 
@@ -62,9 +99,12 @@ void UdpEncryption::prepareToProcessPeerData(
   }
   statusOfProcessingPeerData_ = Status::inProgress;
 
+  indexToOrder_ = std::vector<std::pair<uint64_t, uint64_t>>(indexes.size());
   for (size_t i = 0; i < indexes.size(); i++) {
-    indexToOrderMap_.emplace(indexes.at(i), i);
+    indexToOrder_.at(i) = {indexes.at(i), i};
   }
+  std::sort(indexToOrder_.begin(), indexToOrder_.end());
+  isPicked_ = std::vector<bool>(indexes.size());
 
   peerDataWidth_ = peerDataWidth;
 
@@ -84,19 +124,68 @@ void UdpEncryption::processPeerData(size_t dataSize) {
     nonce = _mm_lddqu_si128((__m128i*)nonceData.data());
   }
 
-  for (size_t i = 0; i < dataSize; i++) {
-    auto index = agent_->receiveSingleT<uint64_t>();
-    auto ciphertext = agent_->receive(peerDataWidth_);
-    auto pos = indexToOrderMap_.find(index);
-    if (pos != indexToOrderMap_.end()) {
-      // this ciphertext should be picked up
-      cherryPickedEncryption_.at(pos->second) = std::move(ciphertext);
-      cherryPickedNonce_.at(pos->second) = nonce;
-      cherryPickedIndex_.at(pos->second) = index;
-      indexToOrderMap_.erase(pos);
-      // TODO: this can be further optimized by not copying duplicated nonce.
+  // receive the next frame while picking up the rows of the current one
+  auto rowsPerFrame = getRowsPerFrame(peerDataWidth_);
+  auto frameCount = (dataSize + rowsPerFrame - 1) / rowsPerFrame;
+  auto receiveFrame = [&](size_t frame) {
+    auto rows = std::min(rowsPerFrame, dataSize - frame * rowsPerFrame);
+    return agent_->receive(rows * (sizeof(uint64_t) + peerDataWidth_));
+  };
+
+  std::future<std::vector<unsigned char>> nextFrame;
+  if (frameCount > 0) {
+    nextFrame = std::async(std::launch::async, receiveFrame, 0);
+  }
+  size_t position = 0;
+  for (size_t i = 0; i < frameCount; i++) {
+    auto frame = nextFrame.get();
+    if (i + 1 < frameCount) {
+      nextFrame = std::async(std::launch::async, receiveFrame, i + 1);
     }
+    auto rows = frame.size() / (sizeof(uint64_t) + peerDataWidth_);
+    const unsigned char* ciphertext = frame.data() + rows * sizeof(uint64_t);
+    for (size_t j = 0; j < rows; j++) {
+      uint64_t index;
+      memcpy(&index, frame.data() + j * sizeof(uint64_t), sizeof(uint64_t));
+      position = findIndex(index, position);
+      if (position < indexToOrder_.size() &&
+          indexToOrder_.at(position).first == index &&
+          !isPicked_.at(position)) {
+        // this ciphertext should be picked up
+        auto order = indexToOrder_.at(position).second;
+        cherryPickedEncryption_.at(order).assign(
+            ciphertext + j * peerDataWidth_,
+            ciphertext + (j + 1) * peerDataWidth_);
+        cherryPickedNonce_.at(order) = nonce;
+        cherryPickedIndex_.at(order) = index;
+        isPicked_.at(position) = true;
+        // TODO: this can be further optimized by not copying duplicated nonce.
+      }
+    }
+  }
+}
+
+size_t UdpEncryption::findIndex(uint64_t index, size_t hint) const {
+  auto lessThan = [](const std::pair<uint64_t, uint64_t>& pair,
+                     uint64_t value) { return pair.first < value; };
+  auto size = indexToOrder_.size();
+  if (hint >= size || indexToOrder_.at(hint).first >= index) {
+    auto end = indexToOrder_.begin() + std::min(hint + 1, size);
+    return std::lower_bound(indexToOrder_.begin(), end, index, lessThan) -
+        indexToOrder_.begin();
+  }
+  // the answer is after hint, double the step until passing it
+  size_t step = 1;
+  while (hint + step < size && indexToOrder_.at(hint + step).first < index) {
+    hint += step;
+    step *= 2;
   }
+  return std::lower_bound(
+             indexToOrder_.begin() + hint + 1,
+             indexToOrder_.begin() + std::min(hint + step + 1, size),
+             index,
+             lessThan) -
+      indexToOrder_.begin();
 }
 
 } // namespace fbpcf::mpc_std_lib::unified_data_process::data_processor
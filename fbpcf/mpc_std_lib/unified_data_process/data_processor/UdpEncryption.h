@@ -8,6 +8,8 @@
 #pragma once
 
 #include <emmintrin.h>
+#include <algorithm>
+#include <utility>
 #include "fbpcf/engine/communication/IPartyCommunicationAgent.h"
 #include "fbpcf/engine/util/util.h"
 #include "fbpcf/mpc_std_lib/unified_data_process/data_processor/IUdpEncryption.h"
@@ -81,10 +83,12 @@ class UdpEncryption final : public IUdpEncryption {
   __m128i prgKey_;
 
   size_t peerDataWidth_;
-  // this map records the index-to-order map, the i-th row in peer's input
-  // should be indexToOrderMap_.at(i)-th in the encryption result, if i is in
-  // this map.
-  std::map<int32_t, int32_t> indexToOrderMap_;
+  // the (index, order) pairs of the rows to cherry-pick, sorted by index. The
+  // row with this index in peer's input should be the order-th in the
+  // encryption result.
+  std::vector<std::pair<uint64_t, uint64_t>> indexToOrder_;
+  // whether the row of the pair at the same position is already picked up
+  std::vector<bool> isPicked_;
 
   // the vector of cherry-picked data of matched user, the three vectors
   // consists of ciphertext, nonce, and index, respectively. We need to save the
@@ -96,6 +100,19 @@ class UdpEncryption final : public IUdpEncryption {
 
   static const size_t kBlockSize = 16;
 
+  // rows are sent in frames of their indexes followed by their ciphertexts,
+  // every frame but the last has as many rows as fit in this many bytes.
+  static const size_t kFrameSize = 1 << 20;
+
+  static size_t getRowsPerFrame(size_t dataWidth) {
+    return std::max<size_t>(kFrameSize / (sizeof(uint64_t) + dataWidth), 1);
+  }
+
+  // find the position of the first pair with an index no less than the given
+  // one, starting from the position found for the previous index. Peer's
+  // indexes are usually increasing, so the search gallops forward from there.
+  size_t findIndex(uint64_t index, size_t hint) const;
+
   // record the status of this object of processing data
   enum Status {
     idle, // need to call setup first before any other APIs
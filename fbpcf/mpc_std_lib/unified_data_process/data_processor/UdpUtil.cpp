@@ -50,54 +50,84 @@ UdpUtil::localEncryption(
   }
   size_t rowCounts = plaintextData.size();
   size_t rowSize = plaintextData.at(0).size();
-  size_t rowBlocks = (rowSize + kBlockSize - 1) / kBlockSize;
 
   fbpcf::engine::util::Aes localAes(prgKey);
-
-  // generate counters for each block
-
-  __m128i s2vRes;
-  {
-    __m128i sivKey = fbpcf::engine::util::getRandomM128iFromSystemNoise();
-    const primitive::mac::S2vFactory s2vFactory;
-    std::vector<unsigned char> keyByte(kBlockSize);
-    _mm_storeu_si128((__m128i*)keyByte.data(), sivKey);
-    const auto s2v = s2vFactory.create(keyByte);
-
-    std::vector<unsigned char> plaintextCombined;
-    plaintextCombined.reserve(rowSize * rowCounts);
-    std::for_each(
-        plaintextData.begin(),
-        plaintextData.end(),
-        [&plaintextCombined](const auto& v) {
-          std::copy(v.begin(), v.end(), std::back_inserter(plaintextCombined));
-        });
-    s2vRes = s2v->getMacM128i(plaintextCombined);
+  auto s2vRes = generateNonce(plaintextData);
+
+  std::vector<uint8_t> ciphertext(rowCounts * rowSize);
+  encryptRows(
+      plaintextData,
+      localAes,
+      s2vRes,
+      indexes,
+      0,
+      rowCounts,
+      ciphertext.data());
+
+  std::vector<std::vector<uint8_t>> ciphertextByte(rowCounts);
+  for (size_t i = 0; i < rowCounts; ++i) {
+    ciphertextByte.at(i) = std::vector<uint8_t>(
+        ciphertext.begin() + i * rowSize,
+        ciphertext.begin() + (i + 1) * rowSize);
   }
 
-  std::vector<std::vector<__m128i>> counterM128i(rowCounts);
+  std::vector<unsigned char> s2vVec(kBlockSize);
+  _mm_storeu_si128((__m128i*)s2vVec.data(), s2vRes);
+  return {ciphertextByte, s2vVec};
+}
 
-  for (uint64_t i = 0; i < counterM128i.size(); ++i) {
-    counterM128i.at(i) =
-        generateCounterBlocks(s2vRes, indexes.at(i) * rowBlocks, rowBlocks);
-    // encrypt counters
-    localAes.encryptInPlace(counterM128i.at(i));
-  }
+__m128i UdpUtil::generateNonce(
+    const std::vector<std::vector<unsigned char>>& plaintextData) {
+  size_t rowSize = plaintextData.at(0).size();
+  __m128i sivKey = fbpcf::engine::util::getRandomM128iFromSystemNoise();
+  const primitive::mac::S2vFactory s2vFactory;
+  std::vector<unsigned char> keyByte(kBlockSize);
+  _mm_storeu_si128((__m128i*)keyByte.data(), sivKey);
+  const auto s2v = s2vFactory.create(keyByte);
+
+  std::vector<unsigned char> plaintextCombined;
+  plaintextCombined.reserve(rowSize * plaintextData.size());
+  std::for_each(
+      plaintextData.begin(),
+      plaintextData.end(),
+      [&plaintextCombined](const auto& v) {
+        std::copy(v.begin(), v.end(), std::back_inserter(plaintextCombined));
+      });
+  return s2v->getMacM128i(plaintextCombined);
+}
+
+void UdpUtil::encryptRows(
+    const std::vector<std::vector<unsigned char>>& plaintextData,
+    const engine::util::Aes& cipher,
+    __m128i nonce,
+    const std::vector<uint64_t>& indexes,
+    size_t begin,
+    size_t end,
+    unsigned char* dst) {
+  size_t rowSize = plaintextData.at(0).size();
+  size_t rowBlocks = (rowSize + kBlockSize - 1) / kBlockSize;
 
-  std::vector<std::vector<uint8_t>> ciphertextByte(
-      rowCounts, std::vector<uint8_t>(rowSize));
+  // generate and encrypt the counters of all rows at once
+  std::vector<__m128i> counters((end - begin) * rowBlocks);
+  for (size_t i = begin; i < end; ++i) {
+    auto base = _mm_add_epi64(
+        nonce, _mm_set_epi64x(0, indexes.at(i) * rowBlocks));
+    for (size_t j = 0; j < rowBlocks; ++j) {
+      counters[(i - begin) * rowBlocks + j] =
+          _mm_add_epi64(base, _mm_set_epi64x(0, j));
+    }
+  }
+  cipher.encryptInPlace(counters);
 
-  for (size_t i = 0; i < rowCounts; ++i) {
-    std::vector<uint8_t> mask(rowBlocks * kBlockSize);
-    memcpy(mask.data(), counterM128i.at(i).data(), rowBlocks * kBlockSize);
+  auto mask = reinterpret_cast<const uint8_t*>(counters.data());
+  for (size_t i = begin; i < end; ++i) {
+    auto& row = plaintextData.at(i);
+    auto rowMask = mask + (i - begin) * rowBlocks * kBlockSize;
     for (size_t j = 0; j < rowSize; ++j) {
-      ciphertextByte.at(i).at(j) = mask.at(j) ^ plaintextData.at(i).at(j);
+      dst[j] = rowMask[j] ^ row.at(j);
     }
+    dst += rowSize;
   }
-
-  std::vector<unsigned char> s2vVec(kBlockSize);
-  _mm_storeu_si128((__m128i*)s2vVec.data(), s2vRes);
-  return {ciphertextByte, s2vVec};
 }
 
 static std::vector<__m128i> convertCharVecToM128i(
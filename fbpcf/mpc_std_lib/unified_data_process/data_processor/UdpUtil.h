@@ -9,6 +9,7 @@
 
 #include <emmintrin.h>
 #include <sys/types.h>
+#include "fbpcf/engine/util/aes.h"
 #include "fbpcf/frontend/BitString.h"
 #include "fbpcf/mpc_std_lib/unified_data_process/data_processor/IUdpEncryption.h"
 #include "fbpcf/primitive/mac/S2v.h"
@@ -38,6 +39,21 @@ class UdpUtil {
   static std::vector<__m128i>
   generateCounterBlocks(__m128i nonce, uint64_t startingIndex, size_t size);
 
+  // the nonce of a batch is the S2V MAC of all its rows under a random key
+  static __m128i generateNonce(
+      const std::vector<std::vector<unsigned char>>& plaintextData);
+
+  // encrypt the rows in [begin, end) of a batch and write their ciphertexts
+  // one after another to dst
+  static void encryptRows(
+      const std::vector<std::vector<unsigned char>>& plaintextData,
+      const engine::util::Aes& cipher,
+      __m128i nonce,
+      const std::vector<uint64_t>& indexes,
+      size_t begin,
+      size_t end,
+      unsigned char* dst);
+
   template <int schedulerId>
   static std::vector<SecBit<schedulerId>> privatelyShareByteStream(
       const std::vector<std::vector<unsigned char>>& localData,
@@ -318,6 +318,75 @@ TEST(DataProcessorSubObjects, testUdpEncryptionAndDecryptionObjects) {
       agentFactories.at(1)->create(0, "receiver"));
 }
 
+TEST(DataProcessorSubObjects, testUdpEncryptionInMultipleFrames) {
+  // large enough to be sent in several frames
+  const size_t dataSize = 30000;
+  const size_t dataWidth = 100;
+  const size_t rowBlocks = (dataWidth + 15) / 16;
+  const uint64_t indexOffset = uint64_t(1) << 40;
+
+  std::random_device rd;
+  std::mt19937_64 e(rd());
+  std::uniform_int_distribution<uint8_t> randomData(0, 0xFF);
+  std::vector<std::vector<unsigned char>> plaintext(
+      dataSize, std::vector<unsigned char>(dataWidth));
+  for (auto& row : plaintext) {
+    for (auto& data : row) {
+      data = randomData(e);
+    }
+  }
+  // peer's indexes are mostly but not always increasing
+  std::vector<uint64_t> indexes(dataSize);
+  std::iota(indexes.begin(), indexes.end(), indexOffset);
+  for (size_t i = 0; i + 1 < dataSize; i += 7) {
+    std::swap(indexes.at(i), indexes.at(i + 1));
+  }
+  std::swap(indexes.front(), indexes.back());
+  std::vector<std::vector<unsigned char>> expectedPlaintext(dataSize);
+  for (size_t i = 0; i < dataSize; i++) {
+    expectedPlaintext.at(indexes.at(i) - indexOffset) = plaintext.at(i);
+  }
+
+  // pick every third row and some rows peer doesn't have
+  std::vector<uint64_t> pickedIndexes;
+  for (size_t i = 0; i < dataSize + 30; i += 3) {
+    pickedIndexes.push_back(indexOffset + dataSize - 1 - i);
+  }
+
+  auto agentFactories = engine::communication::getInMemoryAgentFactory(2);
+  UdpEncryption sender(agentFactories.at(0)->create(1, "sender"));
+  UdpEncryption receiver(agentFactories.at(1)->create(0, "receiver"));
+
+  auto future = std::async([&sender, &plaintext, &indexes, dataWidth]() {
+    sender.prepareToProcessMyData(dataWidth);
+    sender.processMyData(plaintext, indexes);
+    return sender.getExpandedKey();
+  });
+  receiver.prepareToProcessPeerData(dataWidth, pickedIndexes);
+  receiver.processPeerData(dataSize);
+  auto [ciphertexts, nonces, resultIndexes] = receiver.getProcessedData();
+  engine::util::Aes cipher(future.get().at(0));
+
+  for (size_t i = 0; i < pickedIndexes.size(); i++) {
+    auto index = pickedIndexes.at(i);
+    if (index < indexOffset) {
+      EXPECT_TRUE(ciphertexts.at(i).empty());
+      continue;
+    }
+    EXPECT_EQ(resultIndexes.at(i), index);
+    auto counters = UdpUtil::generateCounterBlocks(
+        nonces.at(i), index * rowBlocks, rowBlocks);
+    cipher.encryptInPlace(counters);
+    auto mask = reinterpret_cast<const unsigned char*>(counters.data());
+    std::vector<unsigned char> decrypted(dataWidth);
+    for (size_t j = 0; j < dataWidth; j++) {
+      decrypted.at(j) = ciphertexts.at(i).at(j) ^ mask[j];
+    }
+    fbpcf::testVectorEq(
+        decrypted, expectedPlaintext.at(index - indexOffset));
+  }
+}
+
 TEST(TestFileReadAndWrite, testExpandedKeyReadAndWrite) {
   const int batchSize = 11;
   std::vector<__m128i> key(batchSize);
@@ -204,6 +204,11 @@ class MpcAdapters<Intp<isSigned, width>, schedulerId> {
     return SecBatchType(std::move(rst));
   }
 
+  static std::vector<std::vector<bool>> extractBatchSharedSecrets(
+      const SecBatchType& src) {
+    return src.extractIntShare().getBooleanShares();
+  }
+
   static std::pair<SecBatchType, SecBatchType> obliviousSwap(
       const SecBatchType& src1,
       const SecBatchType& src2,
@@ -237,6 +242,12 @@ class MpcAdapters<Intp<isSigned, width>, schedulerId> {
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) {
     return src.unbatching(unbatchingStrategy);
   }
+
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) {
+    return src.gathering(indexes);
+  }
 };
 
 } // namespace fbpcf::mpc_std_lib::util
@@ -10,8 +10,10 @@
 #include <emmintrin.h>
 #include <smmintrin.h>
 #include <functional>
+#include <memory>
 #include <random>
 #include <stdexcept>
+#include <vector>
 
 namespace fbpcf::mpc_std_lib::util {
 
@@ -216,6 +218,15 @@ class MpcAdapters<AggregationValue, schedulerId> {
     return rst;
   }
 
+  static std::vector<std::vector<bool>> extractBatchSharedSecrets(
+      const SecBatchType& src) {
+    auto rst = src.conversionCount.extractIntShare().getBooleanShares();
+    auto valueShares =
+        src.conversionValue.extractIntShare().getBooleanShares();
+    rst.insert(rst.end(), valueShares.begin(), valueShares.end());
+    return rst;
+  }
+
   static std::pair<SecBatchType, SecBatchType> obliviousSwap(
       const SecBatchType& src1,
       const SecBatchType& src2,
@@ -259,6 +270,32 @@ class MpcAdapters<AggregationValue, schedulerId> {
     }
     return rst;
   }
+
+  static SecBatchType batchingWith(
+      const SecBatchType& src,
+      const std::vector<SecBatchType>& others) {
+    using CountType = decltype(src.conversionCount);
+    using ValueType = decltype(src.conversionValue);
+    std::vector<CountType> otherCounts(others.size());
+    std::vector<ValueType> otherValues(others.size());
+    for (size_t i = 0; i < others.size(); i++) {
+      otherCounts[i] = others.at(i).conversionCount;
+      otherValues[i] = others.at(i).conversionValue;
+    }
+    SecretAggregationValue<schedulerId> rst;
+    rst.conversionCount = src.conversionCount.batchingWith(otherCounts);
+    rst.conversionValue = src.conversionValue.batchingWith(otherValues);
+    return rst;
+  }
+
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) {
+    SecBatchType rst;
+    rst.conversionCount = src.conversionCount.gathering(indexes);
+    rst.conversionValue = src.conversionValue.gathering(indexes);
+    return rst;
+  }
 };
 
 } // namespace fbpcf::mpc_std_lib::util
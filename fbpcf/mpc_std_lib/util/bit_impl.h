@@ -26,7 +26,13 @@ class MpcAdapters<bool, schedulerId> {
     return SecBatchType(secrets, secretOwnerPartyId);
   }
 
-  static SecBatchType recoverBatchSharedSecrets(const std::vector<bool>& src);
+  static SecBatchType recoverBatchSharedSecrets(const std::vector<bool>& src) {
+    return SecBatchType(typename SecBatchType::ExtractedBit(src));
+  }
+
+  static std::vector<bool> extractBatchSharedSecrets(const SecBatchType& src) {
+    return src.extractBit().getValue();
+  }
 
   static std::pair<SecBatchType, SecBatchType> obliviousSwap(
       const SecBatchType& src1,
@@ -51,6 +57,12 @@ class MpcAdapters<bool, schedulerId> {
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) {
     return src.unbatching(unbatchingStrategy);
   }
+
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) {
+    return src.gathering(indexes);
+  }
 };
 
 } // namespace fbpcf::mpc_std_lib::util
@@ -28,7 +28,14 @@ class MpcAdapters<std::vector<bool>, schedulerId> {
   }
 
   static SecBatchType recoverBatchSharedSecrets(
-      const std::vector<std::vector<bool>>& src);
+      const std::vector<std::vector<bool>>& src) {
+    return SecBatchType(typename SecBatchType::ExtractedString(src));
+  }
+
+  static std::vector<std::vector<bool>> extractBatchSharedSecrets(
+      const SecBatchType& src) {
+    return src.extractStringShare().getValue();
+  }
 
   static std::pair<SecBatchType, SecBatchType> obliviousSwap(
       const SecBatchType& src1,
@@ -58,6 +65,12 @@ class MpcAdapters<std::vector<bool>, schedulerId> {
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) {
     return src.unbatching(unbatchingStrategy);
   }
+
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) {
+    return src.gathering(indexes);
+  }
 };
 
 } // namespace fbpcf::mpc_std_lib::util
@@ -74,6 +74,14 @@ class MpcAdapters<std::pair<T, U>, schedulerId> {
     return rst;
   }
 
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) {
+    return {
+        MpcAdapters<T, schedulerId>::gathering(src.first, indexes),
+        MpcAdapters<U, schedulerId>::gathering(src.second, indexes)};
+  }
+
   static SecBatchType batchingWith(
       const SecBatchType& src,
       const std::vector<SecBatchType>& others) {
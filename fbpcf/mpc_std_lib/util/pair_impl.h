@@ -46,6 +46,24 @@ class MpcAdapters<std::pair<T, bool>, schedulerId> {
     return {rst1, rst2};
   }
 
+  // the shares of the bool are in the last row
+  static SecBatchType recoverBatchSharedSecrets(
+      const std::vector<std::vector<bool>>& src) {
+    return {
+        MpcAdapters<T, schedulerId>::recoverBatchSharedSecrets(
+            std::vector<std::vector<bool>>(src.begin(), src.end() - 1)),
+        MpcAdapters<bool, schedulerId>::recoverBatchSharedSecrets(src.back())};
+  }
+
+  static std::vector<std::vector<bool>> extractBatchSharedSecrets(
+      const SecBatchType& src) {
+    auto rst =
+        MpcAdapters<T, schedulerId>::extractBatchSharedSecrets(src.first);
+    rst.push_back(
+        MpcAdapters<bool, schedulerId>::extractBatchSharedSecrets(src.second));
+    return rst;
+  }
+
   static std::pair<SecBatchType, SecBatchType> obliviousSwap(
       const SecBatchType& src1,
       const SecBatchType& src2,
@@ -74,6 +92,14 @@ class MpcAdapters<std::pair<T, bool>, schedulerId> {
     }
     return rst;
   }
+
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) {
+    return {
+        MpcAdapters<T, schedulerId>::gathering(src.first, indexes),
+        MpcAdapters<bool, schedulerId>::gathering(src.second, indexes)};
+  }
   static SecBatchType batchingWith(
       const SecBatchType& src,
       const std::vector<SecBatchType>& others) {
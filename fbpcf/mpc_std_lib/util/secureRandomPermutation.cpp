@@ -7,29 +7,176 @@
 
 #include "fbpcf/mpc_std_lib/util/secureRandomPermutation.h"
 
+#include <emmintrin.h>
+#include <algorithm>
+#include <array>
+#include <thread>
+
+#include "fbpcf/engine/util/aes.h"
+
 namespace fbpcf::mpc_std_lib::util {
-std::vector<uint32_t> secureRandomPermutation(
+
+namespace {
+
+// permutations of at least this many items are sampled through buckets
+const size_t kMinBucketedSize = 1 << 20;
+// the expected number of items in a bucket, small enough to be shuffled in
+// cache
+const size_t kBucketSize = 1 << 16;
+// the indexes are scattered into buckets in at most this many chunks
+const size_t kMaxChunkCount = 64;
+
+/**
+ * Random 32-bit words from AES in counter mode. Every stream has its own id in
+ * the high half of the counter blocks, so streams never overlap.
+ */
+class RandomWordStream {
+ public:
+  RandomWordStream(const engine::util::Aes& cipher, uint64_t streamId)
+      : cipher_(cipher), streamId_(streamId) {}
+
+  // Sample a number in [0, bound) with Lemire's multiply-shift method. The
+  // high half of a random word times bound is uniform once the 2^32 mod bound
+  // lowest values of the low half are rejected.
+  uint32_t uniformBelow(uint32_t bound) {
+    auto product = static_cast<uint64_t>(nextWord()) * bound;
+    auto low = static_cast<uint32_t>(product);
+    if (low < bound) {
+      uint32_t threshold = (0 - bound) % bound;
+      while (low < threshold) {
+        product = static_cast<uint64_t>(nextWord()) * bound;
+        low = static_cast<uint32_t>(product);
+      }
+    }
+    return static_cast<uint32_t>(product >> 32);
+  }
+
+ private:
+  static const size_t kBlockCount = 64;
+
+  uint32_t nextWord() {
+    if (position_ == words_.size()) {
+      auto blocks = reinterpret_cast<__m128i*>(words_.data());
+      for (size_t i = 0; i < kBlockCount; i++) {
+        _mm_store_si128(blocks + i, _mm_set_epi64x(streamId_, counter_++));
+      }
+      cipher_.encryptInPlace(blocks, kBlockCount);
+      position_ = 0;
+    }
+    return words_[position_++];
+  }
+
+  const engine::util::Aes& cipher_;
+  uint64_t streamId_;
+  uint64_t counter_ = 0;
+  alignas(16) std::array<uint32_t, 4 * kBlockCount> words_;
+  size_t position_ = 4 * kBlockCount;
+};
+
+// run task on ranges of [0, unitCount) in up to threadCount threads
+template <typename Task>
+void runInParallel(size_t unitCount, size_t threadCount, Task&& task) {
+  threadCount = std::max<size_t>(std::min(threadCount, unitCount), 1);
+  auto rangeSize = (unitCount + threadCount - 1) / threadCount;
+  std::vector<std::thread> threads;
+  for (size_t begin = rangeSize; begin < unitCount; begin += rangeSize) {
+    auto end = std::min(begin + rangeSize, unitCount);
+    threads.emplace_back([&task, begin, end]() { task(begin, end); });
+  }
+  task(0, std::min(rangeSize, unitCount));
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+// Fisher-Yates shuffle of size items starting from data
+void shuffle(uint32_t* data, uint32_t size, RandomWordStream& stream) {
+  for (uint32_t i = size; i > 1; i--) {
+    std::swap(data[stream.uniformBelow(i)], data[i - 1]);
+  }
+}
+
+// Every index picks a uniformly random bucket, the indexes are grouped by
+// bucket in their original order and then every bucket is shuffled. For any
+// sizes of the buckets, each permutation comes from exactly one choice of
+// buckets, so the output is uniform.
+std::vector<uint32_t> bucketedPermutation(
     uint32_t size,
-    engine::util::IPrg& prg) {
-  std::vector<uint32_t> rst(size);
-  for (size_t i = 0; i < size; i++) {
-    rst[i] = i;
+    const engine::util::Aes& cipher,
+    size_t threadCount) {
+  size_t bucketCount = (size + kBucketSize - 1) / kBucketSize;
+  size_t chunkCount = std::min(bucketCount, kMaxChunkCount);
+  size_t chunkSize = (size + chunkCount - 1) / chunkCount;
+
+  std::vector<uint16_t> buckets(size);
+  std::vector<std::vector<uint32_t>> counts(
+      chunkCount, std::vector<uint32_t>(bucketCount));
+  runInParallel(chunkCount, threadCount, [&](size_t begin, size_t end) {
+    for (size_t chunk = begin; chunk < end; chunk++) {
+      RandomWordStream stream(cipher, 1 + chunk);
+      auto& count = counts[chunk];
+      auto last = std::min<size_t>((chunk + 1) * chunkSize, size);
+      for (size_t i = chunk * chunkSize; i < last; i++) {
+        buckets[i] = stream.uniformBelow(bucketCount);
+        count[buckets[i]]++;
+      }
+    }
+  });
+
+  // the bucket b of chunk c starts after all smaller buckets and after bucket
+  // b of all smaller chunks
+  std::vector<uint32_t> bucketStarts(bucketCount + 1);
+  uint32_t position = 0;
+  for (size_t bucket = 0; bucket < bucketCount; bucket++) {
+    bucketStarts[bucket] = position;
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+      auto count = counts[chunk][bucket];
+      counts[chunk][bucket] = position;
+      position += count;
+    }
   }
+  bucketStarts[bucketCount] = position;
+
+  std::vector<uint32_t> rst(size);
+  runInParallel(chunkCount, threadCount, [&](size_t begin, size_t end) {
+    for (size_t chunk = begin; chunk < end; chunk++) {
+      auto& next = counts[chunk];
+      auto last = std::min<size_t>((chunk + 1) * chunkSize, size);
+      for (size_t i = chunk * chunkSize; i < last; i++) {
+        rst[next[buckets[i]]++] = i;
+      }
+    }
+  });
 
-  BN_CTX* ctx = BN_CTX_new();
-  if (ctx == nullptr) {
-    throw std::runtime_error(
-        "BN_CTX initialization failed: " + std::to_string(ERR_get_error()));
+  runInParallel(bucketCount, threadCount, [&](size_t begin, size_t end) {
+    for (size_t bucket = begin; bucket < end; bucket++) {
+      RandomWordStream stream(cipher, 1 + chunkCount + bucket);
+      shuffle(
+          rst.data() + bucketStarts[bucket],
+          bucketStarts[bucket + 1] - bucketStarts[bucket],
+          stream);
+    }
+  });
+  return rst;
+}
+
+} // namespace
+
+std::vector<uint32_t> secureRandomPermutation(
+    uint32_t size,
+    engine::util::IPrg& prg,
+    size_t threadCount) {
+  engine::util::Aes cipher(prg.getRandomM128i());
+  if (size >= kMinBucketedSize) {
+    return bucketedPermutation(size, cipher, threadCount);
   }
 
-  for (size_t i = size; i > 1; i--) {
-    // Max permutation size + 128 bit security parameter
-    auto randomBytes = prg.getRandomBytes(
-        sizeof(uint32_t) + RANDOM_PERMUTATION_SECURITY_BITS / 8);
-    auto position = engine::util::mod(randomBytes, i, ctx);
-    std::swap(rst[position], rst[i - 1]);
+  std::vector<uint32_t> rst(size);
+  for (size_t i = 0; i < size; i++) {
+    rst[i] = i;
   }
-  BN_CTX_free(ctx);
+  RandomWordStream stream(cipher, 0);
+  shuffle(rst.data(), size, stream);
   return rst;
 }
 } // namespace fbpcf::mpc_std_lib::util
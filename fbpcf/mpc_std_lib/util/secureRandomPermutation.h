@@ -7,19 +7,28 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 #include "fbpcf/engine/util/IPrg.h"
 
 namespace fbpcf::mpc_std_lib::util {
 
-const uint32_t RANDOM_PERMUTATION_SECURITY_BITS = 128;
-
 /**
  *This method generates a random indexes permutation in range [0, size - 1].
  *This method required a prg to generate secure random bytes.
+ *Only a 128-bit key is taken from the prg, all other randomness comes from
+ *AES in counter mode under this key, and every bounded number is sampled
+ *without bias by rejection. Large permutations first scatter the indexes into
+ *random buckets, then shuffle every bucket, which is still uniform. The work
+ *only depends on the size, so the output only depends on the prg and not on
+ *threadCount.
  */
 
 std::vector<uint32_t> secureRandomPermutation(
     uint32_t size,
-    engine::util::IPrg& prg);
+    engine::util::IPrg& prg,
+    size_t threadCount = 1);
 
 } // namespace fbpcf::mpc_std_lib::util
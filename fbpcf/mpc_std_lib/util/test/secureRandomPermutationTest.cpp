@@ -9,6 +9,9 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
 #include "fbpcf/engine/util/AesPrgFactory.h"
 #include "fbpcf/engine/util/util.h"
 #include "fbpcf/test/TestHelper.h"
@@ -34,4 +37,43 @@ TEST(permutationTest, testPermutationWithAesPrg) {
   permutationTest(*prg);
 }
 
+void testPermutation(const std::vector<uint32_t>& permutation, uint32_t size) {
+  ASSERT_EQ(size, permutation.size());
+  std::vector<bool> seen(size, false);
+  for (auto index : permutation) {
+    ASSERT_LT(index, size);
+    EXPECT_FALSE(seen[index]);
+    seen[index] = true;
+  }
+}
+
+TEST(permutationTest, testBucketedPermutation) {
+  uint32_t size = (1 << 21) + 3;
+  auto seed = engine::util::getRandomM128iFromSystemNoise();
+  auto prg0 = engine::util::AesPrgFactory().create(seed);
+  auto prg1 = engine::util::AesPrgFactory().create(seed);
+  auto permutation0 = secureRandomPermutation(size, *prg0);
+  auto permutation1 = secureRandomPermutation(size, *prg1, 8);
+  testPermutation(permutation0, size);
+  // the output only depends on the prg
+  EXPECT_EQ(permutation0, permutation1);
+  EXPECT_NE(permutation0, secureRandomPermutation(size, *prg0, 8));
+}
+
+TEST(permutationTest, testPermutationIsUniform) {
+  auto prg = engine::util::AesPrgFactory().create(
+      engine::util::getRandomM128iFromSystemNoise());
+  const size_t sampleCount = 60000;
+  std::map<std::vector<uint32_t>, size_t> counts;
+  for (size_t i = 0; i < sampleCount; i++) {
+    counts[secureRandomPermutation(3, *prg)]++;
+  }
+  EXPECT_EQ(counts.size(), 6);
+  for (auto& [permutation, count] : counts) {
+    // more than 5 standard deviations away from the expected 10000
+    EXPECT_GT(count, 9500);
+    EXPECT_LT(count, 10500);
+  }
+}
+
 } // namespace fbpcf::mpc_std_lib::util
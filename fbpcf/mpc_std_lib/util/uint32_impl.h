@@ -67,6 +67,11 @@ class MpcAdapters<uint32_t, schedulerId> {
   static SecBatchType recoverBatchSharedSecrets(
       const std::vector<std::vector<bool>>& src);
 
+  static std::vector<std::vector<bool>> extractBatchSharedSecrets(
+      const SecBatchType& src) {
+    return src.extractIntShare().getBooleanShares();
+  }
+
   static std::pair<SecBatchType, SecBatchType> obliviousSwap(
       const SecBatchType& src1,
       const SecBatchType& src2,
@@ -93,6 +98,12 @@ class MpcAdapters<uint32_t, schedulerId> {
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) {
     return src.unbatching(unbatchingStrategy);
   }
+
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) {
+    return src.gathering(indexes);
+  }
 };
 
 template <int schedulerId>
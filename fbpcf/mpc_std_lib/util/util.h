@@ -49,6 +49,11 @@ class MpcAdapters {
   static SecBatchType recoverBatchSharedSecrets(
       const std::vector<std::vector<bool>>& src);
 
+  // extract this party's shares of a batch, this is the inverse of
+  // recoverBatchSharedSecrets.
+  static std::vector<std::vector<bool>> extractBatchSharedSecrets(
+      const SecBatchType& src);
+
   static std::pair<SecBatchType, SecBatchType> obliviousSwap(
       const SecBatchType& src1,
       const SecBatchType& src2,
@@ -63,6 +68,12 @@ class MpcAdapters {
   static std::vector<SecBatchType> unbatching(
       const SecBatchType& src,
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy);
+
+  // select the items at the given positions of a batch into a new batch, e.g.
+  // the items whose revealed labels are 1.
+  static SecBatchType gathering(
+      const SecBatchType& src,
+      std::shared_ptr<std::vector<uint32_t>> indexes);
 };
 
 std::vector<std::vector<bool>> convertToBits(const std::vector<__m128i>& src);
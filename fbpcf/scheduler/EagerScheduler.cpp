@@ -6,8 +6,10 @@
  */
 
 #include "fbpcf/scheduler/EagerScheduler.h"
+#include <chrono>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 namespace fbpcf::scheduler {
 
@@ -19,6 +21,47 @@ EagerScheduler::EagerScheduler(
       wireKeeper_{std::move(wireKeeper)},
       collector_{collector} {}
 
+template <typename F>
+auto EagerScheduler::traceNonFreeOperation(
+    uint64_t numberOfGates,
+    F&& operation) -> std::invoke_result_t<F> {
+  if (tracer_ == nullptr) {
+    return operation();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto trafficBefore = engine_->getTrafficStatistics();
+  auto tupleGenerationBefore = engine_->getTupleGenerationTime();
+  auto record = [&]() {
+    auto duration = std::chrono::steady_clock::now() - start;
+    auto trafficAfter = engine_->getTrafficStatistics();
+    auto tupleGenerationTime =
+        engine_->getTupleGenerationTime() - tupleGenerationBefore;
+    tracer_->recordLevel(ExecutionTracer::LevelTrace{
+        .level = tracedOperations_++,
+        .isFree = false,
+        .numberOfGates = numberOfGates,
+        .bytesSent = trafficAfter.first - trafficBefore.first,
+        .bytesReceived = trafficAfter.second - trafficBefore.second,
+        .start = start,
+        .duration = duration,
+        .gateComputation = std::chrono::nanoseconds::zero(),
+        .tupleGeneration = tupleGenerationTime,
+        .networkOpening = duration - tupleGenerationTime,
+        .resultCollection = std::chrono::nanoseconds::zero(),
+    });
+  };
+
+  if constexpr (std::is_void_v<std::invoke_result_t<F>>) {
+    operation();
+    record();
+  } else {
+    auto result = operation();
+    record();
+    return result;
+  }
+}
+
 IScheduler::WireId<IScheduler::Boolean> EagerScheduler::privateBooleanInput(
     bool v,
     int partyId) {
@@ -64,7 +107,9 @@ IScheduler::WireId<IScheduler::Boolean> EagerScheduler::openBooleanValueToParty(
     int partyId) {
   std::vector<bool> secretShares{wireKeeper_->getBooleanValue(src)};
   nonFreeGates_ += secretShares.size();
-  auto revealedSecrets = engine_->revealToParty(partyId, secretShares);
+  auto revealedSecrets = traceNonFreeOperation(secretShares.size(), [&]() {
+    return engine_->revealToParty(partyId, secretShares);
+  });
 
   if (revealedSecrets.size() == 1) {
     return wireKeeper_->allocateBooleanValue(revealedSecrets.at(0));
@@ -79,7 +124,9 @@ EagerScheduler::openBooleanValueToPartyBatch(
     int partyId) {
   auto secretShares = wireKeeper_->getBatchBooleanValue(src);
   nonFreeGates_ += secretShares.size();
-  auto revealedSecrets = engine_->revealToParty(partyId, secretShares);
+  auto revealedSecrets = traceNonFreeOperation(secretShares.size(), [&]() {
+    return engine_->revealToParty(partyId, secretShares);
+  });
 
   if (revealedSecrets.size() == secretShares.size()) {
     return wireKeeper_->allocateBatchBooleanValue(
@@ -156,7 +203,9 @@ EagerScheduler::openIntegerValueToParty(
     int partyId) {
   std::vector<uint64_t> secretShares{wireKeeper_->getIntegerValue(src)};
   nonFreeGates_ += secretShares.size();
-  auto revealedSecrets = engine_->revealToParty(partyId, secretShares);
+  auto revealedSecrets = traceNonFreeOperation(secretShares.size(), [&]() {
+    return engine_->revealToParty(partyId, secretShares);
+  });
 
   if (revealedSecrets.size() == 1) {
     return wireKeeper_->allocateIntegerValue(revealedSecrets.at(0));
@@ -171,7 +220,9 @@ EagerScheduler::openIntegerValueToPartyBatch(
     int partyId) {
   auto secretShares = wireKeeper_->getBatchIntegerValue(src);
   nonFreeGates_ += secretShares.size();
-  auto revealedSecrets = engine_->revealToParty(partyId, secretShares);
+  auto revealedSecrets = traceNonFreeOperation(secretShares.size(), [&]() {
+    return engine_->revealToParty(partyId, secretShares);
+  });
 
   if (revealedSecrets.size() == secretShares.size()) {
     return wireKeeper_->allocateBatchIntegerValue(
@@ -208,7 +259,7 @@ IScheduler::WireId<IScheduler::Boolean> EagerScheduler::privateAndPrivate(
   nonFreeGates_++;
   auto index = engine_->scheduleAND(
       wireKeeper_->getBooleanValue(left), wireKeeper_->getBooleanValue(right));
-  engine_->executeScheduledOperations();
+  traceNonFreeOperation(1, [this]() { engine_->executeScheduledOperations(); });
   return wireKeeper_->allocateBooleanValue(
       engine_->getANDExecutionResult(index));
 }
@@ -219,9 +270,10 @@ IScheduler::WireId<IScheduler::Boolean> EagerScheduler::privateAndPrivateBatch(
   auto leftValue = wireKeeper_->getBatchBooleanValue(left);
   auto rightValue = wireKeeper_->getBatchBooleanValue(right);
   nonFreeGates_ += leftValue.size();
-  return wireKeeper_->allocateBatchBooleanValue(
-      engine_->computeBatchANDImmediately(leftValue, rightValue),
-      leftValue.size());
+  auto result = traceNonFreeOperation(leftValue.size(), [&]() {
+    return engine_->computeBatchANDImmediately(leftValue, rightValue);
+  });
+  return wireKeeper_->allocateBatchBooleanValue(result, leftValue.size());
 }
 
 IScheduler::WireId<IScheduler::Boolean> EagerScheduler::privateAndPublic(
@@ -271,7 +323,8 @@ EagerScheduler::privateAndPrivateComposite(
   }
   auto index = engine_->scheduleCompositeAND(
       wireKeeper_->getBooleanValue(left), rightValues);
-  engine_->executeScheduledOperations();
+  traceNonFreeOperation(
+      rights.size(), [this]() { engine_->executeScheduledOperations(); });
   auto result = engine_->getCompositeANDExecutionResult(index);
   std::vector<IScheduler::WireId<IScheduler::Boolean>> outputWires(
       result.size());
@@ -293,7 +346,9 @@ EagerScheduler::privateAndPrivateCompositeBatch(
   }
 
   auto index = engine_->scheduleBatchCompositeAND(leftValues, rightValues);
-  engine_->executeScheduledOperations();
+  traceNonFreeOperation(leftValues.size() * rights.size(), [this]() {
+    engine_->executeScheduledOperations();
+  });
   auto result = engine_->getBatchCompositeANDExecutionResult(index);
   std::vector<IScheduler::WireId<IScheduler::Boolean>> outputWires(
       result.size());
@@ -407,6 +462,58 @@ IScheduler::WireId<IScheduler::Boolean> EagerScheduler::publicXorPublicBatch(
       leftValue.size());
 }
 
+IScheduler::WireId<IScheduler::Boolean> EagerScheduler::multiXor(
+    const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  if (privateSrc.empty() && publicSrc.empty()) {
+    throw std::invalid_argument("No input to XOR.");
+  }
+  freeGates_ += privateSrc.size() + publicSrc.size() - 1 + negate;
+  bool constant = negate;
+  for (auto& wire : publicSrc) {
+    constant = engine_->computeSymmetricXOR(
+        constant, wireKeeper_->getBooleanValue(wire));
+  }
+  if (privateSrc.empty()) {
+    return wireKeeper_->allocateBooleanValue(constant);
+  }
+  auto value = wireKeeper_->getBooleanValue(privateSrc.at(0));
+  for (size_t i = 1; i < privateSrc.size(); i++) {
+    value = engine_->computeSymmetricXOR(
+        value, wireKeeper_->getBooleanValue(privateSrc.at(i)));
+  }
+  return wireKeeper_->allocateBooleanValue(
+      engine_->computeAsymmetricXOR(value, constant));
+}
+
+IScheduler::WireId<IScheduler::Boolean> EagerScheduler::multiXorBatch(
+    const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  if (privateSrc.empty() && publicSrc.empty()) {
+    throw std::invalid_argument("No input to XOR.");
+  }
+  auto batchSize = wireKeeper_->getBatchSize(
+      privateSrc.empty() ? publicSrc.at(0) : privateSrc.at(0));
+  freeGates_ += (privateSrc.size() + publicSrc.size() - 1 + negate) * batchSize;
+  std::vector<bool> constant(batchSize, negate);
+  for (auto& wire : publicSrc) {
+    constant = engine_->computeBatchSymmetricXOR(
+        constant, wireKeeper_->getBatchBooleanValue(wire));
+  }
+  if (privateSrc.empty()) {
+    return wireKeeper_->allocateBatchBooleanValue(constant, batchSize);
+  }
+  auto value = wireKeeper_->getBatchBooleanValue(privateSrc.at(0));
+  for (size_t i = 1; i < privateSrc.size(); i++) {
+    value = engine_->computeBatchSymmetricXOR(
+        value, wireKeeper_->getBatchBooleanValue(privateSrc.at(i)));
+  }
+  return wireKeeper_->allocateBatchBooleanValue(
+      engine_->computeBatchAsymmetricXOR(value, constant), batchSize);
+}
+
 IScheduler::WireId<IScheduler::Boolean> EagerScheduler::notPrivate(
     WireId<IScheduler::Boolean> src) {
   freeGates_++;
@@ -443,7 +550,7 @@ IScheduler::WireId<IScheduler::Arithmetic> EagerScheduler::privateMultPrivate(
   nonFreeGates_++;
   auto index = engine_->scheduleMult(
       wireKeeper_->getIntegerValue(left), wireKeeper_->getIntegerValue(right));
-  engine_->executeScheduledOperations();
+  traceNonFreeOperation(1, [this]() { engine_->executeScheduledOperations(); });
   return wireKeeper_->allocateIntegerValue(
       engine_->getMultExecutionResult(index));
 }
@@ -455,9 +562,10 @@ EagerScheduler::privateMultPrivateBatch(
   auto leftValue = wireKeeper_->getBatchIntegerValue(left);
   auto rightValue = wireKeeper_->getBatchIntegerValue(right);
   nonFreeGates_ += leftValue.size();
-  return wireKeeper_->allocateBatchIntegerValue(
-      engine_->computeBatchMultImmediately(leftValue, rightValue),
-      leftValue.size());
+  auto result = traceNonFreeOperation(leftValue.size(), [&]() {
+    return engine_->computeBatchMultImmediately(leftValue, rightValue);
+  });
+  return wireKeeper_->allocateBatchIntegerValue(result, leftValue.size());
 }
 
 IScheduler::WireId<IScheduler::Arithmetic> EagerScheduler::privateMultPublic(
@@ -588,6 +696,161 @@ IScheduler::WireId<IScheduler::Arithmetic> EagerScheduler::negPublicBatch(
       engine_->computeBatchSymmetricNeg(values), values.size());
 }
 
+IScheduler::WireId<IScheduler::Arithmetic>
+EagerScheduler::privateBooleansToInteger(
+    const std::vector<WireId<IScheduler::Boolean>>& bits) {
+  if (bits.empty()) {
+    throw std::invalid_argument("Need at least one bit to convert.");
+  }
+  if (bits.size() > 64) {
+    throw std::invalid_argument("Can't convert more than 64 bits.");
+  }
+  std::vector<bool> shares(bits.size());
+  for (size_t i = 0; i < bits.size(); i++) {
+    shares[i] = wireKeeper_->getBooleanValue(bits[i]);
+  }
+  auto values = combineBooleanShares(shares);
+
+  uint64_t rst = values.at(0);
+  for (size_t i = 1; i < values.size(); i++) {
+    rst = engine_->computeSymmetricPlus(
+        rst, engine_->computeFreeMult(values[i], uint64_t(1) << i));
+  }
+  freeGates_ += 2 * (values.size() - 1);
+  return wireKeeper_->allocateIntegerValue(rst);
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+EagerScheduler::privateBooleansToIntegerBatch(
+    const std::vector<WireId<IScheduler::Boolean>>& bits) {
+  if (bits.empty()) {
+    throw std::invalid_argument("Need at least one bit to convert.");
+  }
+  if (bits.size() > 64) {
+    throw std::invalid_argument("Can't convert more than 64 bits.");
+  }
+  // convert the bits of all batches in one go
+  auto batchSize = wireKeeper_->getBatchSize(bits.at(0));
+  std::vector<bool> shares;
+  shares.reserve(bits.size() * batchSize);
+  for (auto& bit : bits) {
+    auto& values = wireKeeper_->getBatchBooleanValue(bit);
+    if (values.size() != batchSize) {
+      throw std::invalid_argument("Inconsistent batch size.");
+    }
+    shares.insert(shares.end(), values.begin(), values.end());
+  }
+  auto values = combineBooleanShares(shares);
+
+  std::vector<uint64_t> rst(values.begin(), values.begin() + batchSize);
+  for (size_t i = 1; i < bits.size(); i++) {
+    rst = engine_->computeBatchSymmetricPlus(
+        rst,
+        engine_->computeBatchFreeMult(
+            std::vector<uint64_t>(
+                values.begin() + i * batchSize,
+                values.begin() + (i + 1) * batchSize),
+            std::vector<uint64_t>(batchSize, uint64_t(1) << i)));
+  }
+  freeGates_ += 2 * (values.size() - batchSize);
+  return wireKeeper_->allocateBatchIntegerValue(rst, batchSize);
+}
+
+std::vector<std::vector<IScheduler::WireId<IScheduler::Boolean>>>
+EagerScheduler::privateIntegerShareBits(
+    WireId<IScheduler::Arithmetic> src,
+    size_t width) {
+  auto value = wireKeeper_->getIntegerValue(src);
+  std::vector<std::vector<WireId<IScheduler::Boolean>>> rst;
+  for (int party = 0; party < engine_->getNumberOfParties(); party++) {
+    auto bits = engine_->computeIntegerShareToBooleans(party, value);
+    std::vector<WireId<IScheduler::Boolean>> wires(width);
+    for (size_t i = 0; i < width; i++) {
+      wires[i] = wireKeeper_->allocateBooleanValue(bits.at(i));
+    }
+    freeGates_ += width;
+    rst.push_back(std::move(wires));
+  }
+  return rst;
+}
+
+std::vector<std::vector<IScheduler::WireId<IScheduler::Boolean>>>
+EagerScheduler::privateIntegerShareBitsBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t width) {
+  auto& values = wireKeeper_->getBatchIntegerValue(src);
+  std::vector<std::vector<WireId<IScheduler::Boolean>>> rst;
+  for (int party = 0; party < engine_->getNumberOfParties(); party++) {
+    auto bits = engine_->computeBatchIntegerShareToBooleans(party, values);
+    std::vector<WireId<IScheduler::Boolean>> wires(width);
+    for (size_t i = 0; i < width; i++) {
+      wires[i] =
+          wireKeeper_->allocateBatchBooleanValue(bits.at(i), values.size());
+    }
+    freeGates_ += width * values.size();
+    rst.push_back(std::move(wires));
+  }
+  return rst;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> EagerScheduler::truncatePrivate(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  freeGates_++;
+  return wireKeeper_->allocateIntegerValue(
+      engine_->computeTruncation(wireKeeper_->getIntegerValue(src), bits));
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+EagerScheduler::truncatePrivateBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  auto values = wireKeeper_->getBatchIntegerValue(src);
+  freeGates_ += values.size();
+  return wireKeeper_->allocateBatchIntegerValue(
+      engine_->computeBatchTruncation(values, bits), values.size());
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> EagerScheduler::truncatePublic(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  freeGates_++;
+  return wireKeeper_->allocateIntegerValue(static_cast<uint64_t>(
+      static_cast<int64_t>(wireKeeper_->getIntegerValue(src)) >> bits));
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> EagerScheduler::truncatePublicBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  auto& values = wireKeeper_->getBatchIntegerValue(src);
+  freeGates_ += values.size();
+  std::vector<uint64_t> rst(values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    rst[i] = static_cast<uint64_t>(static_cast<int64_t>(values[i]) >> bits);
+  }
+  return wireKeeper_->allocateBatchIntegerValue(rst, values.size());
+}
+
+std::vector<uint64_t> EagerScheduler::combineBooleanShares(
+    const std::vector<bool>& shares) {
+  auto rst = engine_->computeBatchBooleanShareToInteger(0, shares);
+  freeGates_ += shares.size();
+  // x ^ y = x + y - 2xy on the lifted shares of every party
+  for (int party = 1; party < engine_->getNumberOfParties(); party++) {
+    auto lifted = engine_->computeBatchBooleanShareToInteger(party, shares);
+    nonFreeGates_ += shares.size();
+    auto product = traceNonFreeOperation(shares.size(), [&]() {
+      return engine_->computeBatchMultImmediately(rst, lifted);
+    });
+    auto doubled = engine_->computeBatchSymmetricPlus(product, product);
+    rst = engine_->computeBatchSymmetricPlus(
+        engine_->computeBatchSymmetricPlus(rst, lifted),
+        engine_->computeBatchSymmetricNeg(doubled));
+    freeGates_ += 4 * shares.size();
+  }
+  return rst;
+}
+
 void EagerScheduler::increaseReferenceCount(WireId<IScheduler::Boolean> id) {
   wireKeeper_->increaseReferenceCount(id);
 }
@@ -664,6 +927,22 @@ std::vector<IScheduler::WireId<IScheduler::Boolean>> EagerScheduler::unbatching(
   return rst;
 }
 
+// select the values at the given positions of a batch into a new batch.
+IScheduler::WireId<IScheduler::Boolean> EagerScheduler::gathering(
+    WireId<Boolean> src,
+    std::shared_ptr<std::vector<uint32_t>> indexes) {
+  auto& batch = wireKeeper_->getBatchBooleanValue(src);
+  std::vector<bool> v(indexes->size());
+  for (size_t i = 0; i < v.size(); i++) {
+    if (indexes->at(i) >= batch.size()) {
+      throw std::runtime_error(
+          "Failed to gather, you are gathering a value beyond the input.");
+    }
+    v[i] = batch.at(indexes->at(i));
+  }
+  return wireKeeper_->allocateBatchBooleanValue(v, v.size());
+}
+
 std::pair<uint64_t, uint64_t> EagerScheduler::getTrafficStatistics() const {
   if (engine_) {
     return engine_->getTrafficStatistics();
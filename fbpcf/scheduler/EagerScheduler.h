@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "fbpcf/engine/ISecretShareEngine.h"
+#include "fbpcf/scheduler/ExecutionTracer.h"
 #include "fbpcf/scheduler/IArithmeticScheduler.h"
 #include "fbpcf/scheduler/IScheduler.h"
 #include "fbpcf/scheduler/IWireKeeper.h"
@@ -310,6 +313,22 @@ class EagerScheduler final : public IArithmeticScheduler {
       WireId<IScheduler::Boolean> left,
       WireId<IScheduler::Boolean> right) override;
 
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Boolean> multiXor(
+      const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Boolean> multiXorBatch(
+      const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
   // ------ Not gates ------
 
   /**
@@ -452,6 +471,65 @@ class EagerScheduler final : public IArithmeticScheduler {
   WireId<IScheduler::Arithmetic> negPublicBatch(
       WireId<IScheduler::Arithmetic> src) override;
 
+  //======== Below are share conversion APIs: ========
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> privateBooleansToInteger(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> privateBooleansToIntegerBatch(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<WireId<IScheduler::Boolean>>> privateIntegerShareBits(
+      WireId<IScheduler::Arithmetic> src,
+      size_t width) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<WireId<IScheduler::Boolean>>>
+  privateIntegerShareBitsBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t width) override;
+
+  //======== Below are truncation APIs: ========
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePrivate(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePrivateBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePublic(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePublicBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
   //======== Below are wire management APIs: ========
 
   /**
@@ -504,6 +582,11 @@ class EagerScheduler final : public IArithmeticScheduler {
       WireId<Boolean> src,
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) override;
 
+  // select the values at the given positions of a batch into a new batch.
+  WireId<Boolean> gathering(
+      WireId<Boolean> src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) override;
+
   //======== Below are miscellaneous APIs: ========
 
   /**
@@ -532,11 +615,30 @@ class EagerScheduler final : public IArithmeticScheduler {
 
   void deleteEngine() override;
 
+  // Record every operation that involves communication into the given
+  // tracer. Free gates are executed one at a time and are not traced. Pass
+  // nullptr to stop tracing.
+  void setExecutionTracer(std::shared_ptr<ExecutionTracer> tracer) {
+    tracer_ = std::move(tracer);
+  }
+
  private:
   std::unique_ptr<engine::ISecretShareEngine> engine_;
   std::pair<uint64_t, uint64_t> engineTrafficStatisticsBuffer_;
   std::unique_ptr<IWireKeeper> wireKeeper_;
   std::shared_ptr<util::MetricCollector> collector_;
+  std::shared_ptr<ExecutionTracer> tracer_;
+  uint64_t tracedOperations_ = 0;
+
+  // Lift the boolean shares of all parties and XOR them in the arithmetic
+  // domain, taking one round per additional party.
+  std::vector<uint64_t> combineBooleanShares(const std::vector<bool>& shares);
+
+  // Run an operation that involves communication and record it into the
+  // tracer, if there is one.
+  template <typename F>
+  auto traceNonFreeOperation(uint64_t numberOfGates, F&& operation)
+      -> std::invoke_result_t<F>;
 };
 
 } // namespace fbpcf::scheduler
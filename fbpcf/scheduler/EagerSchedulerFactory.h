@@ -11,6 +11,7 @@
 #include "fbpcf/engine/SecretShareEngineFactory.h"
 #include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
 #include "fbpcf/scheduler/EagerScheduler.h"
+#include "fbpcf/scheduler/ExecutionTracer.h"
 #include "fbpcf/scheduler/ISchedulerFactory.h"
 #include "fbpcf/scheduler/WireKeeper.h"
 
@@ -32,12 +33,32 @@ class EagerSchedulerFactory final : public ISchedulerFactory<unsafe> {
         engineFactory_(std::move(engineFactory)) {}
 
   std::unique_ptr<IScheduler> create() override {
-    return std::make_unique<EagerScheduler>(
+    auto scheduler = std::make_unique<EagerScheduler>(
         engineFactory_->create(), WireKeeper::createWithVectorArena<unsafe>());
+    if (isTracing_) {
+      tracers_.push_back(std::make_shared<ExecutionTracer>());
+      scheduler->setExecutionTracer(tracers_.back());
+    }
+    return scheduler;
+  }
+
+  // Trace the operations that involve communication in the schedulers created
+  // from now on, see ExecutionTracer. Every scheduler records into its own
+  // tracer. Tracing is off by default.
+  void enableExecutionTracing() {
+    isTracing_ = true;
+  }
+
+  // The tracers of the traced schedulers, in the order they were created.
+  const std::vector<std::shared_ptr<ExecutionTracer>>& getExecutionTracers()
+      const {
+    return tracers_;
   }
 
  private:
   std::unique_ptr<engine::ISecretShareEngineFactory> engineFactory_;
+  bool isTracing_ = false;
+  std::vector<std::shared_ptr<ExecutionTracer>> tracers_;
 };
 
 template <bool unsafe>
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "fbpcf/scheduler/ExecutionTracer.h"
+
+#include <fmt/format.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace fbpcf::scheduler {
+
+namespace {
+
+double toMicroseconds(std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+double toMilliseconds(std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+folly::dynamic
+makeSlice(const std::string& name, const std::string& category, double ts) {
+  return folly::dynamic::object("name", name)("cat", category)("ph", "X")(
+      "ts", ts)("pid", 0)("tid", 0);
+}
+
+} // namespace
+
+std::string ExecutionTracer::toChromeTraceJson() const {
+  folly::dynamic events = folly::dynamic::array;
+  events.push_back(folly::dynamic::object("name", "process_name")("ph", "M")(
+      "pid", 0)("args", folly::dynamic::object("name", "fbpcf scheduler")));
+
+  if (!levels_.empty()) {
+    auto origin = levels_.front().start;
+    uint64_t totalBytesSent = 0;
+    uint64_t totalBytesReceived = 0;
+    for (auto& level : levels_) {
+      auto ts = toMicroseconds(level.start - origin);
+      auto category = level.isFree ? "free" : "non-free";
+
+      auto slice =
+          makeSlice(fmt::format("level {}", level.level), category, ts);
+      slice["dur"] = toMicroseconds(level.duration);
+      slice["args"] = folly::dynamic::object("level", level.level)(
+          "gates", level.numberOfGates)("bytesSent", level.bytesSent)(
+          "bytesReceived", level.bytesReceived);
+      events.push_back(std::move(slice));
+
+      std::pair<const char*, std::chrono::nanoseconds> phases[] = {
+          {"gate computation", level.gateComputation},
+          {"tuple generation", level.tupleGeneration},
+          {"network opening", level.networkOpening},
+          {"result collection", level.resultCollection},
+      };
+      for (auto& [name, duration] : phases) {
+        if (duration.count() > 0) {
+          auto phase = makeSlice(name, category, ts);
+          phase["dur"] = toMicroseconds(duration);
+          events.push_back(std::move(phase));
+          ts += toMicroseconds(duration);
+        }
+      }
+
+      totalBytesSent += level.bytesSent;
+      totalBytesReceived += level.bytesReceived;
+      events.push_back(folly::dynamic::object("name", "traffic")("ph", "C")(
+          "ts", toMicroseconds(level.start - origin))("pid", 0)(
+          "args",
+          folly::dynamic::object("bytesSent", totalBytesSent)(
+              "bytesReceived", totalBytesReceived)));
+    }
+  }
+
+  return folly::toJson(folly::dynamic::object("traceEvents", events)(
+      "displayTimeUnit", "ns"));
+}
+
+void ExecutionTracer::writeChromeTrace(const std::string& path) const {
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    throw std::runtime_error("Can't open trace file " + path);
+  }
+  file << toChromeTraceJson();
+}
+
+std::string ExecutionTracer::getSummaryTable() const {
+  struct Summary {
+    uint64_t levels = 0;
+    uint64_t gates = 0;
+    uint64_t bytesSent = 0;
+    uint64_t bytesReceived = 0;
+    std::chrono::nanoseconds gateComputation{0};
+    std::chrono::nanoseconds tupleGeneration{0};
+    std::chrono::nanoseconds networkOpening{0};
+    std::chrono::nanoseconds resultCollection{0};
+    std::chrono::nanoseconds duration{0};
+
+    void add(const LevelTrace& level) {
+      levels++;
+      gates += level.numberOfGates;
+      bytesSent += level.bytesSent;
+      bytesReceived += level.bytesReceived;
+      gateComputation += level.gateComputation;
+      tupleGeneration += level.tupleGeneration;
+      networkOpening += level.networkOpening;
+      resultCollection += level.resultCollection;
+      duration += level.duration;
+    }
+  };
+
+  Summary free, nonFree, total;
+  for (auto& level : levels_) {
+    (level.isFree ? free : nonFree).add(level);
+    total.add(level);
+  }
+
+  auto formatRow = [](const std::string& name, const Summary& summary) {
+    return fmt::format(
+        "{:<10}{:>10}{:>14}{:>14}{:>14}{:>14.3f}{:>14.3f}{:>14.3f}{:>14.3f}"
+        "{:>14.3f}\n",
+        name,
+        summary.levels,
+        summary.gates,
+        summary.bytesSent,
+        summary.bytesReceived,
+        toMilliseconds(summary.gateComputation),
+        toMilliseconds(summary.tupleGeneration),
+        toMilliseconds(summary.networkOpening),
+        toMilliseconds(summary.resultCollection),
+        toMilliseconds(summary.duration));
+  };
+
+  return fmt::format(
+             "{:<10}{:>10}{:>14}{:>14}{:>14}{:>14}{:>14}{:>14}{:>14}{:>14}\n",
+             "",
+             "levels",
+             "gates",
+             "sent(B)",
+             "received(B)",
+             "compute(ms)",
+             "tuples(ms)",
+             "opening(ms)",
+             "collect(ms)",
+             "total(ms)") +
+      formatRow("free", free) + formatRow("non-free", nonFree) +
+      formatRow("total", total);
+}
+
+} // namespace fbpcf::scheduler
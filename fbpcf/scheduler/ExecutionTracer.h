@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace fbpcf::scheduler {
+
+/**
+ * An opt-in recorder of how a scheduler spends its time. For every executed
+ * level it keeps the number of gates, the traffic and the wall time of each
+ * execution phase. The records can be exported as a Chrome trace (which can be
+ * loaded into chrome://tracing or https://ui.perfetto.dev) or summarized into
+ * a plain text table.
+ * A tracer is not thread-safe and should only be attached to one scheduler.
+ * The scheduler factories create one tracer per scheduler when tracing is
+ * enabled.
+ */
+class ExecutionTracer {
+ public:
+  struct LevelTrace {
+    // The level index for the lazy scheduler, the sequence number of the
+    // operation for the eager scheduler.
+    uint64_t level;
+    bool isFree;
+    uint64_t numberOfGates;
+    uint64_t bytesSent;
+    uint64_t bytesReceived;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::nanoseconds duration;
+
+    // Local computation of free gates, or scheduling of non-free gates.
+    std::chrono::nanoseconds gateComputation;
+    // Obtaining the tuples consumed by non-free gates.
+    std::chrono::nanoseconds tupleGeneration;
+    // Opening masked values and revealing outputs.
+    std::chrono::nanoseconds networkOpening;
+    // Writing the results of non-free gates back to their wires.
+    std::chrono::nanoseconds resultCollection;
+  };
+
+  void recordLevel(const LevelTrace& trace) {
+    levels_.push_back(trace);
+  }
+
+  const std::vector<LevelTrace>& getLevelTraces() const {
+    return levels_;
+  }
+
+  void clear() {
+    levels_.clear();
+  }
+
+  /**
+   * Export the records in the Chrome trace event format. Every level becomes
+   * a slice with its phases nested inside, laid out back to back in execution
+   * order. Timestamps are relative to the start of the first recorded level.
+   */
+  std::string toChromeTraceJson() const;
+
+  /**
+   * Write the output of toChromeTraceJson() to a file.
+   * @param path the file to (over)write
+   */
+  void writeChromeTrace(const std::string& path) const;
+
+  /**
+   * Aggregate the records of free and non-free levels into a human readable
+   * table.
+   */
+  std::string getSummaryTable() const;
+
+ private:
+  std::vector<LevelTrace> levels_;
+};
+
+} // namespace fbpcf::scheduler
@@ -251,6 +251,85 @@ class IArithmeticScheduler : public IScheduler {
   virtual WireId<IScheduler::Arithmetic> negPublicBatch(
       WireId<IScheduler::Arithmetic> src) = 0;
 
+  //======== Below are share conversion APIs: ========
+
+  /**
+   * Convert PRIVATE boolean wires into a PRIVATE integer wire, i.e. creating a
+   * wire that will store the sum of bits[i] * 2^i, where bits[0] is the least
+   * significant bit. Each boolean share is lifted into the arithmetic domain
+   * for free, and the lifted shares of all parties are then combined with
+   * x ^ y = x + y - 2xy, which costs one Mult round per additional party.
+   * There must be between 1 and 64 bits, otherwise std::invalid_argument is
+   * thrown.
+   */
+  virtual WireId<IScheduler::Arithmetic> privateBooleansToInteger(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) = 0;
+
+  /**
+   * same, except it process a batch of inputs. This could be useful when the
+   * application is a massive replications of a small function.
+   */
+  virtual WireId<IScheduler::Arithmetic> privateBooleansToIntegerBatch(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) = 0;
+
+  /**
+   * Decompose the integer share of every party on a PRIVATE wire into the
+   * lowest width bits, for free. The result is indexed by party and then by
+   * bit, least significant first; each bit is a PRIVATE boolean wire holding
+   * that party's bit. The secret modulo 2^width is the sum of the integers
+   * formed by all parties' bits, which the caller adds up with a boolean
+   * adder to complete the conversion.
+   */
+  virtual std::vector<std::vector<WireId<IScheduler::Boolean>>>
+  privateIntegerShareBits(WireId<IScheduler::Arithmetic> src, size_t width) = 0;
+
+  /**
+   * same, except it process a batch of inputs. This could be useful when the
+   * application is a massive replications of a small function.
+   */
+  virtual std::vector<std::vector<WireId<IScheduler::Boolean>>>
+  privateIntegerShareBitsBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t width) = 0;
+
+  //======== Below are truncation APIs: ========
+
+  /**
+   * Divide the value on a PRIVATE wire by 2^bits as a signed integer, i.e.
+   * creating a PRIVATE wire that will store it shifted to the right. This is
+   * free but probabilistic: the result may be smaller by one in its last bit
+   * for each party but the first, and is wrong entirely with a small
+   * probability that grows with the magnitude of the value, see
+   * ISecretShareEngine::computeTruncation().
+   */
+  virtual WireId<IScheduler::Arithmetic> truncatePrivate(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) = 0;
+
+  /**
+   * same, except it process a batch of inputs. This could be useful when the
+   * application is a massive replications of a small function.
+   */
+  virtual WireId<IScheduler::Arithmetic> truncatePrivateBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) = 0;
+
+  /**
+   * Divide the value on a PUBLIC wire by 2^bits as a signed integer, i.e.
+   * creating a PUBLIC wire that will store it shifted to the right.
+   */
+  virtual WireId<IScheduler::Arithmetic> truncatePublic(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) = 0;
+
+  /**
+   * same, except it process a batch of inputs. This could be useful when the
+   * application is a massive replications of a small function.
+   */
+  virtual WireId<IScheduler::Arithmetic> truncatePublicBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) = 0;
+
   //======== Below are wire management APIs: ========
 
   /**
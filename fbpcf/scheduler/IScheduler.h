@@ -286,6 +286,26 @@ class IScheduler {
       WireId<Boolean> left,
       WireId<Boolean> right) = 0;
 
+  /**
+   * Compute the XOR of a number of PRIVATE and PUBLIC wires, inverted if
+   * negate is true, as a single gate with a single output wire. A chain of
+   * two-input XORs would allocate a wire for every intermediate result. The
+   * output wire is PUBLIC if privateSrc is empty, and PRIVATE otherwise.
+   */
+  virtual WireId<Boolean> multiXor(
+      const std::vector<WireId<Boolean>>& privateSrc,
+      const std::vector<WireId<Boolean>>& publicSrc,
+      bool negate) = 0;
+
+  /**
+   * same, except it process a batch of inputs. This could be useful when the
+   * application is a massive replications of a small function.
+   */
+  virtual WireId<Boolean> multiXorBatch(
+      const std::vector<WireId<Boolean>>& privateSrc,
+      const std::vector<WireId<Boolean>>& publicSrc,
+      bool negate) = 0;
+
   // ------ Not gates ------
 
   /**
@@ -348,6 +368,12 @@ class IScheduler {
       WireId<Boolean> src,
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) = 0;
 
+  // select the values at the given positions of a batch into a new batch, in
+  // the order of the positions.
+  virtual WireId<Boolean> gathering(
+      WireId<Boolean> src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) = 0;
+
   //======== Below are miscellaneous APIs: ========
   /**
    * Get the total amount of traffic transmitted.
@@ -423,6 +449,11 @@ class IScheduler::WireId {
 // the frontend types (e.g. Bit) has a template parameter describing which
 // scheduler it should use.
 // This object is the holder of those schedulers.
+// A scheduler can either be shared by the whole process (setScheduler) or be
+// private to the calling thread (setThreadLocalScheduler). The latter allows
+// running several independent computations with the same schedulerId on
+// different threads, each with its own engine and connection. Frontend objects
+// must only be used on the thread that created them.
 template <int schedulerId>
 class SchedulerKeeper {
  public:
@@ -430,33 +461,58 @@ class SchedulerKeeper {
     scheduler_ = std::move(scheduler);
   }
 
+  // Set a scheduler for the calling thread only. On this thread it takes
+  // precedence over the one set via setScheduler().
+  static void setThreadLocalScheduler(std::unique_ptr<IScheduler> scheduler) {
+    threadLocalSchedulerOwner_ = std::move(scheduler);
+    threadLocalScheduler_ = threadLocalSchedulerOwner_.get();
+  }
+
   static void deleteEngine() {
-    scheduler_->deleteEngine();
+    currentScheduler().deleteEngine();
   }
 
+  // Free the scheduler used by the calling thread, i.e. the thread-local one
+  // if there is one and the process-wide one otherwise.
   static void freeScheduler() {
-    scheduler_ = nullptr;
+    if (threadLocalScheduler_ != nullptr) {
+      threadLocalScheduler_ = nullptr;
+      threadLocalSchedulerOwner_ = nullptr;
+    } else {
+      scheduler_ = nullptr;
+    }
   }
 
   static std::pair<uint64_t, uint64_t> getTrafficStatistics() {
-    return scheduler_->getTrafficStatistics();
+    return currentScheduler().getTrafficStatistics();
   }
 
   static std::pair<uint64_t, uint64_t> getGateStatistics() {
-    return scheduler_->getGateStatistics();
+    return currentScheduler().getGateStatistics();
   }
 
   static std::pair<uint64_t, uint64_t> getWireStatistics() {
-    return scheduler_->getWireStatistics();
+    return currentScheduler().getWireStatistics();
   }
 
  protected:
   IScheduler& getScheduler() const {
-    return *scheduler_;
+    return currentScheduler();
   }
 
  private:
+  static IScheduler& currentScheduler() {
+    auto scheduler = threadLocalScheduler_;
+    return scheduler != nullptr ? *scheduler : *scheduler_;
+  }
+
   inline static std::unique_ptr<IScheduler> scheduler_;
+  // A raw pointer is kept next to the owning one since reading a trivially
+  // destructible thread_local doesn't need to go through its initialization
+  // guard, which keeps the lookup on the hot path cheap.
+  inline static thread_local IScheduler* threadLocalScheduler_ = nullptr;
+  inline static thread_local std::unique_ptr<IScheduler>
+      threadLocalSchedulerOwner_;
 };
 
 } // namespace fbpcf::scheduler
@@ -7,6 +7,7 @@
 
 #include "fbpcf/scheduler/LazyScheduler.h"
 
+#include <chrono>
 #include <cstdint>
 #include <exception>
 #include <map>
@@ -362,6 +363,24 @@ IScheduler::WireId<IScheduler::Boolean> LazyScheduler::publicXorPublicBatch(
   return id;
 }
 
+IScheduler::WireId<IScheduler::Boolean> LazyScheduler::multiXor(
+    const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  auto id = gateKeeper_->multiXorGate(privateSrc, publicSrc, negate);
+  maybeExecuteGates();
+  return id;
+}
+
+IScheduler::WireId<IScheduler::Boolean> LazyScheduler::multiXorBatch(
+    const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  auto id = gateKeeper_->multiXorGateBatch(privateSrc, publicSrc, negate);
+  maybeExecuteGates();
+  return id;
+}
+
 IScheduler::WireId<IScheduler::Boolean> LazyScheduler::notPrivate(
     WireId<IScheduler::Boolean> src) {
   auto id = gateKeeper_->normalGate(INormalGate::GateType::AsymmetricNot, src);
@@ -534,6 +553,75 @@ IScheduler::WireId<IScheduler::Arithmetic> LazyScheduler::negPublicBatch(
   return id;
 }
 
+IScheduler::WireId<IScheduler::Arithmetic>
+LazyScheduler::privateBooleansToInteger(
+    const std::vector<WireId<IScheduler::Boolean>>& bits) {
+  return booleansToInteger<false>(bits);
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+LazyScheduler::privateBooleansToIntegerBatch(
+    const std::vector<WireId<IScheduler::Boolean>>& bits) {
+  return booleansToInteger<true>(bits);
+}
+
+std::vector<std::vector<IScheduler::WireId<IScheduler::Boolean>>>
+LazyScheduler::privateIntegerShareBits(
+    WireId<IScheduler::Arithmetic> src,
+    size_t width) {
+  std::vector<std::vector<WireId<IScheduler::Boolean>>> rst;
+  for (int party = 0; party < engine_->getNumberOfParties(); party++) {
+    rst.push_back(gateKeeper_->integerShareToBooleansGate(src, party, width));
+  }
+  maybeExecuteGates();
+  return rst;
+}
+
+std::vector<std::vector<IScheduler::WireId<IScheduler::Boolean>>>
+LazyScheduler::privateIntegerShareBitsBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t width) {
+  std::vector<std::vector<WireId<IScheduler::Boolean>>> rst;
+  for (int party = 0; party < engine_->getNumberOfParties(); party++) {
+    rst.push_back(
+        gateKeeper_->integerShareToBooleansGateBatch(src, party, width));
+  }
+  maybeExecuteGates();
+  return rst;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> LazyScheduler::truncatePrivate(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  auto id = gateKeeper_->truncationGate(src, bits, /* isPrivate */ true);
+  maybeExecuteGates();
+  return id;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> LazyScheduler::truncatePrivateBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  auto id = gateKeeper_->truncationGateBatch(src, bits, /* isPrivate */ true);
+  maybeExecuteGates();
+  return id;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> LazyScheduler::truncatePublic(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  auto id = gateKeeper_->truncationGate(src, bits, /* isPrivate */ false);
+  maybeExecuteGates();
+  return id;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> LazyScheduler::truncatePublicBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  auto id = gateKeeper_->truncationGateBatch(src, bits, /* isPrivate */ false);
+  maybeExecuteGates();
+  return id;
+}
+
 void LazyScheduler::increaseReferenceCount(WireId<IScheduler::Boolean> id) {
   wireKeeper_->increaseReferenceCount(id);
 }
@@ -596,6 +684,14 @@ std::vector<IScheduler::WireId<IScheduler::Boolean>> LazyScheduler::unbatching(
   return rst;
 }
 
+// select the values at the given positions of a batch into a new batch.
+IScheduler::WireId<IScheduler::Boolean> LazyScheduler::gathering(
+    WireId<Boolean> src,
+    std::shared_ptr<std::vector<uint32_t>> indexes) {
+  maybeExecuteGates();
+  return gateKeeper_->gathering(src, indexes);
+}
+
 template <bool usingBatch>
 IGateKeeper::BoolType<usingBatch> LazyScheduler::forceWire(
     IScheduler::WireId<IScheduler::Boolean> id) {
@@ -620,6 +716,94 @@ IGateKeeper::IntType<usingBatch> LazyScheduler::forceWire(
   }
 }
 
+template <bool usingBatch>
+IScheduler::WireId<IScheduler::Arithmetic> LazyScheduler::booleansToInteger(
+    const std::vector<WireId<IScheduler::Boolean>>& bits) {
+  if (bits.empty()) {
+    throw std::invalid_argument("Need at least one bit to convert.");
+  }
+  if (bits.size() > 64) {
+    throw std::invalid_argument("Can't convert more than 64 bits.");
+  }
+  auto arithmeticGate = [this](
+                            IArithmeticGate::GateType gateType,
+                            WireId<IScheduler::Arithmetic> left,
+                            WireId<IScheduler::Arithmetic> right) {
+    if constexpr (usingBatch) {
+      return gateKeeper_->arithmeticGateBatch(gateType, left, right);
+    } else {
+      return gateKeeper_->arithmeticGate(gateType, left, right);
+    }
+  };
+  auto release = [this](WireId<IScheduler::Arithmetic> id) {
+    if constexpr (usingBatch) {
+      wireKeeper_->decreaseBatchReferenceCount(id);
+    } else {
+      wireKeeper_->decreaseReferenceCount(id);
+    }
+  };
+  auto liftShare = [this](WireId<IScheduler::Boolean> bit, int party) {
+    if constexpr (usingBatch) {
+      return gateKeeper_->booleanShareToIntegerGateBatch(bit, party);
+    } else {
+      return gateKeeper_->booleanShareToIntegerGate(bit, party);
+    }
+  };
+
+  WireId<IScheduler::Arithmetic> rst;
+  for (size_t i = 0; i < bits.size(); i++) {
+    // x ^ y = x + y - 2xy on the lifted shares of every party
+    auto bit = liftShare(bits.at(i), 0);
+    for (int party = 1; party < engine_->getNumberOfParties(); party++) {
+      auto share = liftShare(bits.at(i), party);
+      auto product =
+          arithmeticGate(IArithmeticGate::GateType::NonFreeMult, bit, share);
+      auto doubled = arithmeticGate(
+          IArithmeticGate::GateType::SymmetricPlus, product, product);
+      auto negated = arithmeticGate(
+          IArithmeticGate::GateType::Neg,
+          doubled,
+          WireId<IScheduler::Arithmetic>());
+      auto sum =
+          arithmeticGate(IArithmeticGate::GateType::SymmetricPlus, bit, share);
+      auto xored = arithmeticGate(
+          IArithmeticGate::GateType::SymmetricPlus, sum, negated);
+      for (auto id : {bit, share, product, doubled, negated, sum}) {
+        release(id);
+      }
+      bit = xored;
+    }
+
+    if (i > 0) {
+      uint64_t weight = uint64_t(1) << i;
+      WireId<IScheduler::Arithmetic> weightWire;
+      if constexpr (usingBatch) {
+        weightWire = gateKeeper_->inputGateBatch(std::vector<uint64_t>(
+            wireKeeper_->getBatchSize(bits.at(i)), weight));
+      } else {
+        weightWire = gateKeeper_->inputGate(weight);
+      }
+      auto weighted =
+          arithmeticGate(IArithmeticGate::GateType::FreeMult, bit, weightWire);
+      release(weightWire);
+      release(bit);
+      bit = weighted;
+    }
+
+    if (rst.isEmpty()) {
+      rst = bit;
+    } else {
+      auto sum =
+          arithmeticGate(IArithmeticGate::GateType::SymmetricPlus, rst, bit);
+      release(rst);
+      release(bit);
+      rst = sum;
+    }
+  }
+  maybeExecuteGates();
+  return rst;
+}
+
 void LazyScheduler::maybeExecuteGates() {
   while (gateKeeper_->hasReachedBatchingLimit()) {
     executeOneLevel();
@@ -633,24 +817,29 @@ void LazyScheduler::executeTillLevel(uint32_t level) {
 }
 
 void LazyScheduler::executeOneLevel() {
+  auto start = std::chrono::steady_clock::now();
+  auto trafficBefore = engine_->getTrafficStatistics();
   auto level = gateKeeper_->getFirstUnexecutedLevel();
   auto gates = gateKeeper_->popFirstUnexecutedLevel();
   auto isLevelFree = IGateKeeper::isLevelFree(level);
 
   // Compute free or non-free gates
   std::map<int64_t, IGate::Secrets> secretSharesByParty;
-  for (auto& gate : gates) {
-    gate->compute(*engine_, secretSharesByParty);
-
-    if (isLevelFree) {
-      freeGates_ += gate->getNumberOfResults();
-    } else {
-      nonFreeGates_ += gate->getNumberOfResults();
-    }
+  auto numberOfResults = gates.compute(*engine_, secretSharesByParty);
+  if (isLevelFree) {
+    freeGates_ += numberOfResults;
+  } else {
+    nonFreeGates_ += numberOfResults;
   }
+  auto computeEnd = std::chrono::steady_clock::now();
+  auto openingEnd = computeEnd;
+  auto tupleGenerationTime = std::chrono::nanoseconds::zero();
 
   if (!isLevelFree) {
+    auto tupleGenerationBefore = engine_->getTupleGenerationTime();
     engine_->executeScheduledOperations();
+    tupleGenerationTime =
+        engine_->getTupleGenerationTime() - tupleGenerationBefore;
 
     std::map<int64_t, IGate::Secrets> revealedSecretsByParty;
     for (auto [party, secretShares] : secretSharesByParty) {
@@ -660,11 +849,40 @@ void LazyScheduler::executeOneLevel() {
               engine_->revealToParty(party, secretShares.booleanSecrets),
               engine_->revealToParty(party, secretShares.integerSecrets)));
     }
+    openingEnd = std::chrono::steady_clock::now();
 
     // Update non-free gates
-    for (auto& nonFreeGate : gates) {
-      nonFreeGate->collectScheduledResult(*engine_, revealedSecretsByParty);
-    }
+    gates.collectScheduledResult(*engine_, revealedSecretsByParty);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  auto trafficAfter = engine_->getTrafficStatistics();
+  auto bytesSent = trafficAfter.first - trafficBefore.first;
+  auto bytesReceived = trafficAfter.second - trafficBefore.second;
+  auto [wiresAllocated, wiresDeallocated] = wireKeeper_->getWireStatistics();
+  gateKeeper_->recordLevelExecution(LevelExecutionStatistics{
+      .isFree = isLevelFree,
+      .numberOfGates = numberOfResults,
+      .bytesSent = bytesSent,
+      .bytesReceived = bytesReceived,
+      .duration = end - start,
+      .liveWires = wiresAllocated - wiresDeallocated,
+  });
+
+  if (tracer_ != nullptr) {
+    tracer_->recordLevel(ExecutionTracer::LevelTrace{
+        .level = level,
+        .isFree = isLevelFree,
+        .numberOfGates = numberOfResults,
+        .bytesSent = bytesSent,
+        .bytesReceived = bytesReceived,
+        .start = start,
+        .duration = end - start,
+        .gateComputation = computeEnd - start,
+        .tupleGeneration = tupleGenerationTime,
+        .networkOpening = openingEnd - computeEnd - tupleGenerationTime,
+        .resultCollection = end - openingEnd,
+    });
   }
 }
 
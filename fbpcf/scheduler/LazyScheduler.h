@@ -9,6 +9,7 @@
 
 #include <stdexcept>
 #include "fbpcf/engine/ISecretShareEngine.h"
+#include "fbpcf/scheduler/ExecutionTracer.h"
 #include "fbpcf/scheduler/IArithmeticScheduler.h"
 #include "fbpcf/scheduler/IScheduler.h"
 #include "fbpcf/scheduler/IWireKeeper.h"
@@ -313,6 +314,22 @@ class LazyScheduler final : public IArithmeticScheduler {
       WireId<IScheduler::Boolean> left,
       WireId<IScheduler::Boolean> right) override;
 
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Boolean> multiXor(
+      const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Boolean> multiXorBatch(
+      const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
   // ------ Not gates ------
 
   /**
@@ -455,6 +472,65 @@ class LazyScheduler final : public IArithmeticScheduler {
   WireId<IScheduler::Arithmetic> negPublicBatch(
       WireId<IScheduler::Arithmetic> src) override;
 
+  //======== Below are share conversion APIs: ========
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> privateBooleansToInteger(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> privateBooleansToIntegerBatch(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<WireId<IScheduler::Boolean>>> privateIntegerShareBits(
+      WireId<IScheduler::Arithmetic> src,
+      size_t width) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<WireId<IScheduler::Boolean>>>
+  privateIntegerShareBitsBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t width) override;
+
+  //======== Below are truncation APIs: ========
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePrivate(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePrivateBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePublic(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePublicBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
   //======== Below are wire management APIs: ========
 
   /**
@@ -507,6 +583,11 @@ class LazyScheduler final : public IArithmeticScheduler {
       WireId<Boolean> src,
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) override;
 
+  // select the values at the given positions of a batch into a new batch.
+  WireId<Boolean> gathering(
+      WireId<Boolean> src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) override;
+
   //======== Below are miscellaneous APIs: ========
 
   /**
@@ -535,6 +616,12 @@ class LazyScheduler final : public IArithmeticScheduler {
 
   void deleteEngine() override;
 
+  // Record the execution of each level into the given tracer. Pass nullptr to
+  // stop tracing.
+  void setExecutionTracer(std::shared_ptr<ExecutionTracer> tracer) {
+    tracer_ = std::move(tracer);
+  }
+
  private:
   std::unique_ptr<engine::ISecretShareEngine> engine_;
   std::pair<uint64_t, uint64_t> engineTrafficStatisticsBuffer_;
@@ -542,6 +629,12 @@ class LazyScheduler final : public IArithmeticScheduler {
   std::shared_ptr<IWireKeeper> wireKeeper_;
   std::unique_ptr<IGateKeeper> gateKeeper_;
   std::shared_ptr<util::MetricCollector> collector_;
+  std::shared_ptr<ExecutionTracer> tracer_;
+
+  // Lift the boolean shares of all parties and combine them into an integer.
+  template <bool usingBatch>
+  WireId<IScheduler::Arithmetic> booleansToInteger(
+      const std::vector<WireId<IScheduler::Boolean>>& bits);
 
   // Compute the value for the given wire if it hasn't been set already.
   template <bool usingBatch>
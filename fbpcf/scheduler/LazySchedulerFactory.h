@@ -10,10 +10,13 @@
 #include "fbpcf/engine/ISecretShareEngineFactory.h"
 #include "fbpcf/engine/SecretShareEngineFactory.h"
 #include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
+#include "fbpcf/scheduler/ExecutionTracer.h"
 #include "fbpcf/scheduler/ISchedulerFactory.h"
 #include "fbpcf/scheduler/LazyScheduler.h"
 #include "fbpcf/scheduler/WireKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/FixedBatchingLimitPolicyFactory.h"
 #include "fbpcf/scheduler/gate_keeper/GateKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicyFactory.h"
 #include "fbpcf/util/MetricCollector.h"
 
 namespace fbpcf::scheduler {
@@ -37,14 +40,44 @@ class LazySchedulerFactory final : public ISchedulerFactory<unsafe> {
     std::shared_ptr<IWireKeeper> wireKeeper =
         WireKeeper::createWithVectorArena<unsafe>();
 
-    return std::make_unique<LazyScheduler>(
+    auto scheduler = std::make_unique<LazyScheduler>(
         engineFactory_->create(),
         wireKeeper,
-        std::make_unique<GateKeeper>(wireKeeper));
+        std::make_unique<GateKeeper>(
+            wireKeeper, batchingLimitPolicyFactory_->create()));
+    if (isTracing_) {
+      tracers_.push_back(std::make_shared<ExecutionTracer>());
+      scheduler->setExecutionTracer(tracers_.back());
+    }
+    return scheduler;
+  }
+
+  // Decide how many gates the created schedulers may buffer before executing
+  // them. By default a fixed limit is used.
+  void setBatchingLimitPolicyFactory(
+      std::unique_ptr<IBatchingLimitPolicyFactory> batchingLimitPolicyFactory) {
+    batchingLimitPolicyFactory_ = std::move(batchingLimitPolicyFactory);
+  }
+
+  // Trace the schedulers created from now on, see ExecutionTracer. Each
+  // scheduler gets a tracer of its own, since tracers are not thread-safe.
+  // Tracing is off by default.
+  void enableExecutionTracing() {
+    isTracing_ = true;
+  }
+
+  // The tracers of the traced schedulers, in the order they were created.
+  const std::vector<std::shared_ptr<ExecutionTracer>>& getExecutionTracers()
+      const {
+    return tracers_;
   }
 
  private:
   std::unique_ptr<fbpcf::engine::ISecretShareEngineFactory> engineFactory_;
+  std::unique_ptr<IBatchingLimitPolicyFactory> batchingLimitPolicyFactory_ =
+      std::make_unique<FixedBatchingLimitPolicyFactory>();
+  bool isTracing_ = false;
+  std::vector<std::shared_ptr<ExecutionTracer>> tracers_;
 };
 
 template <bool unsafe>
@@ -327,6 +327,53 @@ PlaintextScheduler::publicXorPublicBatch(
   return privateXorPrivateBatch(left, right);
 }
 
+IScheduler::WireId<IScheduler::Boolean> PlaintextScheduler::multiXor(
+    const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  if (privateSrc.empty() && publicSrc.empty()) {
+    throw std::invalid_argument("No input to XOR.");
+  }
+  freeGates_ += privateSrc.size() + publicSrc.size() - 1 + negate;
+  bool rst = negate;
+  for (auto& wire : privateSrc) {
+    rst ^= wireKeeper_->getBooleanValue(wire);
+  }
+  for (auto& wire : publicSrc) {
+    rst ^= wireKeeper_->getBooleanValue(wire);
+  }
+  return wireKeeper_->allocateBooleanValue(rst);
+}
+
+IScheduler::WireId<IScheduler::Boolean> PlaintextScheduler::multiXorBatch(
+    const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  if (privateSrc.empty() && publicSrc.empty()) {
+    throw std::invalid_argument("No input to XOR.");
+  }
+  auto batchSize = wireKeeper_->getBatchSize(
+      privateSrc.empty() ? publicSrc.at(0) : privateSrc.at(0));
+  freeGates_ += (privateSrc.size() + publicSrc.size() - 1 + negate) * batchSize;
+  std::vector<bool> rst(batchSize, negate);
+  auto xorInto = [&](WireId<IScheduler::Boolean> wire) {
+    auto& values = wireKeeper_->getBatchBooleanValue(wire);
+    if (values.size() != batchSize) {
+      throw std::invalid_argument("invalid inputs!");
+    }
+    for (size_t i = 0; i < batchSize; i++) {
+      rst[i] = rst[i] ^ values[i];
+    }
+  };
+  for (auto& wire : privateSrc) {
+    xorInto(wire);
+  }
+  for (auto& wire : publicSrc) {
+    xorInto(wire);
+  }
+  return wireKeeper_->allocateBatchBooleanValue(rst, batchSize);
+}
+
 IScheduler::WireId<IScheduler::Boolean> PlaintextScheduler::notPrivate(
     WireId<IScheduler::Boolean> src) {
   freeGates_++;
@@ -499,6 +546,113 @@ IScheduler::WireId<IScheduler::Arithmetic> PlaintextScheduler::negPublicBatch(
   return negPrivateBatch(src);
 }
 
+IScheduler::WireId<IScheduler::Arithmetic>
+PlaintextScheduler::privateBooleansToInteger(
+    const std::vector<WireId<IScheduler::Boolean>>& bits) {
+  if (bits.empty()) {
+    throw std::invalid_argument("Need at least one bit to convert.");
+  }
+  if (bits.size() > 64) {
+    throw std::invalid_argument("Can't convert more than 64 bits.");
+  }
+  uint64_t rst = 0;
+  for (size_t i = 0; i < bits.size(); i++) {
+    rst += uint64_t(wireKeeper_->getBooleanValue(bits[i])) << i;
+  }
+  freeGates_ += bits.size();
+  return wireKeeper_->allocateIntegerValue(rst);
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+PlaintextScheduler::privateBooleansToIntegerBatch(
+    const std::vector<WireId<IScheduler::Boolean>>& bits) {
+  if (bits.empty()) {
+    throw std::invalid_argument("Need at least one bit to convert.");
+  }
+  if (bits.size() > 64) {
+    throw std::invalid_argument("Can't convert more than 64 bits.");
+  }
+  auto batchSize = wireKeeper_->getBatchSize(bits.at(0));
+  std::vector<uint64_t> rst(batchSize, 0);
+  for (size_t i = 0; i < bits.size(); i++) {
+    auto& values = wireKeeper_->getBatchBooleanValue(bits[i]);
+    if (values.size() != batchSize) {
+      throw std::invalid_argument("Inconsistent batch size.");
+    }
+    for (size_t j = 0; j < batchSize; j++) {
+      rst[j] += uint64_t(values[j]) << i;
+    }
+  }
+  freeGates_ += bits.size() * batchSize;
+  return wireKeeper_->allocateBatchIntegerValue(rst, batchSize);
+}
+
+// The plaintext scheduler acts as the only party, which holds the whole value.
+std::vector<std::vector<IScheduler::WireId<IScheduler::Boolean>>>
+PlaintextScheduler::privateIntegerShareBits(
+    WireId<IScheduler::Arithmetic> src,
+    size_t width) {
+  auto value = wireKeeper_->getIntegerValue(src);
+  std::vector<WireId<IScheduler::Boolean>> rst(width);
+  for (size_t i = 0; i < width; i++) {
+    rst[i] = wireKeeper_->allocateBooleanValue((value >> i) & 1);
+  }
+  freeGates_ += width;
+  return {rst};
+}
+
+std::vector<std::vector<IScheduler::WireId<IScheduler::Boolean>>>
+PlaintextScheduler::privateIntegerShareBitsBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t width) {
+  auto& values = wireKeeper_->getBatchIntegerValue(src);
+  std::vector<WireId<IScheduler::Boolean>> rst(width);
+  for (size_t i = 0; i < width; i++) {
+    std::vector<bool> bits(values.size());
+    for (size_t j = 0; j < values.size(); j++) {
+      bits[j] = (values[j] >> i) & 1;
+    }
+    rst[i] = wireKeeper_->allocateBatchBooleanValue(bits, values.size());
+  }
+  freeGates_ += width * values.size();
+  return {rst};
+}
+
+// The plaintext scheduler holds the whole value, which is truncated exactly.
+IScheduler::WireId<IScheduler::Arithmetic> PlaintextScheduler::truncatePrivate(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  freeGates_++;
+  return wireKeeper_->allocateIntegerValue(static_cast<uint64_t>(
+      static_cast<int64_t>(wireKeeper_->getIntegerValue(src)) >> bits));
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+PlaintextScheduler::truncatePrivateBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  auto& values = wireKeeper_->getBatchIntegerValue(src);
+  freeGates_ += values.size();
+  std::vector<uint64_t> rst(values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    rst[i] = static_cast<uint64_t>(static_cast<int64_t>(values[i]) >> bits);
+  }
+  return wireKeeper_->allocateBatchIntegerValue(rst, values.size());
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> PlaintextScheduler::truncatePublic(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  return truncatePrivate(src, bits);
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+PlaintextScheduler::truncatePublicBatch(
+    WireId<IScheduler::Arithmetic> src,
+    size_t bits) {
+  return truncatePrivateBatch(src, bits);
+}
+
 void PlaintextScheduler::increaseReferenceCount(
     WireId<IScheduler::Boolean> id) {
   wireKeeper_->increaseReferenceCount(id);
@@ -597,6 +751,22 @@ PlaintextScheduler::unbatching(
   return rst;
 }
 
+// select the values at the given positions of a batch into a new batch.
+IScheduler::WireId<IScheduler::Boolean> PlaintextScheduler::gathering(
+    WireId<Boolean> src,
+    std::shared_ptr<std::vector<uint32_t>> indexes) {
+  auto& batch = wireKeeper_->getBatchBooleanValue(src);
+  std::vector<bool> v(indexes->size());
+  for (size_t i = 0; i < v.size(); i++) {
+    if (indexes->at(i) >= batch.size()) {
+      throw std::runtime_error(
+          "Failed to gather, you are gathering a value beyond the input.");
+    }
+    v[i] = batch.at(indexes->at(i));
+  }
+  return wireKeeper_->allocateBatchBooleanValue(v, v.size());
+}
+
 std::vector<IScheduler::WireId<IScheduler::Boolean>>
 PlaintextScheduler::validateAndComputeBatchCompositeAND(
     IScheduler::WireId<IScheduler::Boolean> left,
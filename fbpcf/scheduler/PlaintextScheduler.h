@@ -314,6 +314,22 @@ class PlaintextScheduler : public IArithmeticScheduler {
       WireId<IScheduler::Boolean> left,
       WireId<IScheduler::Boolean> right) override;
 
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Boolean> multiXor(
+      const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Boolean> multiXorBatch(
+      const std::vector<WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
   // ------ Not gates ------
 
   /**
@@ -454,6 +470,65 @@ class PlaintextScheduler : public IArithmeticScheduler {
   WireId<IScheduler::Arithmetic> negPublicBatch(
       WireId<IScheduler::Arithmetic> src) override;
 
+  //======== Below are share conversion APIs: ========
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> privateBooleansToInteger(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> privateBooleansToIntegerBatch(
+      const std::vector<WireId<IScheduler::Boolean>>& bits) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<WireId<IScheduler::Boolean>>> privateIntegerShareBits(
+      WireId<IScheduler::Arithmetic> src,
+      size_t width) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<std::vector<WireId<IScheduler::Boolean>>>
+  privateIntegerShareBitsBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t width) override;
+
+  //======== Below are truncation APIs: ========
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePrivate(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePrivateBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePublic(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
+  /**
+   * @inherit doc
+   */
+  WireId<IScheduler::Arithmetic> truncatePublicBatch(
+      WireId<IScheduler::Arithmetic> src,
+      size_t bits) override;
+
   //======== Below are wire management APIs: ========
 
   /**
@@ -506,6 +581,11 @@ class PlaintextScheduler : public IArithmeticScheduler {
       WireId<Boolean> src,
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) override;
 
+  // select the values at the given positions of a batch into a new batch.
+  WireId<Boolean> gathering(
+      WireId<Boolean> src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) override;
+
   //======== Below are miscellaneous APIs: ========
 
   /**
@@ -8,27 +8,45 @@
 #pragma once
 
 #include <stdint.h>
-#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <optional>
-#include <queue>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 #include "fbpcf/scheduler/IAllocator.h"
 
 namespace fbpcf::scheduler {
 
 /**
- * This class provides access to a large, contiguous block of memory that is
- * allocated once and increased periodically. This can significantly reduce the
+ * This class provides access to a large, segmented block of memory that is
+ * allocated in geometrically growing chunks. This can significantly reduce the
  * number of system calls to allocate/deallocate memory.
  *
+ * Chunk k holds kFirstChunkSize * 2^k entries. Existing chunks are never
+ * reallocated, so growing the arena does not move (or copy) any live record
+ * and references returned by get/getWritableReference stay valid until the
+ * corresponding ID is freed. An ID is translated into its (chunk, offset)
+ * position with a couple of bit operations.
+ *
+ * Chunks of at least kHugePageSize bytes can optionally be backed by
+ * transparent huge pages to reduce TLB pressure with millions of live wires.
+ *
  * The "unsafe" version is more performant, but does not guard against accessing
  * unallocated or freed memory locations.
  */
 template <typename T, bool unsafe>
 class VectorArenaAllocator final : public IAllocator<T> {
  public:
-  VectorArenaAllocator() : nextAvailableBlockIndex_{0} {
+  explicit VectorArenaAllocator(bool useHugePages = false)
+      : useHugePages_{useHugePages}, capacity_{0}, nextUnusedId_{0} {
     increaseAllocation();
   }
 
@@ -36,11 +54,17 @@ class VectorArenaAllocator final : public IAllocator<T> {
    * @inherit doc
    */
   uint64_t allocate(T&& value) override {
-    if (nextAvailableBlockIndex_ >= blocks_.size()) {
-      increaseAllocation();
+    uint64_t id;
+    if (!freeBlocks_.empty()) {
+      id = freeBlocks_.back();
+      freeBlocks_.pop_back();
+    } else {
+      if (nextUnusedId_ >= capacity_) {
+        increaseAllocation();
+      }
+      id = nextUnusedId_++;
     }
-    auto id = freeBlocks_[nextAvailableBlockIndex_++];
-    blocks_[id] = value;
+    locate(id) = std::move(value);
     return id;
   }
 
@@ -48,9 +72,9 @@ class VectorArenaAllocator final : public IAllocator<T> {
    * @inherit doc
    */
   void free(uint64_t id) override {
-    freeBlocks_[--nextAvailableBlockIndex_] = id;
+    freeBlocks_.push_back(id);
     if constexpr (!unsafe) {
-      blocks_[id] = std::nullopt;
+      locate(id) = std::nullopt;
     }
   }
 
@@ -59,12 +83,13 @@ class VectorArenaAllocator final : public IAllocator<T> {
    */
   const T& get(uint64_t id) const override {
     if constexpr (unsafe) {
-      return blocks_.at(id);
+      return locate(id);
     } else {
-      if (blocks_.at(id) == std::nullopt) {
+      auto& block = checkedLocate(id);
+      if (block == std::nullopt) {
         throw std::runtime_error(IAllocator<T>::errorMessageCannotFindItem(id));
       }
-      return *blocks_.at(id);
+      return *block;
     }
   }
 
@@ -73,12 +98,13 @@ class VectorArenaAllocator final : public IAllocator<T> {
    */
   T& getWritableReference(uint64_t id) override {
     if constexpr (unsafe) {
-      return blocks_.at(id);
+      return locate(id);
     } else {
-      if (blocks_.at(id) == std::nullopt) {
+      auto& block = checkedLocate(id);
+      if (block == std::nullopt) {
         throw std::runtime_error(IAllocator<T>::errorMessageCannotFindItem(id));
       }
-      return *blocks_.at(id);
+      return *block;
     }
   }
 
@@ -87,32 +113,83 @@ class VectorArenaAllocator final : public IAllocator<T> {
   }
 
  private:
-  static const uint16_t kChunkSize = 1024;
+  // log2 of the number of entries in the first chunk.
+  static const uint8_t kFirstChunkSizeLog = 10;
+  static const uint64_t kFirstChunkSize = uint64_t(1) << kFirstChunkSizeLog;
+  static const size_t kHugePageSize = 2 * 1024 * 1024;
 
   using BlockType =
       typename std::conditional<unsafe, T, std::optional<T>>::type;
 
-  std::vector<BlockType> blocks_;
+  // Releases a chunk that was allocated in increaseAllocation().
+  class ChunkDeleter {
+   public:
+    ChunkDeleter() : size_{0}, alignment_{0} {}
+    ChunkDeleter(size_t size, size_t alignment)
+        : size_{size}, alignment_{alignment} {}
+
+    void operator()(BlockType* chunk) const {
+      for (size_t i = 0; i < size_; i++) {
+        chunk[i].~BlockType();
+      }
+      if (alignment_ > alignof(std::max_align_t)) {
+        ::operator delete(chunk, std::align_val_t{alignment_});
+      } else {
+        ::operator delete(chunk);
+      }
+    }
+
+   private:
+    size_t size_;
+    size_t alignment_;
+  };
+
+  using ChunkPointer = std::unique_ptr<BlockType[], ChunkDeleter>;
+
+  bool useHugePages_;
+  std::vector<ChunkPointer> chunks_;
   std::vector<uint64_t> freeBlocks_;
-  uint64_t nextAvailableBlockIndex_;
+  uint64_t capacity_;
+  uint64_t nextUnusedId_;
+
+  // Chunk k covers IDs [kFirstChunkSize * (2^k - 1), kFirstChunkSize *
+  // (2^(k+1) - 1)), hence the most significant bit of (id + kFirstChunkSize)
+  // determines the chunk and the remaining bits the offset within it.
+  inline BlockType& locate(uint64_t id) const {
+    auto shifted = id + kFirstChunkSize;
+    auto msb = 63 - __builtin_clzll(shifted);
+    return chunks_[msb - kFirstChunkSizeLog][shifted ^ (uint64_t(1) << msb)];
+  }
 
-  void increaseAllocation() {
-    auto allocatedSize = blocks_.size();
-    std::vector<uint64_t> newFreeBlocks(kChunkSize);
-    for (auto i = 0; i < kChunkSize; ++i) {
-      newFreeBlocks[i] = allocatedSize + i;
+  BlockType& checkedLocate(uint64_t id) const {
+    if (id >= capacity_) {
+      throw std::runtime_error(IAllocator<T>::errorMessageCannotFindItem(id));
     }
+    return locate(id);
+  }
 
-    freeBlocks_.insert(
-        freeBlocks_.end(), newFreeBlocks.begin(), newFreeBlocks.end());
+  void increaseAllocation() {
+    size_t chunkSize = kFirstChunkSize << chunks_.size();
+    size_t bytes = chunkSize * sizeof(BlockType);
+    bool hugePages = useHugePages_ && bytes >= kHugePageSize;
+    size_t alignment = hugePages ? kHugePageSize : alignof(BlockType);
+
+    void* memory = alignment > alignof(std::max_align_t)
+        ? ::operator new(bytes, std::align_val_t{alignment})
+        : ::operator new(bytes);
+#ifdef __linux__
+    if (hugePages) {
+      // This is only a hint, ignore failures on kernels without THP support.
+      madvise(memory, bytes, MADV_HUGEPAGE);
+    }
+#endif
 
-    std::vector<BlockType> newBlocks;
-    if constexpr (unsafe) {
-      newBlocks = std::vector<BlockType>(kChunkSize);
-    } else {
-      newBlocks = std::vector<BlockType>(kChunkSize, std::nullopt);
+    auto chunk = static_cast<BlockType*>(memory);
+    for (size_t i = 0; i < chunkSize; i++) {
+      new (chunk + i) BlockType();
     }
-    blocks_.insert(blocks_.end(), newBlocks.begin(), newBlocks.end());
+    chunks_.push_back(ChunkPointer(chunk, ChunkDeleter(chunkSize, alignment)));
+    capacity_ += chunkSize;
   }
 };
 
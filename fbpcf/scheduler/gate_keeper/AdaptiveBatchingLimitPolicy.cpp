@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "fbpcf/scheduler/gate_keeper/AdaptiveBatchingLimitPolicy.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace fbpcf::scheduler {
+
+AdaptiveBatchingLimitPolicy::AdaptiveBatchingLimitPolicy(Config config)
+    : config_{config},
+      batchingLimit_{config.initialBatchingLimit},
+      minRoundTripTime_{std::chrono::nanoseconds::zero()},
+      windowMinRoundTripTime_{std::chrono::nanoseconds::max()} {
+  if (config_.minBatchingLimit == 0 ||
+      config_.minBatchingLimit > config_.maxBatchingLimit) {
+    throw std::invalid_argument("Invalid batching limit bounds.");
+  }
+  batchingLimit_ = std::clamp(
+      batchingLimit_, config_.minBatchingLimit, config_.maxBatchingLimit);
+}
+
+void AdaptiveBatchingLimitPolicy::recordLevelExecution(
+    const LevelExecutionStatistics& statistics) {
+  if (statistics.liveWires > config_.maxLiveWires) {
+    scaleBatchingLimit(0.5);
+    return;
+  }
+
+  // Free levels and levels without traffic tell nothing about the network.
+  if (statistics.isFree ||
+      statistics.bytesSent + statistics.bytesReceived == 0) {
+    return;
+  }
+
+  updateRoundTripTime(statistics.duration);
+  double roundTrips = static_cast<double>(statistics.duration.count()) /
+      std::max<int64_t>(minRoundTripTime_.count(), 1);
+  if (minRoundTripTime_ < config_.minHighLatencyRoundTripTime ||
+      roundTrips > kShrinkThreshold) {
+    scaleBatchingLimit(kShrinkFactor);
+  } else if (roundTrips < kGrowThreshold) {
+    scaleBatchingLimit(kGrowFactor);
+  }
+}
+
+void AdaptiveBatchingLimitPolicy::updateRoundTripTime(
+    std::chrono::nanoseconds duration) {
+  windowMinRoundTripTime_ = std::min(windowMinRoundTripTime_, duration);
+  minRoundTripTime_ = numberOfRoundTripTimeSamples_ == 0
+      ? duration
+      : std::min(minRoundTripTime_, duration);
+  // Restart the estimate periodically so that it follows changes in the
+  // network conditions.
+  if (++numberOfRoundTripTimeSamples_ % kRoundTripTimeWindow == 0) {
+    minRoundTripTime_ = windowMinRoundTripTime_;
+    windowMinRoundTripTime_ = std::chrono::nanoseconds::max();
+  }
+}
+
+void AdaptiveBatchingLimitPolicy::scaleBatchingLimit(double factor) {
+  auto scaled = static_cast<double>(batchingLimit_) * factor;
+  if (scaled >= static_cast<double>(config_.maxBatchingLimit)) {
+    batchingLimit_ = config_.maxBatchingLimit;
+  } else {
+    batchingLimit_ =
+        std::max(static_cast<uint64_t>(scaled), config_.minBatchingLimit);
+  }
+}
+
+} // namespace fbpcf::scheduler
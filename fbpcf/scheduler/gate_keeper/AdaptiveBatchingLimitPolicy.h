@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicy.h"
+
+namespace fbpcf::scheduler {
+
+/**
+ * This policy adjusts the batching limit at runtime from what it observes on
+ * non-free levels:
+ *  - The round trip time is estimated as the shortest time it took to execute
+ *    a level that actually communicated, over a sliding window of levels.
+ *  - If the round trip time is below the configured absolute latency floor,
+ *    rounds are cheap and larger windows only cost memory, so the limit
+ *    shrinks (LAN).
+ *  - Otherwise, if a level completes within kGrowThreshold round trips, the
+ *    round is dominated by latency and putting more gates in it is almost
+ *    free, so the limit grows (WAN).
+ *  - If a level takes more than kShrinkThreshold round trips, the round is
+ *    dominated by bandwidth or computation, so the limit shrinks as well.
+ *  - If the number of live wires exceeds the configured bound, the limit is
+ *    halved regardless of the network.
+ * The limit always stays within [minBatchingLimit, maxBatchingLimit].
+ */
+class AdaptiveBatchingLimitPolicy final : public IBatchingLimitPolicy {
+ public:
+  struct Config {
+    uint64_t initialBatchingLimit = 100000;
+    uint64_t minBatchingLimit = 10000;
+    uint64_t maxBatchingLimit = 10000000;
+    // Upper bound on the number of live wires, used as a proxy for memory.
+    uint64_t maxLiveWires = 100000000;
+    // Round trips shorter than this are considered low latency, the limit
+    // only grows when the round trip time reaches it.
+    std::chrono::nanoseconds minHighLatencyRoundTripTime =
+        std::chrono::milliseconds(5);
+  };
+
+  explicit AdaptiveBatchingLimitPolicy(Config config);
+
+  /**
+   * @inherit doc
+   */
+  uint64_t getBatchingLimit() const override {
+    return batchingLimit_;
+  }
+
+  /**
+   * @inherit doc
+   */
+  void recordLevelExecution(
+      const LevelExecutionStatistics& statistics) override;
+
+  // The current round trip time estimate, zero before any non-free level with
+  // traffic has been executed.
+  std::chrono::nanoseconds getRoundTripTimeEstimate() const {
+    return minRoundTripTime_;
+  }
+
+ private:
+  static constexpr double kGrowThreshold = 2.0;
+  static constexpr double kShrinkThreshold = 4.0;
+  static constexpr double kGrowFactor = 2.0;
+  static constexpr double kShrinkFactor = 0.75;
+  static const uint32_t kRoundTripTimeWindow = 64;
+
+  Config config_;
+  uint64_t batchingLimit_;
+
+  std::chrono::nanoseconds minRoundTripTime_;
+  std::chrono::nanoseconds windowMinRoundTripTime_;
+  uint64_t numberOfRoundTripTimeSamples_ = 0;
+
+  void updateRoundTripTime(std::chrono::nanoseconds duration);
+  void scaleBatchingLimit(double factor);
+};
+
+} // namespace fbpcf::scheduler
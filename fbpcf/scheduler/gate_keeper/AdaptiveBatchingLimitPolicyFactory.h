@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "fbpcf/scheduler/gate_keeper/AdaptiveBatchingLimitPolicy.h"
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicyFactory.h"
+
+namespace fbpcf::scheduler {
+
+class AdaptiveBatchingLimitPolicyFactory final
+    : public IBatchingLimitPolicyFactory {
+ public:
+  explicit AdaptiveBatchingLimitPolicyFactory(
+      AdaptiveBatchingLimitPolicy::Config config =
+          AdaptiveBatchingLimitPolicy::Config())
+      : config_{config} {}
+
+  std::unique_ptr<IBatchingLimitPolicy> create() override {
+    return std::make_unique<AdaptiveBatchingLimitPolicy>(config_);
+  }
+
+ private:
+  AdaptiveBatchingLimitPolicy::Config config_;
+};
+
+} // namespace fbpcf::scheduler
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicy.h"
+
+namespace fbpcf::scheduler {
+
+/**
+ * This policy always allows the same number of unexecuted gates.
+ */
+class FixedBatchingLimitPolicy final : public IBatchingLimitPolicy {
+ public:
+  static const uint64_t kDefaultMaxUnexecutedGates = 100000;
+
+  explicit FixedBatchingLimitPolicy(
+      uint64_t maxUnexecutedGates = kDefaultMaxUnexecutedGates)
+      : maxUnexecutedGates_{maxUnexecutedGates} {}
+
+  /**
+   * @inherit doc
+   */
+  uint64_t getBatchingLimit() const override {
+    return maxUnexecutedGates_;
+  }
+
+  /**
+   * @inherit doc
+   */
+  void recordLevelExecution(const LevelExecutionStatistics&) override {}
+
+ private:
+  uint64_t maxUnexecutedGates_;
+};
+
+} // namespace fbpcf::scheduler
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "fbpcf/scheduler/gate_keeper/FixedBatchingLimitPolicy.h"
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicyFactory.h"
+
+namespace fbpcf::scheduler {
+
+class FixedBatchingLimitPolicyFactory final
+    : public IBatchingLimitPolicyFactory {
+ public:
+  explicit FixedBatchingLimitPolicyFactory(
+      uint64_t maxUnexecutedGates =
+          FixedBatchingLimitPolicy::kDefaultMaxUnexecutedGates)
+      : maxUnexecutedGates_{maxUnexecutedGates} {}
+
+  std::unique_ptr<IBatchingLimitPolicy> create() override {
+    return std::make_unique<FixedBatchingLimitPolicy>(maxUnexecutedGates_);
+  }
+
+ private:
+  uint64_t maxUnexecutedGates_;
+};
+
+} // namespace fbpcf::scheduler
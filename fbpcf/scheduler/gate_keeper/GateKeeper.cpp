@@ -16,14 +16,21 @@
 #include "fbpcf/scheduler/gate_keeper/BatchCompositeGate.h"
 #include "fbpcf/scheduler/gate_keeper/BatchNormalGate.h"
 #include "fbpcf/scheduler/gate_keeper/CompositeGate.h"
+#include "fbpcf/scheduler/gate_keeper/GateLevel.h"
 #include "fbpcf/scheduler/gate_keeper/IArithmeticGate.h"
 #include "fbpcf/scheduler/gate_keeper/IGate.h"
 #include "fbpcf/scheduler/gate_keeper/INormalGate.h"
 #include "fbpcf/scheduler/gate_keeper/NormalGate.h"
+#include "fbpcf/scheduler/gate_keeper/ShareConversionGate.h"
+#include "fbpcf/scheduler/gate_keeper/TruncationGate.h"
 
 namespace fbpcf::scheduler {
-GateKeeper::GateKeeper(std::shared_ptr<IWireKeeper> wireKeeper)
-    : wireKeeper_{wireKeeper} {}
+GateKeeper::GateKeeper(
+    std::shared_ptr<IWireKeeper> wireKeeper,
+    std::unique_ptr<IBatchingLimitPolicy> batchingLimitPolicy)
+    : wireKeeper_{wireKeeper},
+      gateSlabPool_{std::make_shared<GateSlabPool>()},
+      batchingLimitPolicy_{std::move(batchingLimitPolicy)} {}
 
 IScheduler::WireId<IScheduler::Boolean> GateKeeper::inputGate(
     BoolType<false> initialValue) {
@@ -31,15 +38,14 @@ IScheduler::WireId<IScheduler::Boolean> GateKeeper::inputGate(
       GateClass<false>::isFree(INormalGate::GateType::Input),
       firstUnexecutedLevel_);
   auto outputWire = allocateNewWire(initialValue, level);
-  addGate(
-      std::make_unique<NormalGate>(
-          INormalGate::GateType::Input,
-          outputWire,
-          IScheduler::WireId<IScheduler::Boolean>(),
-          IScheduler::WireId<IScheduler::Boolean>(),
-          0,
-          *wireKeeper_),
-      level);
+  addGate<NormalGate>(
+      level,
+      INormalGate::GateType::Input,
+      outputWire,
+      IScheduler::WireId<IScheduler::Boolean>(),
+      IScheduler::WireId<IScheduler::Boolean>(),
+      0,
+      *wireKeeper_);
   return outputWire;
 }
 
@@ -49,15 +55,14 @@ IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::inputGate(
       IArithmeticGate::isFree(IArithmeticGate::GateType::Input),
       firstUnexecutedLevel_);
   auto outputWire = allocateNewWire(initialValue, level);
-  addGate(
-      std::make_unique<ArithmeticGate>(
-          IArithmeticGate::GateType::Input,
-          outputWire,
-          IScheduler::WireId<IScheduler::Arithmetic>(),
-          IScheduler::WireId<IScheduler::Arithmetic>(),
-          0,
-          *wireKeeper_),
-      level);
+  addGate<ArithmeticGate>(
+      level,
+      IArithmeticGate::GateType::Input,
+      outputWire,
+      IScheduler::WireId<IScheduler::Arithmetic>(),
+      IScheduler::WireId<IScheduler::Arithmetic>(),
+      0,
+      *wireKeeper_);
   return outputWire;
 }
 
@@ -69,16 +74,15 @@ IScheduler::WireId<IScheduler::Boolean> GateKeeper::inputGateBatch(
       firstUnexecutedLevel_);
 
   auto outputWire = allocateNewWire(initialValue, level, size);
-  addGate(
-      std::make_unique<BatchNormalGate>(
-          INormalGate::GateType::Input,
-          outputWire,
-          IScheduler::WireId<IScheduler::Boolean>(),
-          IScheduler::WireId<IScheduler::Boolean>(),
-          0,
-          size,
-          *wireKeeper_),
-      level);
+  addGate<BatchNormalGate>(
+      level,
+      INormalGate::GateType::Input,
+      outputWire,
+      IScheduler::WireId<IScheduler::Boolean>(),
+      IScheduler::WireId<IScheduler::Boolean>(),
+      0,
+      size,
+      *wireKeeper_);
   return outputWire;
 }
 
@@ -90,16 +94,15 @@ IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::inputGateBatch(
       firstUnexecutedLevel_);
 
   auto outputWire = allocateNewWire(initialValue, level, size);
-  addGate(
-      std::make_unique<BatchArithmeticGate>(
-          IArithmeticGate::GateType::Input,
-          outputWire,
-          IScheduler::WireId<IScheduler::Arithmetic>(),
-          IScheduler::WireId<IScheduler::Arithmetic>(),
-          0,
-          size,
-          *wireKeeper_),
-      level);
+  addGate<BatchArithmeticGate>(
+      level,
+      IArithmeticGate::GateType::Input,
+      outputWire,
+      IScheduler::WireId<IScheduler::Arithmetic>(),
+      IScheduler::WireId<IScheduler::Arithmetic>(),
+      0,
+      size,
+      *wireKeeper_);
   return outputWire;
 }
 
@@ -111,15 +114,14 @@ IScheduler::WireId<IScheduler::Boolean> GateKeeper::outputGate(
       getMaxLevel<false, IScheduler::Boolean>(src));
   auto outputWire = allocateNewWire(false, level);
 
-  addGate(
-      std::make_unique<NormalGate>(
-          INormalGate::GateType::Output,
-          outputWire,
-          src,
-          IScheduler::WireId<IScheduler::Boolean>(),
-          partyID,
-          *wireKeeper_),
-      level);
+  addGate<NormalGate>(
+      level,
+      INormalGate::GateType::Output,
+      outputWire,
+      src,
+      IScheduler::WireId<IScheduler::Boolean>(),
+      partyID,
+      *wireKeeper_);
 
   return outputWire;
 }
@@ -132,15 +134,14 @@ IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::outputGate(
       getMaxLevel<false, IScheduler::Arithmetic>(src));
   auto outputWire = allocateNewWire((uint64_t)0, level);
 
-  addGate(
-      std::make_unique<ArithmeticGate>(
-          IArithmeticGate::GateType::Output,
-          outputWire,
-          src,
-          IScheduler::WireId<IScheduler::Arithmetic>(),
-          partyID,
-          *wireKeeper_),
-      level);
+  addGate<ArithmeticGate>(
+      level,
+      IArithmeticGate::GateType::Output,
+      outputWire,
+      src,
+      IScheduler::WireId<IScheduler::Arithmetic>(),
+      partyID,
+      *wireKeeper_);
 
   return outputWire;
 }
@@ -155,16 +156,15 @@ IScheduler::WireId<IScheduler::Boolean> GateKeeper::outputGateBatch(
   auto outputWire =
       allocateNewWire(std::vector<bool>(), level, expectedBatchSize);
 
-  addGate(
-      std::make_unique<BatchNormalGate>(
-          INormalGate::GateType::Output,
-          outputWire,
-          src,
-          IScheduler::WireId<IScheduler::Boolean>(),
-          partyID,
-          expectedBatchSize,
-          *wireKeeper_),
-      level);
+  addGate<BatchNormalGate>(
+      level,
+      INormalGate::GateType::Output,
+      outputWire,
+      src,
+      IScheduler::WireId<IScheduler::Boolean>(),
+      partyID,
+      expectedBatchSize,
+      *wireKeeper_);
 
   return outputWire;
 }
@@ -179,16 +179,15 @@ IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::outputGateBatch(
   auto outputWire =
       allocateNewWire(std::vector<uint64_t>(), level, expectedBatchSize);
 
-  addGate(
-      std::make_unique<BatchArithmeticGate>(
-          IArithmeticGate::GateType::Output,
-          outputWire,
-          src,
-          IScheduler::WireId<IScheduler::Arithmetic>(),
-          partyID,
-          expectedBatchSize,
-          *wireKeeper_),
-      level);
+  addGate<BatchArithmeticGate>(
+      level,
+      IArithmeticGate::GateType::Output,
+      outputWire,
+      src,
+      IScheduler::WireId<IScheduler::Arithmetic>(),
+      partyID,
+      expectedBatchSize,
+      *wireKeeper_);
 
   return outputWire;
 }
@@ -204,10 +203,8 @@ IScheduler::WireId<IScheduler::Boolean> GateKeeper::normalGate(
           getMaxLevel<false, IScheduler::Boolean>(right)));
   auto outputWire = allocateNewWire(false, level);
 
-  addGate(
-      std::make_unique<NormalGate>(
-          gateType, outputWire, left, right, 0, *wireKeeper_),
-      level);
+  addGate<NormalGate>(
+      level, gateType, outputWire, left, right, 0, *wireKeeper_);
 
   return outputWire;
 }
@@ -225,16 +222,15 @@ IScheduler::WireId<IScheduler::Boolean> GateKeeper::normalGateBatch(
   auto outputWire =
       allocateNewWire(std::vector<bool>(), level, expectedBatchSize);
 
-  addGate(
-      std::make_unique<BatchNormalGate>(
-          gateType,
-          outputWire,
-          left,
-          right,
-          0,
-          expectedBatchSize,
-          *wireKeeper_),
-      level);
+  addGate<BatchNormalGate>(
+      level,
+      gateType,
+      outputWire,
+      left,
+      right,
+      0,
+      expectedBatchSize,
+      *wireKeeper_);
 
   return outputWire;
 }
@@ -250,10 +246,8 @@ IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::arithmeticGate(
           getMaxLevel<false, IScheduler::Arithmetic>(right)));
   auto outputWire = allocateNewWire((uint64_t)0, level);
 
-  addGate(
-      std::make_unique<ArithmeticGate>(
-          gateType, outputWire, left, right, 0, *wireKeeper_),
-      level);
+  addGate<ArithmeticGate>(
+      level, gateType, outputWire, left, right, 0, *wireKeeper_);
 
   return outputWire;
 }
@@ -271,16 +265,15 @@ IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::arithmeticGateBatch(
   auto outputWire =
       allocateNewWire(std::vector<uint64_t>(), level, expectedBatchSize);
 
-  addGate(
-      std::make_unique<BatchArithmeticGate>(
-          gateType,
-          outputWire,
-          left,
-          right,
-          0,
-          expectedBatchSize,
-          *wireKeeper_),
-      level);
+  addGate<BatchArithmeticGate>(
+      level,
+      gateType,
+      outputWire,
+      left,
+      right,
+      0,
+      expectedBatchSize,
+      *wireKeeper_);
 
   return outputWire;
 }
@@ -301,10 +294,8 @@ std::vector<IScheduler::WireId<IScheduler::Boolean>> GateKeeper::compositeGate(
     outputWires[i] = allocateNewWire(false, level);
   }
 
-  addGate(
-      std::make_unique<CompositeGate>(
-          gateType, outputWires, left, rights, *wireKeeper_),
-      level);
+  addGate<CompositeGate>(
+      level, gateType, outputWires, left, rights, *wireKeeper_);
 
   return outputWires;
 }
@@ -328,26 +319,184 @@ GateKeeper::compositeGateBatch(
         allocateNewWire(std::vector<bool>(), level, expectedBatchSize);
   }
 
-  addGate(
-      std::make_unique<BatchCompositeGate>(
-          gateType, outputWires, left, rights, *wireKeeper_),
-      level);
+  addGate<BatchCompositeGate>(
+      level, gateType, outputWires, left, rights, *wireKeeper_);
 
   return outputWires;
 }
 
+IScheduler::WireId<IScheduler::Boolean> GateKeeper::multiXorGate(
+    const std::vector<IScheduler::WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<IScheduler::WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  if (privateSrc.empty() && publicSrc.empty()) {
+    throw std::invalid_argument("No input to XOR.");
+  }
+  auto inputs = privateSrc;
+  inputs.insert(inputs.end(), publicSrc.begin(), publicSrc.end());
+  auto level =
+      getOutputLevel(/* isGateFree */ true, getMaxLevel<false>(inputs));
+  auto outputWire = allocateNewWire(false, level);
+
+  // counted as the chain of two-input gates it replaces
+  addGate<MultiXorGate<false>>(
+      level,
+      privateSrc,
+      publicSrc,
+      outputWire,
+      negate,
+      inputs.size() - 1 + negate,
+      *wireKeeper_);
+
+  return outputWire;
+}
+
+IScheduler::WireId<IScheduler::Boolean> GateKeeper::multiXorGateBatch(
+    const std::vector<IScheduler::WireId<IScheduler::Boolean>>& privateSrc,
+    const std::vector<IScheduler::WireId<IScheduler::Boolean>>& publicSrc,
+    bool negate) {
+  if (privateSrc.empty() && publicSrc.empty()) {
+    throw std::invalid_argument("No input to XOR.");
+  }
+  auto inputs = privateSrc;
+  inputs.insert(inputs.end(), publicSrc.begin(), publicSrc.end());
+  auto level = getOutputLevel(/* isGateFree */ true, getMaxLevel<true>(inputs));
+  auto expectedBatchSize = wireKeeper_->getBatchSize(inputs.at(0));
+  auto outputWire =
+      allocateNewWire(std::vector<bool>(), level, expectedBatchSize);
+
+  addGate<MultiXorGate<true>>(
+      level,
+      privateSrc,
+      publicSrc,
+      outputWire,
+      negate,
+      (inputs.size() - 1 + negate) * expectedBatchSize,
+      *wireKeeper_);
+
+  return outputWire;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+GateKeeper::booleanShareToIntegerGate(
+    IScheduler::WireId<IScheduler::Boolean> src,
+    int partyID) {
+  auto level = getOutputLevel(
+      /* isGateFree */ true, getMaxLevel<false, IScheduler::Boolean>(src));
+  auto outputWire = allocateNewWire((uint64_t)0, level);
+
+  addGate<ShareConversionGate<false>>(
+      level, src, outputWire, partyID, 1, *wireKeeper_);
+
+  return outputWire;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic>
+GateKeeper::booleanShareToIntegerGateBatch(
+    IScheduler::WireId<IScheduler::Boolean> src,
+    int partyID) {
+  auto level = getOutputLevel(
+      /* isGateFree */ true, getMaxLevel<true, IScheduler::Boolean>(src));
+  auto expectedBatchSize = wireKeeper_->getBatchSize(src);
+  auto outputWire =
+      allocateNewWire(std::vector<uint64_t>(), level, expectedBatchSize);
+
+  addGate<ShareConversionGate<true>>(
+      level, src, outputWire, partyID, expectedBatchSize, *wireKeeper_);
+
+  return outputWire;
+}
+
+std::vector<IScheduler::WireId<IScheduler::Boolean>>
+GateKeeper::integerShareToBooleansGate(
+    IScheduler::WireId<IScheduler::Arithmetic> src,
+    int partyID,
+    size_t width) {
+  auto level = getOutputLevel(
+      /* isGateFree */ true, getMaxLevel<false, IScheduler::Arithmetic>(src));
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> outputWires(width);
+  for (size_t i = 0; i < width; i++) {
+    outputWires[i] = allocateNewWire(false, level);
+  }
+
+  addGate<ShareConversionGate<false>>(
+      level, src, outputWires, partyID, width, *wireKeeper_);
+
+  return outputWires;
+}
+
+std::vector<IScheduler::WireId<IScheduler::Boolean>>
+GateKeeper::integerShareToBooleansGateBatch(
+    IScheduler::WireId<IScheduler::Arithmetic> src,
+    int partyID,
+    size_t width) {
+  auto level = getOutputLevel(
+      /* isGateFree */ true, getMaxLevel<true, IScheduler::Arithmetic>(src));
+  auto expectedBatchSize = wireKeeper_->getBatchSize(src);
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> outputWires(width);
+  for (size_t i = 0; i < width; i++) {
+    outputWires[i] =
+        allocateNewWire(std::vector<bool>(), level, expectedBatchSize);
+  }
+
+  addGate<ShareConversionGate<true>>(
+      level,
+      src,
+      outputWires,
+      partyID,
+      width * expectedBatchSize,
+      *wireKeeper_);
+
+  return outputWires;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::truncationGate(
+    IScheduler::WireId<IScheduler::Arithmetic> src,
+    size_t bits,
+    bool isPrivate) {
+  auto level = getOutputLevel(
+      /* isGateFree */ true, getMaxLevel<false, IScheduler::Arithmetic>(src));
+  auto outputWire = allocateNewWire((uint64_t)0, level);
+
+  addGate<TruncationGate<false>>(
+      level, src, outputWire, bits, isPrivate, 1, *wireKeeper_);
+
+  return outputWire;
+}
+
+IScheduler::WireId<IScheduler::Arithmetic> GateKeeper::truncationGateBatch(
+    IScheduler::WireId<IScheduler::Arithmetic> src,
+    size_t bits,
+    bool isPrivate) {
+  auto level = getOutputLevel(
+      /* isGateFree */ true, getMaxLevel<true, IScheduler::Arithmetic>(src));
+  auto expectedBatchSize = wireKeeper_->getBatchSize(src);
+  auto outputWire =
+      allocateNewWire(std::vector<uint64_t>(), level, expectedBatchSize);
+
+  addGate<TruncationGate<true>>(
+      level,
+      src,
+      outputWire,
+      bits,
+      isPrivate,
+      expectedBatchSize,
+      *wireKeeper_);
+
+  return outputWire;
+}
+
 // band a number of boolean batches into one batch.
 IScheduler::WireId<IScheduler::Boolean> GateKeeper::batchingUp(
     std::vector<IScheduler::WireId<IScheduler::Boolean>> src) {
   auto level = getOutputLevel(true, getMaxLevel<true>(src));
   uint32_t batchSize = 0;
   for (auto& item : src) {
-    batchSize += wireKeeper_->getBatchBooleanValue(item).size();
+    // the values of the source wires may not have been computed yet
+    batchSize += wireKeeper_->getBatchSize(item);
   }
   auto outputWire = allocateNewWire(std::vector<bool>(), level, batchSize);
-  addGate(
-      std::make_unique<RebatchingBooleanGate>(src, outputWire, *wireKeeper_),
-      level);
+  addGate<RebatchingBooleanGate>(level, src, outputWire, *wireKeeper_);
   return outputWire;
 }
 
@@ -363,18 +512,36 @@ std::vector<IScheduler::WireId<IScheduler::Boolean>> GateKeeper::unbatching(
     outputWires[i] =
         allocateNewWire(std::vector<bool>(), level, unbatchingStrategy->at(i));
   }
-  addGate(
-      std::make_unique<RebatchingBooleanGate>(
-          src, outputWires, *wireKeeper_, unbatchingStrategy),
-      level);
+  addGate<RebatchingBooleanGate>(
+      level, src, outputWires, *wireKeeper_, unbatchingStrategy);
   return outputWires;
 }
 
+// select the boolean values at the given positions of a batch into a new
+// batch.
+IScheduler::WireId<IScheduler::Boolean> GateKeeper::gathering(
+    IScheduler::WireId<IScheduler::Boolean> src,
+    std::shared_ptr<std::vector<uint32_t>> indexes) {
+  auto batchSize = wireKeeper_->getBatchSize(src);
+  for (auto index : *indexes) {
+    if (index >= batchSize) {
+      throw std::runtime_error(
+          "Failed to gather, you are gathering a value beyond the input.");
+    }
+  }
+  auto level =
+      getOutputLevel(true, wireKeeper_->getBatchFirstAvailableLevel(src));
+  auto outputWire =
+      allocateNewWire(std::vector<bool>(), level, indexes->size());
+  addGate<RebatchingBooleanGate>(level, src, outputWire, *wireKeeper_, indexes);
+  return outputWire;
+}
+
 uint32_t GateKeeper::getFirstUnexecutedLevel() const {
   return firstUnexecutedLevel_;
 }
 
-std::vector<std::unique_ptr<IGate>> GateKeeper::popFirstUnexecutedLevel() {
+GateLevel GateKeeper::popFirstUnexecutedLevel() {
   auto gates = std::move(gatesByLevelOffset_.front());
   gatesByLevelOffset_.pop_front();
   ++firstUnexecutedLevel_;
@@ -383,7 +550,12 @@ std::vector<std::unique_ptr<IGate>> GateKeeper::popFirstUnexecutedLevel() {
 }
 
 bool GateKeeper::hasReachedBatchingLimit() const {
-  return numUnexecutedGates_ > kMaxUnexecutedGates;
+  return numUnexecutedGates_ > batchingLimitPolicy_->getBatchingLimit();
+}
+
+void GateKeeper::recordLevelExecution(
+    const LevelExecutionStatistics& statistics) {
+  batchingLimitPolicy_->recordLevelExecution(statistics);
 }
 
 } // namespace fbpcf::scheduler
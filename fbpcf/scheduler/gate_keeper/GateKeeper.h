@@ -14,13 +14,19 @@
 
 #include <fbpcf/scheduler/IScheduler.h>
 #include <fbpcf/scheduler/gate_keeper/INormalGate.h>
+#include "fbpcf/scheduler/gate_keeper/FixedBatchingLimitPolicy.h"
+#include "fbpcf/scheduler/gate_keeper/GateLevel.h"
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicy.h"
 #include "fbpcf/scheduler/gate_keeper/IGateKeeper.h"
 
 namespace fbpcf::scheduler {
 
 class GateKeeper : public IGateKeeper {
  public:
-  explicit GateKeeper(std::shared_ptr<IWireKeeper> wireKeeper);
+  explicit GateKeeper(
+      std::shared_ptr<IWireKeeper> wireKeeper,
+      std::unique_ptr<IBatchingLimitPolicy> batchingLimitPolicy =
+          std::make_unique<FixedBatchingLimitPolicy>());
 
   /**
    * @inherit doc
@@ -126,6 +132,70 @@ class GateKeeper : public IGateKeeper {
       IScheduler::WireId<IScheduler::Boolean> left,
       std::vector<IScheduler::WireId<IScheduler::Boolean>> rights) override;
 
+  /**
+   * @inherit doc
+   */
+  IScheduler::WireId<IScheduler::Boolean> multiXorGate(
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
+  /**
+   * @inherit doc
+   */
+  IScheduler::WireId<IScheduler::Boolean> multiXorGateBatch(
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) override;
+
+  /**
+   * @inherit doc
+   */
+  IScheduler::WireId<IScheduler::Arithmetic> booleanShareToIntegerGate(
+      IScheduler::WireId<IScheduler::Boolean> src,
+      int partyID) override;
+
+  /**
+   * @inherit doc
+   */
+  IScheduler::WireId<IScheduler::Arithmetic> booleanShareToIntegerGateBatch(
+      IScheduler::WireId<IScheduler::Boolean> src,
+      int partyID) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<IScheduler::WireId<IScheduler::Boolean>>
+  integerShareToBooleansGate(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      int partyID,
+      size_t width) override;
+
+  /**
+   * @inherit doc
+   */
+  std::vector<IScheduler::WireId<IScheduler::Boolean>>
+  integerShareToBooleansGateBatch(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      int partyID,
+      size_t width) override;
+
+  /**
+   * @inherit doc
+   */
+  IScheduler::WireId<IScheduler::Arithmetic> truncationGate(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      size_t bits,
+      bool isPrivate) override;
+
+  /**
+   * @inherit doc
+   */
+  IScheduler::WireId<IScheduler::Arithmetic> truncationGateBatch(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      size_t bits,
+      bool isPrivate) override;
+
   // band a number of boolean batches into one batch.
   IScheduler::WireId<IScheduler::Boolean> batchingUp(
       std::vector<IScheduler::WireId<IScheduler::Boolean>> src) override;
@@ -135,6 +205,12 @@ class GateKeeper : public IGateKeeper {
       IScheduler::WireId<IScheduler::Boolean> src,
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) override;
 
+  // select the boolean values at the given positions of a batch into a new
+  // batch.
+  IScheduler::WireId<IScheduler::Boolean> gathering(
+      IScheduler::WireId<IScheduler::Boolean> src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) override;
+
   /**
    * @inherit doc
    */
@@ -143,13 +219,19 @@ class GateKeeper : public IGateKeeper {
   /**
    * @inherit doc
    */
-  std::vector<std::unique_ptr<IGate>> popFirstUnexecutedLevel() override;
+  GateLevel popFirstUnexecutedLevel() override;
 
   /**
    * @inherit doc
    */
   bool hasReachedBatchingLimit() const override;
 
+  /**
+   * @inherit doc
+   */
+  void recordLevelExecution(
+      const LevelExecutionStatistics& statistics) override;
+
  private:
   template <bool isCompositeWire>
   using GateClass = typename std::
@@ -167,26 +249,29 @@ class GateKeeper : public IGateKeeper {
       std::vector<IScheduler::WireId<IScheduler::Boolean>>,
       IScheduler::WireId<IScheduler::Boolean>>::type;
 
-  std::deque<std::vector<std::unique_ptr<IGate>>> gatesByLevelOffset_;
+  std::deque<GateLevel> gatesByLevelOffset_;
   std::shared_ptr<IWireKeeper> wireKeeper_;
 
+  // Backing memory for the gates of all levels, recycled across levels.
+  std::shared_ptr<GateSlabPool> gateSlabPool_;
+
   uint32_t firstUnexecutedLevel_ = 0;
 
   uint32_t numUnexecutedGates_ = 0;
-  const uint32_t kMaxUnexecutedGates = 100000;
+  std::unique_ptr<IBatchingLimitPolicy> batchingLimitPolicy_;
 
   // below are helper functions. They are inlined for the sake of performance.
-  inline std::vector<std::unique_ptr<IGate>>& getLevel(uint32_t level) {
+  inline GateLevel& getLevel(uint32_t level) {
     while (gatesByLevelOffset_.size() <= level - firstUnexecutedLevel_) {
-      gatesByLevelOffset_.emplace_back(std::vector<std::unique_ptr<IGate>>());
+      gatesByLevelOffset_.emplace_back(gateSlabPool_);
     }
 
     return gatesByLevelOffset_.at(level - firstUnexecutedLevel_);
   }
 
-  inline void addGate(std::unique_ptr<IGate> gate, uint32_t level) {
-    auto& levelOfGate = getLevel(level);
-    levelOfGate.push_back(std::move(gate));
+  template <typename GateClass, typename... Args>
+  inline void addGate(uint32_t level, Args&&... args) {
+    getLevel(level).emplace<GateClass>(std::forward<Args>(args)...);
     numUnexecutedGates_++;
   }
 
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fbpcf/engine/ISecretShareEngine.h"
+#include "fbpcf/scheduler/gate_keeper/ArithmeticGate.h"
+#include "fbpcf/scheduler/gate_keeper/BatchArithmeticGate.h"
+#include "fbpcf/scheduler/gate_keeper/BatchCompositeGate.h"
+#include "fbpcf/scheduler/gate_keeper/BatchNormalGate.h"
+#include "fbpcf/scheduler/gate_keeper/CompositeGate.h"
+#include "fbpcf/scheduler/gate_keeper/IGate.h"
+#include "fbpcf/scheduler/gate_keeper/MultiXorGate.h"
+#include "fbpcf/scheduler/gate_keeper/NormalGate.h"
+#include "fbpcf/scheduler/gate_keeper/RebatchingGate.h"
+#include "fbpcf/scheduler/gate_keeper/ShareConversionGate.h"
+#include "fbpcf/scheduler/gate_keeper/TruncationGate.h"
+
+namespace fbpcf::scheduler {
+
+/**
+ * A pool of memory slabs that gate levels carve their gates out of. Slab sizes
+ * are powers of two between kMinSlabSize and kMaxSlabSize, a level starts with
+ * the smallest slab and doubles the size of every further slab, so levels with
+ * only a few gates stay small. Slabs of executed levels are handed back to the
+ * pool and reused by later levels, so in steady state creating a gate doesn't
+ * hit the heap.
+ */
+class GateSlabPool {
+ public:
+  static const size_t kMinSlabSize = 512;
+  static const size_t kMaxSlabSize = 64 * 1024;
+  static const size_t kSizeClassCount = 8;
+
+  static_assert(kMinSlabSize << (kSizeClassCount - 1) == kMaxSlabSize);
+
+  explicit GateSlabPool(size_t maxRetainedSlabsPerSize = 1024)
+      : maxRetainedSlabsPerSize_{maxRetainedSlabsPerSize} {}
+
+  static size_t getSlabSize(size_t sizeClass) {
+    return kMinSlabSize << sizeClass;
+  }
+
+  std::unique_ptr<std::byte[]> acquire(size_t sizeClass) {
+    auto& freeSlabs = freeSlabs_.at(sizeClass);
+    if (freeSlabs.empty()) {
+      // gates are constructed in place, no need to zero the memory
+      return std::unique_ptr<std::byte[]>(
+          new std::byte[getSlabSize(sizeClass)]);
+    }
+    auto slab = std::move(freeSlabs.back());
+    freeSlabs.pop_back();
+    return slab;
+  }
+
+  void release(std::unique_ptr<std::byte[]> slab, size_t sizeClass) {
+    auto& freeSlabs = freeSlabs_.at(sizeClass);
+    if (freeSlabs.size() < maxRetainedSlabsPerSize_) {
+      freeSlabs.push_back(std::move(slab));
+    }
+  }
+
+ private:
+  size_t maxRetainedSlabsPerSize_;
+  std::array<std::vector<std::unique_ptr<std::byte[]>>, kSizeClassCount>
+      freeSlabs_;
+};
+
+/**
+ * All the gates scheduled on one level of a circuit. Gates are constructed in
+ * place inside slabs obtained from a GateSlabPool instead of being individually
+ * heap allocated, and are tagged with their concrete type so that executing a
+ * level dispatches to the (final) gate classes directly rather than through
+ * the IGate vtable. Gates are kept in insertion order, which is a topological
+ * order for the free gates within a level.
+ */
+class GateLevel {
+ public:
+  enum class GateKind : uint8_t {
+    Normal,
+    BatchNormal,
+    Composite,
+    BatchComposite,
+    Arithmetic,
+    BatchArithmetic,
+    Rebatching,
+    ShareConversion,
+    BatchShareConversion,
+    Truncation,
+    BatchTruncation,
+    MultiXor,
+    BatchMultiXor,
+  };
+
+  explicit GateLevel(std::shared_ptr<GateSlabPool> pool)
+      : pool_{std::move(pool)}, slabOffset_{0} {}
+
+  GateLevel(GateLevel&& other) noexcept = default;
+  GateLevel& operator=(GateLevel&& other) noexcept {
+    if (this != &other) {
+      clear();
+      pool_ = std::move(other.pool_);
+      gates_ = std::move(other.gates_);
+      slabs_ = std::move(other.slabs_);
+      slabOffset_ = other.slabOffset_;
+    }
+    return *this;
+  }
+
+  GateLevel(const GateLevel&) = delete;
+  GateLevel& operator=(const GateLevel&) = delete;
+
+  ~GateLevel() {
+    clear();
+  }
+
+  // Construct a gate of type GateClass in this level.
+  template <typename GateClass, typename... Args>
+  void emplace(Args&&... args) {
+    static_assert(sizeof(GateClass) <= GateSlabPool::kMaxSlabSize);
+    auto gate = new (allocate(sizeof(GateClass), alignof(GateClass)))
+        GateClass(std::forward<Args>(args)...);
+    gates_.push_back(Entry{kindOf<GateClass>(), gate});
+  }
+
+  size_t size() const {
+    return gates_.size();
+  }
+
+  bool empty() const {
+    return gates_.empty();
+  }
+
+  // Access the i-th gate of this level through its generic interface.
+  IGate& at(size_t i) const {
+    return *gates_.at(i).gate;
+  }
+
+  /*
+   * Run or schedule the computation for all gates in this level, see
+   * IGate::compute(). Returns the total number of results of these gates.
+   */
+  uint64_t compute(
+      engine::ISecretShareEngine& engine,
+      std::map<int64_t, IGate::Secrets>& secretSharesByParty) const {
+    uint64_t numberOfResults = 0;
+    for (auto& entry : gates_) {
+      numberOfResults += visit(entry, [&](auto& gate) {
+        gate.compute(engine, secretSharesByParty);
+        return gate.getNumberOfResults();
+      });
+    }
+    return numberOfResults;
+  }
+
+  // Collect the results for all gates in this level, see
+  // IGate::collectScheduledResult().
+  void collectScheduledResult(
+      engine::ISecretShareEngine& engine,
+      std::map<int64_t, IGate::Secrets>& revealedSecretsByParty) const {
+    for (auto& entry : gates_) {
+      visit(entry, [&](auto& gate) {
+        gate.collectScheduledResult(engine, revealedSecretsByParty);
+        return 0;
+      });
+    }
+  }
+
+ private:
+  struct Entry {
+    GateKind kind;
+    IGate* gate;
+  };
+
+  struct Slab {
+    std::unique_ptr<std::byte[]> memory;
+    size_t sizeClass;
+  };
+
+  std::shared_ptr<GateSlabPool> pool_;
+  std::vector<Entry> gates_;
+  std::vector<Slab> slabs_;
+  size_t slabOffset_;
+
+  template <typename GateClass>
+  static constexpr GateKind kindOf() {
+    if constexpr (std::is_same_v<GateClass, NormalGate>) {
+      return GateKind::Normal;
+    } else if constexpr (std::is_same_v<GateClass, BatchNormalGate>) {
+      return GateKind::BatchNormal;
+    } else if constexpr (std::is_same_v<GateClass, CompositeGate>) {
+      return GateKind::Composite;
+    } else if constexpr (std::is_same_v<GateClass, BatchCompositeGate>) {
+      return GateKind::BatchComposite;
+    } else if constexpr (std::is_same_v<GateClass, ArithmeticGate>) {
+      return GateKind::Arithmetic;
+    } else if constexpr (std::is_same_v<GateClass, BatchArithmeticGate>) {
+      return GateKind::BatchArithmetic;
+    } else if constexpr (std::is_same_v<
+                             GateClass,
+                             ShareConversionGate</* usingBatch */ false>>) {
+      return GateKind::ShareConversion;
+    } else if constexpr (std::is_same_v<
+                             GateClass,
+                             ShareConversionGate</* usingBatch */ true>>) {
+      return GateKind::BatchShareConversion;
+    } else if constexpr (std::is_same_v<
+                             GateClass,
+                             TruncationGate</* usingBatch */ false>>) {
+      return GateKind::Truncation;
+    } else if constexpr (std::is_same_v<
+                             GateClass,
+                             TruncationGate</* usingBatch */ true>>) {
+      return GateKind::BatchTruncation;
+    } else if constexpr (std::is_same_v<
+                             GateClass,
+                             MultiXorGate</* usingBatch */ false>>) {
+      return GateKind::MultiXor;
+    } else if constexpr (std::is_same_v<
+                             GateClass,
+                             MultiXorGate</* usingBatch */ true>>) {
+      return GateKind::BatchMultiXor;
+    } else {
+      static_assert(std::is_same_v<GateClass, RebatchingBooleanGate>);
+      return GateKind::Rebatching;
+    }
+  }
+
+  // Call f with the gate casted to its concrete type. All gate classes are
+  // final, hence calls through f are resolved statically.
+  template <typename F>
+  static auto visit(const Entry& entry, F&& f)
+      -> std::invoke_result_t<F, NormalGate&> {
+    switch (entry.kind) {
+      case GateKind::Normal:
+        return f(*static_cast<NormalGate*>(entry.gate));
+      case GateKind::BatchNormal:
+        return f(*static_cast<BatchNormalGate*>(entry.gate));
+      case GateKind::Composite:
+        return f(*static_cast<CompositeGate*>(entry.gate));
+      case GateKind::BatchComposite:
+        return f(*static_cast<BatchCompositeGate*>(entry.gate));
+      case GateKind::Arithmetic:
+        return f(*static_cast<ArithmeticGate*>(entry.gate));
+      case GateKind::BatchArithmetic:
+        return f(*static_cast<BatchArithmeticGate*>(entry.gate));
+      case GateKind::ShareConversion:
+        return f(*static_cast<ShareConversionGate<false>*>(entry.gate));
+      case GateKind::BatchShareConversion:
+        return f(*static_cast<ShareConversionGate<true>*>(entry.gate));
+      case GateKind::Truncation:
+        return f(*static_cast<TruncationGate<false>*>(entry.gate));
+      case GateKind::BatchTruncation:
+        return f(*static_cast<TruncationGate<true>*>(entry.gate));
+      case GateKind::MultiXor:
+        return f(*static_cast<MultiXorGate<false>*>(entry.gate));
+      case GateKind::BatchMultiXor:
+        return f(*static_cast<MultiXorGate<true>*>(entry.gate));
+      case GateKind::Rebatching:
+      default:
+        return f(*static_cast<RebatchingBooleanGate*>(entry.gate));
+    }
+  }
+
+  void* allocate(size_t size, size_t alignment) {
+    auto offset = (slabOffset_ + alignment - 1) & ~(alignment - 1);
+    if (slabs_.empty() ||
+        offset + size > GateSlabPool::getSlabSize(slabs_.back().sizeClass)) {
+      size_t sizeClass = slabs_.empty()
+          ? 0
+          : std::min(
+                slabs_.back().sizeClass + 1,
+                GateSlabPool::kSizeClassCount - 1);
+      while (GateSlabPool::getSlabSize(sizeClass) < size) {
+        sizeClass++;
+      }
+      slabs_.push_back(Slab{pool_->acquire(sizeClass), sizeClass});
+      offset = 0;
+    }
+    slabOffset_ = offset + size;
+    return slabs_.back().memory.get() + offset;
+  }
+
+  void clear() {
+    for (auto& entry : gates_) {
+      visit(entry, [](auto& gate) {
+        using GateClass = std::remove_reference_t<decltype(gate)>;
+        gate.~GateClass();
+        return 0;
+      });
+    }
+    gates_.clear();
+    if (pool_ != nullptr) {
+      for (auto& slab : slabs_) {
+        pool_->release(std::move(slab.memory), slab.sizeClass);
+      }
+    }
+    slabs_.clear();
+    slabOffset_ = 0;
+  }
+};
+
+} // namespace fbpcf::scheduler
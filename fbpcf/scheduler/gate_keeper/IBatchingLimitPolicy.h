@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace fbpcf::scheduler {
+
+/**
+ * What happened while a scheduler executed one level of gates.
+ */
+struct LevelExecutionStatistics {
+  // Whether the level only contained free gates.
+  bool isFree;
+  // The number of gates (counting each batch element) in the level.
+  uint64_t numberOfGates;
+  // The number of bytes sent and received while executing the level.
+  uint64_t bytesSent;
+  uint64_t bytesReceived;
+  // Wall time spent executing the level, including the network round trip.
+  std::chrono::nanoseconds duration;
+  // The number of wires that are alive after executing the level.
+  uint64_t liveWires;
+};
+
+/**
+ * A batching limit policy decides how many gates a gate keeper may buffer
+ * before the scheduler is forced to execute some of them. Larger limits put
+ * more independent work in each network round, smaller limits keep less
+ * state in memory.
+ */
+class IBatchingLimitPolicy {
+ public:
+  virtual ~IBatchingLimitPolicy() = default;
+
+  // The maximum number of unexecuted gates that may be buffered.
+  virtual uint64_t getBatchingLimit() const = 0;
+
+  // Called by the scheduler every time a level of gates has been executed.
+  virtual void recordLevelExecution(
+      const LevelExecutionStatistics& statistics) = 0;
+};
+
+} // namespace fbpcf::scheduler
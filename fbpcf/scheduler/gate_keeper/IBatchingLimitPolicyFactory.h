@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicy.h"
+
+namespace fbpcf::scheduler {
+
+class IBatchingLimitPolicyFactory {
+ public:
+  virtual ~IBatchingLimitPolicyFactory() = default;
+  virtual std::unique_ptr<IBatchingLimitPolicy> create() = 0;
+};
+
+} // namespace fbpcf::scheduler
@@ -9,6 +9,8 @@
 
 #include <cstdint>
 #include "fbpcf/scheduler/IScheduler.h"
+#include "fbpcf/scheduler/gate_keeper/GateLevel.h"
+#include "fbpcf/scheduler/gate_keeper/IBatchingLimitPolicy.h"
 #include "fbpcf/scheduler/gate_keeper/IArithmeticGate.h"
 #include "fbpcf/scheduler/gate_keeper/ICompositeGate.h"
 #include "fbpcf/scheduler/gate_keeper/IGate.h"
@@ -114,6 +116,64 @@ class IGateKeeper {
       IScheduler::WireId<IScheduler::Boolean> left,
       std::vector<IScheduler::WireId<IScheduler::Boolean>> rights) = 0;
 
+  // Create a free gate computing the XOR of a number of private and public
+  // wires, inverted if negate is true, see IScheduler::multiXor(). Returns its
+  // output wire ID.
+  virtual IScheduler::WireId<IScheduler::Boolean> multiXorGate(
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) = 0;
+
+  // Same, for batch wires.
+  virtual IScheduler::WireId<IScheduler::Boolean> multiXorGateBatch(
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& publicSrc,
+      bool negate) = 0;
+
+  // Create a free gate converting party partyID's share of a boolean wire into
+  // an integer wire, see ISecretShareEngine::computeBooleanShareToInteger().
+  // Returns its output wire ID.
+  virtual IScheduler::WireId<IScheduler::Arithmetic> booleanShareToIntegerGate(
+      IScheduler::WireId<IScheduler::Boolean> src,
+      int partyID) = 0;
+
+  // Same, for a batch wire.
+  virtual IScheduler::WireId<IScheduler::Arithmetic>
+  booleanShareToIntegerGateBatch(
+      IScheduler::WireId<IScheduler::Boolean> src,
+      int partyID) = 0;
+
+  // Create a free gate decomposing party partyID's share of an integer wire
+  // into its lowest width bits, see
+  // ISecretShareEngine::computeIntegerShareToBooleans(). Returns its output
+  // wire ID's, least significant first.
+  virtual std::vector<IScheduler::WireId<IScheduler::Boolean>>
+  integerShareToBooleansGate(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      int partyID,
+      size_t width) = 0;
+
+  // Same, for a batch wire.
+  virtual std::vector<IScheduler::WireId<IScheduler::Boolean>>
+  integerShareToBooleansGateBatch(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      int partyID,
+      size_t width) = 0;
+
+  // Create a free gate dividing an integer wire by 2^bits, see
+  // ISecretShareEngine::computeTruncation() for a PRIVATE wire. Returns its
+  // output wire ID.
+  virtual IScheduler::WireId<IScheduler::Arithmetic> truncationGate(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      size_t bits,
+      bool isPrivate) = 0;
+
+  // Same, for a batch wire.
+  virtual IScheduler::WireId<IScheduler::Arithmetic> truncationGateBatch(
+      IScheduler::WireId<IScheduler::Arithmetic> src,
+      size_t bits,
+      bool isPrivate) = 0;
+
   // band a number of boolean batches into one batch.
   virtual IScheduler::WireId<IScheduler::Boolean> batchingUp(
       std::vector<IScheduler::WireId<IScheduler::Boolean>> src) = 0;
@@ -123,18 +183,29 @@ class IGateKeeper {
       IScheduler::WireId<IScheduler::Boolean> src,
       std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy) = 0;
 
+  // select the boolean values at the given positions of a batch into a new
+  // batch.
+  virtual IScheduler::WireId<IScheduler::Boolean> gathering(
+      IScheduler::WireId<IScheduler::Boolean> src,
+      std::shared_ptr<std::vector<uint32_t>> indexes) = 0;
+
   // Return the first level of gates that has not been executed yet.
   // NOTE: Free gates are added to even levels, and non-free gates are added
   // to odd levels.
   virtual uint32_t getFirstUnexecutedLevel() const = 0;
 
   // Extract all the gates at the level that should be executed next.
-  virtual std::vector<std::unique_ptr<IGate>> popFirstUnexecutedLevel() = 0;
+  virtual GateLevel popFirstUnexecutedLevel() = 0;
 
   // Whether we've exceeded the maximum number of unexecuted gates. In this
   // case, gates should be executed in order to free up memory.
   virtual bool hasReachedBatchingLimit() const = 0;
 
+  // Report how executing a level went, so that the batching limit can adapt
+  // to it.
+  virtual void recordLevelExecution(
+      const LevelExecutionStatistics& statistics) = 0;
+
   // Even levels contain free gates, and odd levels contain non-free gates.
   static inline bool isLevelFree(uint32_t level) {
     return !(level & 1);
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include "fbpcf/engine/ISecretShareEngine.h"
+#include "fbpcf/scheduler/IScheduler.h"
+#include "fbpcf/scheduler/IWireKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/IGate.h"
+
+namespace fbpcf::scheduler {
+
+/**
+ * A multi-input XOR gate computes the XOR of any number of private and public
+ * boolean wires, inverted if requested, into a single output wire. The private
+ * inputs are combined with symmetric XORs, and the public inputs and the
+ * inversion are then applied with one asymmetric XOR. These gates are free.
+ **/
+template <bool usingBatch>
+class MultiXorGate final : public IGate {
+  using BoolType =
+      typename std::conditional<usingBatch, std::vector<bool>, bool>::type;
+
+ public:
+  MultiXorGate(
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& privateSrc,
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>& publicSrc,
+      IScheduler::WireId<IScheduler::Boolean> dstWireID,
+      bool negate,
+      uint32_t numberOfResults,
+      IWireKeeper& wireKeeper)
+      : privateSrc_(privateSrc),
+        publicSrc_(publicSrc),
+        dstWireID_(dstWireID),
+        negate_(negate),
+        numberOfResults_(numberOfResults),
+        wireKeeper_(wireKeeper) {
+    for (auto& wire : privateSrc_) {
+      increaseReferenceCount(wire);
+    }
+    for (auto& wire : publicSrc_) {
+      increaseReferenceCount(wire);
+    }
+    increaseReferenceCount(dstWireID_);
+  }
+
+  ~MultiXorGate() override {
+    for (auto& wire : privateSrc_) {
+      decreaseReferenceCount(wire);
+    }
+    for (auto& wire : publicSrc_) {
+      decreaseReferenceCount(wire);
+    }
+    decreaseReferenceCount(dstWireID_);
+  }
+
+  void compute(
+      engine::ISecretShareEngine& engine,
+      std::map<int64_t, IGate::Secrets>& /*secretSharesByParty*/) override {
+    BoolType constant;
+    if constexpr (usingBatch) {
+      constant = std::vector<bool>(
+          wireKeeper_.getBatchSize(
+              privateSrc_.empty() ? publicSrc_.at(0) : privateSrc_.at(0)),
+          negate_);
+    } else {
+      constant = negate_;
+    }
+    for (auto& wire : publicSrc_) {
+      constant = computeSymmetricXOR(engine, constant, getValue(wire));
+    }
+    if (privateSrc_.empty()) {
+      setValue(std::move(constant));
+      return;
+    }
+
+    BoolType value = getValue(privateSrc_.at(0));
+    for (size_t i = 1; i < privateSrc_.size(); i++) {
+      value = computeSymmetricXOR(engine, value, getValue(privateSrc_.at(i)));
+    }
+    if constexpr (usingBatch) {
+      setValue(engine.computeBatchAsymmetricXOR(value, constant));
+    } else {
+      setValue(engine.computeAsymmetricXOR(value, constant));
+    }
+  }
+
+  void collectScheduledResult(
+      engine::ISecretShareEngine& /*engine*/,
+      std::map<int64_t, IGate::Secrets>& /*revealedSecretsByParty*/)
+      override {}
+
+  uint32_t getNumberOfResults() const override {
+    return numberOfResults_;
+  }
+
+ private:
+  static BoolType computeSymmetricXOR(
+      engine::ISecretShareEngine& engine,
+      const BoolType& left,
+      const BoolType& right) {
+    if constexpr (usingBatch) {
+      return engine.computeBatchSymmetricXOR(left, right);
+    } else {
+      return engine.computeSymmetricXOR(left, right);
+    }
+  }
+
+  BoolType getValue(IScheduler::WireId<IScheduler::Boolean> wire) const {
+    if constexpr (usingBatch) {
+      return wireKeeper_.getBatchBooleanValue(wire);
+    } else {
+      return wireKeeper_.getBooleanValue(wire);
+    }
+  }
+
+  void setValue(BoolType&& value) {
+    if constexpr (usingBatch) {
+      wireKeeper_.setBatchBooleanValue(dstWireID_, std::move(value));
+    } else {
+      wireKeeper_.setBooleanValue(dstWireID_, value);
+    }
+  }
+
+  void increaseReferenceCount(IScheduler::WireId<IScheduler::Boolean> wire) {
+    if constexpr (usingBatch) {
+      wireKeeper_.increaseBatchReferenceCount(wire);
+    } else {
+      wireKeeper_.increaseReferenceCount(wire);
+    }
+  }
+
+  void decreaseReferenceCount(IScheduler::WireId<IScheduler::Boolean> wire) {
+    if constexpr (usingBatch) {
+      wireKeeper_.decreaseBatchReferenceCount(wire);
+    } else {
+      wireKeeper_.decreaseReferenceCount(wire);
+    }
+  }
+
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> privateSrc_;
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> publicSrc_;
+  IScheduler::WireId<IScheduler::Boolean> dstWireID_;
+  bool negate_;
+  uint32_t numberOfResults_;
+  IWireKeeper& wireKeeper_;
+};
+
+} // namespace fbpcf::scheduler
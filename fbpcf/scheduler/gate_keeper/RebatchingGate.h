@@ -22,12 +22,13 @@ namespace fbpcf::scheduler {
  *also need to be async as well.
  **/
 
-class RebatchingBooleanGate : public IGate {
+class RebatchingBooleanGate final : public IGate {
  public:
   enum class GateType {
     Batching, // Batch a number of batches of values into one batch of
               // values.
     Unbatching, // decompose a batch into several batches.
+    Gathering, // select some values of a batch into a new batch.
   };
 
   // this contructor will create a "Batching" gate. The caller is responsible
@@ -68,6 +69,22 @@ class RebatchingBooleanGate : public IGate {
     }
   }
 
+  // this contructor will create a "Gathering" gate. The caller is responsible
+  // to make sure all indexes are within the batch.
+  RebatchingBooleanGate(
+      const IScheduler::WireId<IScheduler::Boolean>& batchWireID,
+      const IScheduler::WireId<IScheduler::Boolean>& gatheredWireID,
+      IWireKeeper& wireKeeper,
+      std::shared_ptr<std::vector<uint32_t>> gatheringIndexes)
+      : gateType_(GateType::Gathering),
+        individualWireIDs_({gatheredWireID}),
+        batchWireID_(batchWireID),
+        wireKeeper_(wireKeeper),
+        gatheringIndexes_(gatheringIndexes) {
+    increaseBatchReferenceCount(batchWireID_);
+    increaseBatchReferenceCount(gatheredWireID);
+  }
+
   ~RebatchingBooleanGate() override {
     decreaseBatchReferenceCount(batchWireID_);
     for (auto& i : individualWireIDs_) {
@@ -84,6 +101,9 @@ class RebatchingBooleanGate : public IGate {
       case GateType::Unbatching:
         executeUnbatchingGate();
         break;
+      case GateType::Gathering:
+        executeGatheringGate();
+        break;
     }
   }
 
@@ -162,11 +182,21 @@ class RebatchingBooleanGate : public IGate {
     }
   }
 
+  void executeGatheringGate() const {
+    auto& src = wireKeeper_.getBatchBooleanValue(batchWireID_);
+    std::vector<bool> dst(gatheringIndexes_->size());
+    for (size_t i = 0; i < dst.size(); i++) {
+      dst[i] = src.at(gatheringIndexes_->at(i));
+    }
+    wireKeeper_.setBatchBooleanValue(individualWireIDs_.at(0), dst);
+  }
+
   GateType gateType_;
   std::vector<IScheduler::WireId<IScheduler::Boolean>> individualWireIDs_;
   IScheduler::WireId<IScheduler::Boolean> batchWireID_;
   IWireKeeper& wireKeeper_;
   std::shared_ptr<std::vector<uint32_t>> unbatchingStrategy_;
+  std::shared_ptr<std::vector<uint32_t>> gatheringIndexes_;
 };
 
 } // namespace fbpcf::scheduler
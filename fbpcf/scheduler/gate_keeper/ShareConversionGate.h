@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "fbpcf/engine/ISecretShareEngine.h"
+#include "fbpcf/scheduler/IScheduler.h"
+#include "fbpcf/scheduler/IWireKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/IGate.h"
+
+namespace fbpcf::scheduler {
+
+/**
+ * A share conversion gate moves one party's share of a secret between the
+ * boolean and the arithmetic domain, see
+ * ISecretShareEngine::computeBooleanShareToInteger() and
+ * ISecretShareEngine::computeIntegerShareToBooleans(). Combining the converted
+ * shares of all parties into the secret is left to the scheduler. These gates
+ * are free.
+ **/
+template <bool usingBatch>
+class ShareConversionGate final : public IGate {
+ public:
+  enum class GateType {
+    BooleanShareToInteger, // one boolean wire to one integer wire
+    IntegerShareToBooleans, // one integer wire to its lowest bits
+  };
+
+  // this constructor will create a "BooleanShareToInteger" gate.
+  ShareConversionGate(
+      IScheduler::WireId<IScheduler::Boolean> booleanWireID,
+      IScheduler::WireId<IScheduler::Arithmetic> integerWireID,
+      int partyID,
+      uint32_t numberOfResults,
+      IWireKeeper& wireKeeper)
+      : gateType_(GateType::BooleanShareToInteger),
+        booleanWireIDs_{booleanWireID},
+        integerWireID_(integerWireID),
+        partyID_(partyID),
+        numberOfResults_(numberOfResults),
+        wireKeeper_(wireKeeper) {
+    for (auto& wire : booleanWireIDs_) {
+      increaseReferenceCount(wire);
+    }
+    increaseReferenceCount(integerWireID_);
+  }
+
+  // this constructor will create an "IntegerShareToBooleans" gate, with one
+  // boolean wire per bit, least significant first.
+  ShareConversionGate(
+      IScheduler::WireId<IScheduler::Arithmetic> integerWireID,
+      const std::vector<IScheduler::WireId<IScheduler::Boolean>>&
+          booleanWireIDs,
+      int partyID,
+      uint32_t numberOfResults,
+      IWireKeeper& wireKeeper)
+      : gateType_(GateType::IntegerShareToBooleans),
+        booleanWireIDs_(booleanWireIDs),
+        integerWireID_(integerWireID),
+        partyID_(partyID),
+        numberOfResults_(numberOfResults),
+        wireKeeper_(wireKeeper) {
+    for (auto& wire : booleanWireIDs_) {
+      increaseReferenceCount(wire);
+    }
+    increaseReferenceCount(integerWireID_);
+  }
+
+  ~ShareConversionGate() override {
+    for (auto& wire : booleanWireIDs_) {
+      decreaseReferenceCount(wire);
+    }
+    decreaseReferenceCount(integerWireID_);
+  }
+
+  void compute(
+      engine::ISecretShareEngine& engine,
+      std::map<int64_t, IGate::Secrets>& /*secretSharesByParty*/) override {
+    switch (gateType_) {
+      case GateType::BooleanShareToInteger:
+        if constexpr (usingBatch) {
+          wireKeeper_.setBatchIntegerValue(
+              integerWireID_,
+              engine.computeBatchBooleanShareToInteger(
+                  partyID_,
+                  wireKeeper_.getBatchBooleanValue(booleanWireIDs_.at(0))));
+        } else {
+          wireKeeper_.setIntegerValue(
+              integerWireID_,
+              engine.computeBooleanShareToInteger(
+                  partyID_,
+                  wireKeeper_.getBooleanValue(booleanWireIDs_.at(0))));
+        }
+        break;
+
+      case GateType::IntegerShareToBooleans:
+        if constexpr (usingBatch) {
+          auto bits = engine.computeBatchIntegerShareToBooleans(
+              partyID_, wireKeeper_.getBatchIntegerValue(integerWireID_));
+          for (size_t i = 0; i < booleanWireIDs_.size(); i++) {
+            wireKeeper_.setBatchBooleanValue(
+                booleanWireIDs_[i], std::move(bits.at(i)));
+          }
+        } else {
+          auto bits = engine.computeIntegerShareToBooleans(
+              partyID_, wireKeeper_.getIntegerValue(integerWireID_));
+          for (size_t i = 0; i < booleanWireIDs_.size(); i++) {
+            wireKeeper_.setBooleanValue(booleanWireIDs_[i], bits.at(i));
+          }
+        }
+        break;
+    }
+  }
+
+  void collectScheduledResult(
+      engine::ISecretShareEngine& /*engine*/,
+      std::map<int64_t, IGate::Secrets>& /*revealedSecretsByParty*/)
+      override {}
+
+  uint32_t getNumberOfResults() const override {
+    return numberOfResults_;
+  }
+
+ private:
+  template <IScheduler::WireType wireType>
+  void increaseReferenceCount(IScheduler::WireId<wireType> wire) {
+    if constexpr (usingBatch) {
+      wireKeeper_.increaseBatchReferenceCount(wire);
+    } else {
+      wireKeeper_.increaseReferenceCount(wire);
+    }
+  }
+
+  template <IScheduler::WireType wireType>
+  void decreaseReferenceCount(IScheduler::WireId<wireType> wire) {
+    if constexpr (usingBatch) {
+      wireKeeper_.decreaseBatchReferenceCount(wire);
+    } else {
+      wireKeeper_.decreaseReferenceCount(wire);
+    }
+  }
+
+  GateType gateType_;
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> booleanWireIDs_;
+  IScheduler::WireId<IScheduler::Arithmetic> integerWireID_;
+  int partyID_;
+  uint32_t numberOfResults_;
+  IWireKeeper& wireKeeper_;
+};
+
+} // namespace fbpcf::scheduler
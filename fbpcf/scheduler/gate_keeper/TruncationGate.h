@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "fbpcf/engine/ISecretShareEngine.h"
+#include "fbpcf/scheduler/IScheduler.h"
+#include "fbpcf/scheduler/IWireKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/IGate.h"
+
+namespace fbpcf::scheduler {
+
+/**
+ * A truncation gate divides an integer wire by 2^bits as a signed integer.
+ * Public values are shifted exactly, while secret shares are truncated with
+ * ISecretShareEngine::computeTruncation(). These gates are free.
+ **/
+template <bool usingBatch>
+class TruncationGate final : public IGate {
+ public:
+  TruncationGate(
+      IScheduler::WireId<IScheduler::Arithmetic> srcWireID,
+      IScheduler::WireId<IScheduler::Arithmetic> dstWireID,
+      size_t bits,
+      bool isPrivate,
+      uint32_t numberOfResults,
+      IWireKeeper& wireKeeper)
+      : srcWireID_(srcWireID),
+        dstWireID_(dstWireID),
+        bits_(bits),
+        isPrivate_(isPrivate),
+        numberOfResults_(numberOfResults),
+        wireKeeper_(wireKeeper) {
+    increaseReferenceCount(srcWireID_);
+    increaseReferenceCount(dstWireID_);
+  }
+
+  ~TruncationGate() override {
+    decreaseReferenceCount(srcWireID_);
+    decreaseReferenceCount(dstWireID_);
+  }
+
+  void compute(
+      engine::ISecretShareEngine& engine,
+      std::map<int64_t, IGate::Secrets>& /*secretSharesByParty*/) override {
+    if constexpr (usingBatch) {
+      auto& src = wireKeeper_.getBatchIntegerValue(srcWireID_);
+      std::vector<uint64_t> rst;
+      if (isPrivate_) {
+        rst = engine.computeBatchTruncation(src, bits_);
+      } else {
+        rst.resize(src.size());
+        for (size_t i = 0; i < src.size(); i++) {
+          rst[i] = shiftPublicValue(src[i]);
+        }
+      }
+      wireKeeper_.setBatchIntegerValue(dstWireID_, std::move(rst));
+    } else {
+      auto src = wireKeeper_.getIntegerValue(srcWireID_);
+      wireKeeper_.setIntegerValue(
+          dstWireID_,
+          isPrivate_ ? engine.computeTruncation(src, bits_)
+                     : shiftPublicValue(src));
+    }
+  }
+
+  void collectScheduledResult(
+      engine::ISecretShareEngine& /*engine*/,
+      std::map<int64_t, IGate::Secrets>& /*revealedSecretsByParty*/)
+      override {}
+
+  uint32_t getNumberOfResults() const override {
+    return numberOfResults_;
+  }
+
+ private:
+  uint64_t shiftPublicValue(uint64_t v) const {
+    return static_cast<uint64_t>(static_cast<int64_t>(v) >> bits_);
+  }
+
+  void increaseReferenceCount(IScheduler::WireId<IScheduler::Arithmetic> wire) {
+    if constexpr (usingBatch) {
+      wireKeeper_.increaseBatchReferenceCount(wire);
+    } else {
+      wireKeeper_.increaseReferenceCount(wire);
+    }
+  }
+
+  void decreaseReferenceCount(IScheduler::WireId<IScheduler::Arithmetic> wire) {
+    if constexpr (usingBatch) {
+      wireKeeper_.decreaseBatchReferenceCount(wire);
+    } else {
+      wireKeeper_.decreaseReferenceCount(wire);
+    }
+  }
+
+  IScheduler::WireId<IScheduler::Arithmetic> srcWireID_;
+  IScheduler::WireId<IScheduler::Arithmetic> dstWireID_;
+  size_t bits_;
+  bool isPrivate_;
+  uint32_t numberOfResults_;
+  IWireKeeper& wireKeeper_;
+};
+
+} // namespace fbpcf::scheduler
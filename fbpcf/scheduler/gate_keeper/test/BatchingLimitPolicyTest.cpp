@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+
+#include "fbpcf/scheduler/WireKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/AdaptiveBatchingLimitPolicy.h"
+#include "fbpcf/scheduler/gate_keeper/FixedBatchingLimitPolicy.h"
+#include "fbpcf/scheduler/gate_keeper/GateKeeper.h"
+
+namespace fbpcf::scheduler {
+
+LevelExecutionStatistics nonFreeLevel(
+    std::chrono::nanoseconds duration,
+    uint64_t liveWires = 0) {
+  return LevelExecutionStatistics{
+      .isFree = false,
+      .numberOfGates = 1000,
+      .bytesSent = 1000,
+      .bytesReceived = 1000,
+      .duration = duration,
+      .liveWires = liveWires,
+  };
+}
+
+AdaptiveBatchingLimitPolicy::Config getConfig() {
+  AdaptiveBatchingLimitPolicy::Config config;
+  config.initialBatchingLimit = 1000;
+  config.minBatchingLimit = 100;
+  config.maxBatchingLimit = 100000;
+  config.maxLiveWires = 1000000;
+  return config;
+}
+
+TEST(BatchingLimitPolicyTest, testFixedPolicy) {
+  FixedBatchingLimitPolicy policy(1234);
+  EXPECT_EQ(policy.getBatchingLimit(), 1234);
+  policy.recordLevelExecution(nonFreeLevel(std::chrono::milliseconds(100)));
+  EXPECT_EQ(policy.getBatchingLimit(), 1234);
+}
+
+TEST(BatchingLimitPolicyTest, testAdaptivePolicyGrowsWhenLatencyBound) {
+  AdaptiveBatchingLimitPolicy policy(getConfig());
+
+  // Every level takes about one round trip, no matter how many gates it has.
+  auto limit = policy.getBatchingLimit();
+  for (int i = 0; i < 5; i++) {
+    policy.recordLevelExecution(nonFreeLevel(std::chrono::milliseconds(50)));
+    EXPECT_GT(policy.getBatchingLimit(), limit);
+    limit = policy.getBatchingLimit();
+  }
+  EXPECT_EQ(policy.getRoundTripTimeEstimate(), std::chrono::milliseconds(50));
+
+  // The limit never exceeds the configured maximum.
+  for (int i = 0; i < 100; i++) {
+    policy.recordLevelExecution(nonFreeLevel(std::chrono::milliseconds(50)));
+  }
+  EXPECT_EQ(policy.getBatchingLimit(), getConfig().maxBatchingLimit);
+}
+
+TEST(BatchingLimitPolicyTest, testAdaptivePolicyShrinksWhenBandwidthBound) {
+  AdaptiveBatchingLimitPolicy policy(getConfig());
+  policy.recordLevelExecution(nonFreeLevel(std::chrono::milliseconds(1)));
+  auto limit = policy.getBatchingLimit();
+
+  // Levels take many round trips, more gates per round don't help.
+  for (int i = 0; i < 5; i++) {
+    policy.recordLevelExecution(nonFreeLevel(std::chrono::milliseconds(10)));
+    EXPECT_LT(policy.getBatchingLimit(), limit);
+    limit = policy.getBatchingLimit();
+  }
+
+  for (int i = 0; i < 100; i++) {
+    policy.recordLevelExecution(nonFreeLevel(std::chrono::milliseconds(10)));
+  }
+  EXPECT_EQ(policy.getBatchingLimit(), getConfig().minBatchingLimit);
+}
+
+TEST(BatchingLimitPolicyTest, testAdaptivePolicyShrinksOnLowLatency) {
+  AdaptiveBatchingLimitPolicy policy(getConfig());
+  auto limit = policy.getBatchingLimit();
+
+  // Every level takes about one round trip, but round trips are so short
+  // that buffering more gates doesn't pay off.
+  for (int i = 0; i < 5; i++) {
+    policy.recordLevelExecution(nonFreeLevel(std::chrono::microseconds(200)));
+    EXPECT_LT(policy.getBatchingLimit(), limit);
+    limit = policy.getBatchingLimit();
+  }
+
+  for (int i = 0; i < 100; i++) {
+    policy.recordLevelExecution(nonFreeLevel(std::chrono::microseconds(200)));
+  }
+  EXPECT_EQ(policy.getBatchingLimit(), getConfig().minBatchingLimit);
+}
+
+TEST(BatchingLimitPolicyTest, testAdaptivePolicyIgnoresLevelsWithoutTraffic) {
+  AdaptiveBatchingLimitPolicy policy(getConfig());
+  auto limit = policy.getBatchingLimit();
+
+  auto freeLevel = nonFreeLevel(std::chrono::milliseconds(1));
+  freeLevel.isFree = true;
+  policy.recordLevelExecution(freeLevel);
+
+  auto silentLevel = nonFreeLevel(std::chrono::milliseconds(1));
+  silentLevel.bytesSent = silentLevel.bytesReceived = 0;
+  policy.recordLevelExecution(silentLevel);
+
+  EXPECT_EQ(policy.getBatchingLimit(), limit);
+  EXPECT_EQ(policy.getRoundTripTimeEstimate(), std::chrono::nanoseconds(0));
+}
+
+TEST(BatchingLimitPolicyTest, testAdaptivePolicyRespectsMemoryBound) {
+  AdaptiveBatchingLimitPolicy policy(getConfig());
+  auto limit = policy.getBatchingLimit();
+
+  // Even a latency bound level must not grow the limit when too many wires
+  // are alive.
+  policy.recordLevelExecution(nonFreeLevel(
+      std::chrono::milliseconds(50), getConfig().maxLiveWires + 1));
+  EXPECT_EQ(policy.getBatchingLimit(), limit / 2);
+}
+
+TEST(BatchingLimitPolicyTest, testGateKeeperUsesPolicy) {
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena</*unsafe*/ false>();
+  auto config = getConfig();
+  config.initialBatchingLimit = config.minBatchingLimit;
+  auto gateKeeper = std::make_unique<GateKeeper>(
+      wireKeeper, std::make_unique<AdaptiveBatchingLimitPolicy>(config));
+
+  for (uint64_t i = 0; i < config.minBatchingLimit; i++) {
+    gateKeeper->inputGate(true);
+  }
+  EXPECT_FALSE(gateKeeper->hasReachedBatchingLimit());
+  gateKeeper->inputGate(true);
+  EXPECT_TRUE(gateKeeper->hasReachedBatchingLimit());
+
+  // A latency bound round lets the gate keeper buffer more gates.
+  gateKeeper->recordLevelExecution(nonFreeLevel(std::chrono::milliseconds(50)));
+  EXPECT_FALSE(gateKeeper->hasReachedBatchingLimit());
+}
+
+} // namespace fbpcf::scheduler
@@ -11,6 +11,7 @@
 #include "fbpcf/scheduler/IScheduler.h"
 #include "fbpcf/scheduler/WireKeeper.h"
 #include "fbpcf/scheduler/gate_keeper/GateKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/GateLevel.h"
 #include "fbpcf/scheduler/gate_keeper/IArithmeticGate.h"
 #include "fbpcf/scheduler/gate_keeper/IGate.h"
 #include "fbpcf/scheduler/gate_keeper/INormalGate.h"
@@ -27,7 +28,7 @@ struct RebatchGateDescription {
 };
 
 void testLevel(
-    std::vector<std::unique_ptr<IGate>> level,
+    GateLevel level,
     std::vector<IScheduler::WireId<IScheduler::Boolean>> expectedNormalWires,
     std::vector<std::vector<IScheduler::WireId<IScheduler::Boolean>>>
         expectedCompositeWires,
@@ -43,7 +44,7 @@ void testLevel(
   int arithmeticWireIndex = 0;
   int rebatchingGateIndex = 0;
   for (auto i = 0; i < level.size(); ++i) {
-    IGate* gate = level.at(i).get();
+    IGate* gate = &level.at(i);
     INormalGate* normalGate = dynamic_cast<INormalGate*>(gate);
     ICompositeGate* compositeGate = dynamic_cast<ICompositeGate*>(gate);
     IArithmeticGate* arithmeticGate = dynamic_cast<IArithmeticGate*>(gate);
@@ -192,6 +193,22 @@ TEST(GateKeeperTest, TestAddAndRemoveBooleanGates) {
   EXPECT_EQ(gateKeeper->getFirstUnexecutedLevel(), 12);
 }
 
+TEST(GateKeeperTest, TestBatchingUpUnexecutedWires) {
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena<unsafe>();
+  auto gateKeeper = std::make_unique<GateKeeper>(wireKeeper);
+
+  auto wire1 = gateKeeper->inputGateBatch(std::vector<bool>{true, false, true});
+  auto wire2 = gateKeeper->normalGateBatch(
+      INormalGate::GateType::NonFreeAnd, wire1, wire1);
+  auto parts = gateKeeper->unbatching(
+      wire2,
+      std::make_shared<std::vector<uint32_t>>(std::vector<uint32_t>({2, 1})));
+  auto wire3 = gateKeeper->batchingUp(parts);
+
+  EXPECT_EQ(wireKeeper->getBatchSize(wire3), 3);
+}
+
 TEST(GateKeeperTest, TestAddAndRemoveArithmeticGates) {
   std::shared_ptr<IWireKeeper> wireKeeper =
       WireKeeper::createWithVectorArena<unsafe>();
@@ -357,4 +374,67 @@ TEST(GateKeeperTest, TestCompositeGates) {
   testLevel(gateKeeper->popFirstUnexecutedLevel(), {}, {wires4}, {}, {});
 }
 
+TEST(GateKeeperTest, TestLevelsSpanningMultipleSlabs) {
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena<unsafe>();
+  auto gateKeeper = std::make_unique<GateKeeper>(wireKeeper);
+
+  // Enough gates on a single level to fill several slabs, repeated a few times
+  // so slabs of executed levels get reused.
+  const int numberOfGates = 5000;
+  for (int round = 0; round < 3; ++round) {
+    std::vector<IScheduler::WireId<IScheduler::Boolean>> inputWires;
+    for (int i = 0; i < numberOfGates; ++i) {
+      inputWires.push_back(gateKeeper->inputGate(static_cast<bool>(i & 1)));
+    }
+    std::vector<IScheduler::WireId<IScheduler::Boolean>> andWires;
+    for (int i = 0; i < numberOfGates; ++i) {
+      andWires.push_back(gateKeeper->normalGate(
+          INormalGate::GateType::NonFreeAnd,
+          inputWires.at(i),
+          inputWires.at(numberOfGates - 1 - i)));
+    }
+
+    testLevel(gateKeeper->popFirstUnexecutedLevel(), inputWires, {}, {}, {});
+    testLevel(gateKeeper->popFirstUnexecutedLevel(), andWires, {}, {}, {});
+
+    // Once the level is gone, the gates no longer hold references to the
+    // wires.
+    for (int i = 0; i < numberOfGates; ++i) {
+      wireKeeper->decreaseReferenceCount(inputWires.at(i));
+      wireKeeper->decreaseReferenceCount(andWires.at(i));
+      EXPECT_THROW(
+          wireKeeper->getBooleanValue(inputWires.at(i)), std::runtime_error);
+    }
+  }
+  EXPECT_FALSE(gateKeeper->hasReachedBatchingLimit());
+}
+
+TEST(GateKeeperTest, TestMultiXorWithoutInputs) {
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena<unsafe>();
+  auto gateKeeper = std::make_unique<GateKeeper>(wireKeeper);
+
+  EXPECT_THROW(gateKeeper->multiXorGate({}, {}, false), std::invalid_argument);
+  EXPECT_THROW(
+      gateKeeper->multiXorGateBatch({}, {}, true), std::invalid_argument);
+}
+
+TEST(GateKeeperTest, TestGatheringBeyondTheInput) {
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena<unsafe>();
+  auto gateKeeper = std::make_unique<GateKeeper>(wireKeeper);
+
+  auto src = gateKeeper->inputGateBatch(std::vector<bool>{true, false, true});
+  auto indexesBeyondTheInput =
+      std::make_shared<std::vector<uint32_t>>(std::vector<uint32_t>{0, 3});
+  EXPECT_THROW(
+      gateKeeper->gathering(src, indexesBeyondTheInput), std::runtime_error);
+
+  auto indexes =
+      std::make_shared<std::vector<uint32_t>>(std::vector<uint32_t>{2, 0});
+  auto gathered = gateKeeper->gathering(src, indexes);
+  EXPECT_EQ(wireKeeper->getBatchSize(gathered), 2);
+}
+
 } // namespace fbpcf::scheduler
@@ -50,6 +50,35 @@ TEST(SafeVectorArenaAllocatorTest, testAllocator) {
       std::make_unique<VectorArenaAllocator<int64_t, /*unsafe*/ false>>());
 }
 
+TEST(HugePageVectorArenaAllocatorTest, testAllocator) {
+  testAllocator<int64_t>(
+      std::make_unique<VectorArenaAllocator<int64_t, /*unsafe*/ false>>(
+          /*useHugePages*/ true));
+}
+
+TEST(VectorArenaAllocatorTest, testReferencesAreStableAcrossGrowth) {
+  VectorArenaAllocator<std::vector<uint64_t>, /*unsafe*/ false> arena;
+  auto firstId = arena.allocate(std::vector<uint64_t>(16, 7));
+  const auto* firstRecord = &arena.get(firstId);
+  const auto* firstPayload = arena.get(firstId).data();
+
+  // Force the arena through several rounds of growth.
+  std::vector<uint64_t> ids;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    ids.push_back(arena.allocate(std::vector<uint64_t>(1, i)));
+  }
+
+  EXPECT_EQ(&arena.get(firstId), firstRecord);
+  EXPECT_EQ(arena.get(firstId).data(), firstPayload);
+  EXPECT_EQ(arena.get(firstId), std::vector<uint64_t>(16, 7));
+  for (uint64_t i = 0; i < ids.size(); ++i) {
+    EXPECT_EQ(arena.get(ids.at(i)), std::vector<uint64_t>(1, i));
+  }
+
+  // Error: attempt to get a slot beyond the allocated capacity
+  EXPECT_THROW(arena.get(1ULL << 40), std::runtime_error);
+}
+
 TEST(UnorderedMapAllocatorTest, testAllocator) {
   testAllocator<int64_t>(std::make_unique<UnorderedMapAllocator<int64_t>>());
 }
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <folly/json.h>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "fbpcf/engine/DummySecretShareEngine.h"
+#include "fbpcf/engine/DummySecretShareEngineFactory.h"
+#include "fbpcf/scheduler/EagerScheduler.h"
+#include "fbpcf/scheduler/EagerSchedulerFactory.h"
+#include "fbpcf/scheduler/ExecutionTracer.h"
+#include "fbpcf/scheduler/LazyScheduler.h"
+#include "fbpcf/scheduler/LazySchedulerFactory.h"
+#include "fbpcf/scheduler/WireKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/GateKeeper.h"
+
+namespace fbpcf::scheduler {
+
+ExecutionTracer::LevelTrace createLevelTrace(
+    uint64_t level,
+    bool isFree,
+    std::chrono::steady_clock::time_point start) {
+  using std::chrono::microseconds;
+  return ExecutionTracer::LevelTrace{
+      .level = level,
+      .isFree = isFree,
+      .numberOfGates = 10,
+      .bytesSent = isFree ? 0 : uint64_t(100),
+      .bytesReceived = isFree ? 0 : uint64_t(200),
+      .start = start,
+      .duration = microseconds(isFree ? 5 : 50),
+      .gateComputation = microseconds(5),
+      .tupleGeneration = microseconds(isFree ? 0 : 10),
+      .networkOpening = microseconds(isFree ? 0 : 30),
+      .resultCollection = microseconds(isFree ? 0 : 5),
+  };
+}
+
+TEST(ExecutionTracerTest, testChromeTraceJson) {
+  ExecutionTracer tracer;
+  auto start = std::chrono::steady_clock::now();
+  tracer.recordLevel(createLevelTrace(0, true, start));
+  tracer.recordLevel(
+      createLevelTrace(1, false, start + std::chrono::microseconds(5)));
+
+  auto trace = folly::parseJson(tracer.toChromeTraceJson());
+  auto& events = trace["traceEvents"];
+
+  // process name, then per level: level slice, phases, traffic counter
+  ASSERT_EQ(events.size(), 1 + (1 + 1 + 1) + (1 + 4 + 1));
+  EXPECT_EQ(events[0]["ph"].asString(), "M");
+
+  EXPECT_EQ(events[1]["name"].asString(), "level 0");
+  EXPECT_EQ(events[1]["cat"].asString(), "free");
+  EXPECT_DOUBLE_EQ(events[1]["ts"].asDouble(), 0);
+  EXPECT_DOUBLE_EQ(events[1]["dur"].asDouble(), 5);
+  EXPECT_EQ(events[1]["args"]["gates"].asInt(), 10);
+  EXPECT_EQ(events[2]["name"].asString(), "gate computation");
+
+  EXPECT_EQ(events[4]["name"].asString(), "level 1");
+  EXPECT_EQ(events[4]["cat"].asString(), "non-free");
+  EXPECT_DOUBLE_EQ(events[4]["ts"].asDouble(), 5);
+  EXPECT_DOUBLE_EQ(events[4]["dur"].asDouble(), 50);
+  EXPECT_EQ(events[4]["args"]["bytesSent"].asInt(), 100);
+  EXPECT_EQ(events[4]["args"]["bytesReceived"].asInt(), 200);
+
+  // phases are laid out back to back inside the level
+  std::string phases[] = {
+      "gate computation",
+      "tuple generation",
+      "network opening",
+      "result collection"};
+  double expectedStart[] = {5, 10, 20, 50};
+  for (size_t i = 0; i < 4; i++) {
+    EXPECT_EQ(events[5 + i]["name"].asString(), phases[i]);
+    EXPECT_DOUBLE_EQ(events[5 + i]["ts"].asDouble(), expectedStart[i]);
+  }
+
+  EXPECT_EQ(events[9]["ph"].asString(), "C");
+  EXPECT_EQ(events[9]["args"]["bytesReceived"].asInt(), 200);
+}
+
+TEST(ExecutionTracerTest, testSummaryTable) {
+  ExecutionTracer tracer;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 4; i++) {
+    tracer.recordLevel(createLevelTrace(i, i % 2 == 0, start));
+  }
+
+  auto table = tracer.getSummaryTable();
+  auto nonFreeRow = table.substr(table.find("non-free"));
+  nonFreeRow = nonFreeRow.substr(0, nonFreeRow.find('\n'));
+  // 2 levels, 20 gates, 200 bytes sent, 400 bytes received
+  EXPECT_NE(nonFreeRow.find(" 2 "), std::string::npos);
+  EXPECT_NE(nonFreeRow.find(" 20 "), std::string::npos);
+  EXPECT_NE(nonFreeRow.find(" 200 "), std::string::npos);
+  EXPECT_NE(nonFreeRow.find(" 400 "), std::string::npos);
+  EXPECT_NE(nonFreeRow.find("0.060"), std::string::npos);
+  EXPECT_NE(table.find("total"), std::string::npos);
+
+  tracer.clear();
+  EXPECT_TRUE(tracer.getLevelTraces().empty());
+}
+
+template <typename SchedulerType>
+void testTracingScheduler(
+    std::unique_ptr<SchedulerType> scheduler,
+    bool expectFreeLevels) {
+  auto tracer = std::make_shared<ExecutionTracer>();
+  scheduler->setExecutionTracer(tracer);
+
+  auto a = scheduler->privateBooleanInput(true, 0);
+  auto b = scheduler->privateBooleanInput(true, 0);
+  auto c = scheduler->privateAndPrivate(a, b);
+  auto d = scheduler->privateXorPrivate(c, a);
+  auto e = scheduler->privateAndPrivate(c, d);
+  auto output = scheduler->openBooleanValueToParty(e, 0);
+  scheduler->getBooleanValue(output);
+
+  auto& levels = tracer->getLevelTraces();
+  ASSERT_FALSE(levels.empty());
+  uint64_t nonFreeGates = 0;
+  bool hasFreeLevel = false;
+  for (size_t i = 0; i < levels.size(); i++) {
+    if (i > 0) {
+      EXPECT_GT(levels[i].level, levels[i - 1].level);
+      EXPECT_GE(levels[i].start, levels[i - 1].start);
+    }
+    EXPECT_GE(
+        levels[i].duration,
+        levels[i].gateComputation + levels[i].tupleGeneration +
+            levels[i].networkOpening + levels[i].resultCollection);
+    if (levels[i].isFree) {
+      hasFreeLevel = true;
+      EXPECT_EQ(levels[i].networkOpening.count(), 0);
+    } else {
+      nonFreeGates += levels[i].numberOfGates;
+    }
+  }
+  EXPECT_EQ(hasFreeLevel, expectFreeLevels);
+  // two ANDs and one output
+  EXPECT_EQ(nonFreeGates, 3);
+
+  scheduler->setExecutionTracer(nullptr);
+  auto size = levels.size();
+  scheduler->getBooleanValue(scheduler->openBooleanValueToParty(c, 0));
+  EXPECT_EQ(tracer->getLevelTraces().size(), size);
+}
+
+TEST(ExecutionTracerTest, testLazyScheduler) {
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena</* unsafe */ false>();
+  testTracingScheduler(
+      std::make_unique<LazyScheduler>(
+          std::make_unique<engine::DummySecretShareEngine>(0),
+          wireKeeper,
+          std::make_unique<GateKeeper>(wireKeeper)),
+      true);
+}
+
+TEST(ExecutionTracerTest, testEagerScheduler) {
+  testTracingScheduler(
+      std::make_unique<EagerScheduler>(
+          std::make_unique<engine::DummySecretShareEngine>(0),
+          WireKeeper::createWithVectorArena</* unsafe */ false>()),
+      false);
+}
+
+template <typename SchedulerFactoryType>
+void testTracingSchedulerFactory(SchedulerFactoryType& factory) {
+  auto untraced = factory.create();
+  factory.enableExecutionTracing();
+  auto scheduler1 = factory.create();
+  auto scheduler2 = factory.create();
+  auto& tracers = factory.getExecutionTracers();
+  ASSERT_EQ(tracers.size(), 2);
+  EXPECT_NE(tracers.at(0), tracers.at(1));
+
+  auto runAnd = [](IScheduler& scheduler) {
+    auto a = scheduler.privateBooleanInput(true, 0);
+    auto b = scheduler.privateBooleanInput(false, 0);
+    scheduler.getBooleanValue(scheduler.openBooleanValueToParty(
+        scheduler.privateAndPrivate(a, b), 0));
+  };
+  runAnd(*untraced);
+  runAnd(*scheduler1);
+  EXPECT_FALSE(tracers.at(0)->getLevelTraces().empty());
+  EXPECT_TRUE(tracers.at(1)->getLevelTraces().empty());
+
+  // each scheduler numbers its levels on its own
+  auto size = tracers.at(0)->getLevelTraces().size();
+  runAnd(*scheduler2);
+  EXPECT_EQ(tracers.at(0)->getLevelTraces().size(), size);
+  EXPECT_EQ(
+      tracers.at(1)->getLevelTraces().front().level,
+      tracers.at(0)->getLevelTraces().front().level);
+}
+
+TEST(ExecutionTracerTest, testLazySchedulerFactory) {
+  LazySchedulerFactory</* unsafe */ false> factory(
+      std::make_unique<engine::DummySecretShareEngineFactory>(0));
+  testTracingSchedulerFactory(factory);
+}
+
+TEST(ExecutionTracerTest, testEagerSchedulerFactory) {
+  EagerSchedulerFactory</* unsafe */ false> factory(
+      std::make_unique<engine::DummySecretShareEngineFactory>(0));
+  testTracingSchedulerFactory(factory);
+}
+
+} // namespace fbpcf::scheduler
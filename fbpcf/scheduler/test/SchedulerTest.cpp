@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 #include <cstdint>
+#include <cstdlib>
 
 #include "fbpcf/engine/communication/IPartyCommunicationAgentFactory.h"
 #include "fbpcf/engine/communication/test/AgentFactoryCreationHelper.h"
@@ -513,6 +514,78 @@ TEST_P(SchedulerTestFixture, testXorBatch) {
   runWithScheduler(GetParam(), testXorBatch);
 }
 
+void testMultiXor(std::unique_ptr<IScheduler> scheduler, int8_t myID) {
+  for (auto v1 : {true, false}) {
+    for (auto v2 : {true, false}) {
+      // Private and public inputs, inverted
+      auto wire1 =
+          scheduler->getBooleanValue(scheduler->openBooleanValueToParty(
+              scheduler->multiXor(
+                  {scheduler->privateBooleanInput(v1, 0),
+                   scheduler->privateBooleanInput(v2, 1)},
+                  {scheduler->publicBooleanInput(v1)},
+                  true),
+              0));
+      if (myID == 0) {
+        EXPECT_EQ(wire1, !v2);
+      }
+
+      // Public inputs only
+      auto wire2 = scheduler->multiXor(
+          {},
+          {scheduler->publicBooleanInput(v1),
+           scheduler->publicBooleanInput(v2)},
+          false);
+      EXPECT_EQ(scheduler->getBooleanValue(wire2), v1 ^ v2);
+    }
+  }
+  scheduler->deleteEngine();
+  auto gateCount = scheduler->getGateStatistics();
+  EXPECT_EQ(gateCount.first, 4);
+  EXPECT_EQ(gateCount.second, 36);
+}
+
+TEST_P(SchedulerTestFixture, testMultiXor) {
+  runWithScheduler(GetParam(), testMultiXor);
+}
+
+void testMultiXorBatch(std::unique_ptr<IScheduler> scheduler, int8_t myID) {
+  for (auto v1 : {true, false}) {
+    for (auto v2 : {true, false}) {
+      // Private and public inputs, inverted
+      auto wire1 = scheduler->getBooleanValueBatch(
+          scheduler->openBooleanValueToPartyBatch(
+              scheduler->multiXorBatch(
+                  {scheduler->privateBooleanInputBatch({v1, v1}, 0),
+                   scheduler->privateBooleanInputBatch({v2, v1}, 1)},
+                  {scheduler->publicBooleanInputBatch({v2, v2})},
+                  true),
+              0));
+      if (myID == 0) {
+        testVectorEq(wire1, {!v1, !v2});
+      }
+
+      // Public inputs only
+      auto wire2 = scheduler->multiXorBatch(
+          {},
+          {scheduler->publicBooleanInputBatch({v1, v1}),
+           scheduler->publicBooleanInputBatch({v2, v1})},
+          false);
+      testVectorEq(
+          scheduler->getBooleanValueBatch(wire2), {v1 != v2, v1 != v1});
+    }
+  }
+
+  scheduler->deleteEngine();
+  auto gateCount = scheduler->getGateStatistics();
+  EXPECT_EQ(gateCount.first, 8);
+  EXPECT_EQ(gateCount.second, 72);
+}
+
+TEST_P(SchedulerTestFixture, testMultiXorBatch) {
+  runWithScheduler(GetParam(), testMultiXorBatch);
+}
+
 void testPlus(std::unique_ptr<IArithmeticScheduler> scheduler, int8_t myID) {
   for (auto v1 : {(uint64_t)1 << 63, (uint64_t)332}) {
     for (auto v2 : {(uint64_t)1 << 63, (uint64_t)89}) {
@@ -704,6 +777,148 @@ TEST_P(SchedulerTestFixture, testNegBatch) {
   runWithArithmeticScheduler(GetParam(), testNegBatch);
 }
 
+void testShareConversion(
+    std::unique_ptr<IArithmeticScheduler> scheduler,
+    int8_t myID) {
+  for (auto v : {(uint64_t)-1231, (uint64_t)5765, (uint64_t)1 << 63}) {
+    // Boolean to arithmetic
+    std::vector<IScheduler::WireId<IScheduler::Boolean>> bits;
+    for (size_t i = 0; i < 64; i++) {
+      bits.push_back(scheduler->privateBooleanInput((v >> i) & 1, 1));
+    }
+    auto wire1 = scheduler->getIntegerValue(scheduler->openIntegerValueToParty(
+        scheduler->privateBooleansToInteger(bits), 0));
+    if (myID == 0) {
+      EXPECT_EQ(wire1, v);
+    }
+
+    // Arithmetic to boolean, the secret is the sum of every party's bits
+    auto shareBits = scheduler->privateIntegerShareBits(
+        scheduler->privateIntegerInput(v, 0), 64);
+    uint64_t sum = 0;
+    for (auto& partyBits : shareBits) {
+      uint64_t share = 0;
+      for (size_t i = 0; i < partyBits.size(); i++) {
+        share |= (uint64_t)scheduler->getBooleanValue(
+                     scheduler->openBooleanValueToParty(partyBits.at(i), 1))
+            << i;
+      }
+      sum += share;
+    }
+    if (myID == 1) {
+      EXPECT_EQ(sum, v);
+    }
+  }
+
+  // at most 64 bits fit in an integer
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> bits(
+      65, scheduler->privateBooleanInput(true, 1));
+  EXPECT_THROW(
+      scheduler->privateBooleansToInteger(bits), std::invalid_argument);
+}
+
+TEST_P(SchedulerTestFixture, testShareConversion) {
+  runWithArithmeticScheduler(GetParam(), testShareConversion);
+}
+
+void testShareConversionBatch(
+    std::unique_ptr<IArithmeticScheduler> scheduler,
+    int8_t myID) {
+  std::vector<uint64_t> values = {(uint64_t)-1231, 5765, (uint64_t)1 << 63};
+
+  // Boolean to arithmetic
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> bits;
+  for (size_t i = 0; i < 64; i++) {
+    std::vector<bool> bitBatch;
+    for (auto v : values) {
+      bitBatch.push_back((v >> i) & 1);
+    }
+    bits.push_back(scheduler->privateBooleanInputBatch(bitBatch, 1));
+  }
+  auto wire1 =
+      scheduler->getIntegerValueBatch(scheduler->openIntegerValueToPartyBatch(
+          scheduler->privateBooleansToIntegerBatch(bits), 0));
+  if (myID == 0) {
+    testVectorEq(wire1, values);
+  }
+
+  // Arithmetic to boolean, the secret is the sum of every party's bits
+  auto shareBits = scheduler->privateIntegerShareBitsBatch(
+      scheduler->privateIntegerInputBatch(values, 0), 64);
+  std::vector<uint64_t> sums(values.size(), 0);
+  for (auto& partyBits : shareBits) {
+    std::vector<uint64_t> shares(values.size(), 0);
+    for (size_t i = 0; i < partyBits.size(); i++) {
+      auto bitBatch = scheduler->getBooleanValueBatch(
+          scheduler->openBooleanValueToPartyBatch(partyBits.at(i), 1));
+      for (size_t j = 0; j < values.size(); j++) {
+        shares[j] |= (uint64_t)bitBatch.at(j) << i;
+      }
+    }
+    for (size_t j = 0; j < values.size(); j++) {
+      sums[j] += shares[j];
+    }
+  }
+  if (myID == 1) {
+    testVectorEq(sums, values);
+  }
+
+  bits.push_back(bits.at(0));
+  EXPECT_THROW(
+      scheduler->privateBooleansToIntegerBatch(bits), std::invalid_argument);
+}
+
+TEST_P(SchedulerTestFixture, testShareConversionBatch) {
+  runWithArithmeticScheduler(GetParam(), testShareConversionBatch);
+}
+
+// Probabilistic truncation of a secret may be smaller by one.
+void testTruncation(
+    std::unique_ptr<IArithmeticScheduler> scheduler,
+    int8_t myID) {
+  for (auto v : {(int64_t)-123456789, (int64_t)987654321, (int64_t)-1}) {
+    auto wire1 = scheduler->getIntegerValue(scheduler->openIntegerValueToParty(
+        scheduler->truncatePrivate(scheduler->privateIntegerInput(v, 1), 10),
+        0));
+    if (myID == 0) {
+      EXPECT_LE(std::abs((int64_t)wire1 - (v >> 10)), 1);
+    }
+
+    auto wire2 = scheduler->getIntegerValue(
+        scheduler->truncatePublic(scheduler->publicIntegerInput(v), 10));
+    EXPECT_EQ((int64_t)wire2, v >> 10);
+  }
+}
+
+TEST_P(SchedulerTestFixture, testTruncation) {
+  runWithArithmeticScheduler(GetParam(), testTruncation);
+}
+
+void testTruncationBatch(
+    std::unique_ptr<IArithmeticScheduler> scheduler,
+    int8_t myID) {
+  std::vector<int64_t> values = {-123456789, 987654321, -1};
+  std::vector<uint64_t> input(values.begin(), values.end());
+
+  auto wire1 =
+      scheduler->getIntegerValueBatch(scheduler->openIntegerValueToPartyBatch(
+          scheduler->truncatePrivateBatch(
+              scheduler->privateIntegerInputBatch(input, 1), 10),
+          0));
+  auto wire2 = scheduler->getIntegerValueBatch(scheduler->truncatePublicBatch(
+      scheduler->publicIntegerInputBatch(input), 10));
+  for (size_t i = 0; i < values.size(); i++) {
+    if (myID == 0) {
+      EXPECT_LE(std::abs((int64_t)wire1.at(i) - (values[i] >> 10)), 1);
+    }
+    EXPECT_EQ((int64_t)wire2.at(i), values[i] >> 10);
+  }
+}
+
+TEST_P(SchedulerTestFixture, testTruncationBatch) {
+  runWithArithmeticScheduler(GetParam(), testTruncationBatch);
+}
+
 void testMultipleOperations(
     std::unique_ptr<IScheduler> scheduler,
     int8_t myID) {
@@ -992,6 +1207,25 @@ TEST_P(SchedulerTestFixture, testBatchingAndUnbatching) {
   runWithScheduler(GetParam(), testBatchingAndUnbatching);
 }
 
+void testGathering(std::unique_ptr<IScheduler> scheduler, int8_t myId) {
+  auto wire1 = scheduler->privateBooleanInputBatch(
+      {false, true, true, false, true, false}, 0);
+  auto wire2 = scheduler->gathering(
+      wire1,
+      std::make_shared<std::vector<uint32_t>>(
+          std::vector<uint32_t>({4, 0, 1, 1})));
+  EXPECT_EQ(scheduler->getBatchSize(wire2), 4);
+  auto revealed2 = scheduler->getBooleanValueBatch(
+      scheduler->openBooleanValueToPartyBatch(wire2, 0));
+  if (myId == 0) {
+    testVectorEq(revealed2, {true, false, true, true});
+  }
+}
+
+TEST_P(SchedulerTestFixture, testGathering) {
+  runWithScheduler(GetParam(), testGathering);
+}
+
 class CompositeSchedulerTestFixture
     : public ::testing::TestWithParam<std::tuple<SchedulerType, size_t>> {};
 
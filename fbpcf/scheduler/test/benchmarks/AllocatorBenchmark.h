@@ -53,4 +53,40 @@ inline void benchmarkGet(std::unique_ptr<IAllocator<T>> allocator, int n) {
   }
 }
 
+template <typename T>
+inline void benchmarkGrowth(
+    std::unique_ptr<IAllocator<std::vector<T>>> allocator,
+    int n,
+    size_t payloadSize) {
+  std::vector<std::vector<T>> payloads;
+  BENCHMARK_SUSPEND {
+    payloads = std::vector<std::vector<T>>(n, std::vector<T>(payloadSize));
+  }
+
+  // Each allocation moves a payload into the arena, so any additional cost
+  // comes from copying existing records when the arena grows.
+  while (n--) {
+    allocator->allocate(std::move(payloads.at(n)));
+  }
+}
+
+template <typename T>
+inline void benchmarkAllocateAndFree(
+    std::unique_ptr<IAllocator<T>> allocator,
+    int n) {
+  std::vector<uint64_t> refs;
+  BENCHMARK_SUSPEND {
+    refs.reserve(n);
+  }
+
+  // Keep half of the allocated items alive to mimic short-lived wires
+  // interleaved with long-lived ones.
+  for (auto i = 0; i < n; i++) {
+    refs.push_back(allocator->allocate(i));
+    if (i & 1) {
+      allocator->free(refs.at(i - 1));
+    }
+  }
+}
+
 } // namespace fbpcf::scheduler
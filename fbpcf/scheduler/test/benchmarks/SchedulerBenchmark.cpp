@@ -14,6 +14,8 @@
 #include "fbpcf/engine/util/test/benchmarks/NetworkedBenchmark.h"
 #include "fbpcf/scheduler/EagerSchedulerFactory.h"
 #include "fbpcf/scheduler/LazySchedulerFactory.h"
+#include "fbpcf/scheduler/WireKeeper.h"
+#include "fbpcf/scheduler/gate_keeper/GateKeeper.h"
 #include "fbpcf/scheduler/test/benchmarks/AllocatorBenchmark.h"
 #include "fbpcf/scheduler/test/benchmarks/WireKeeperBenchmark.h"
 
@@ -36,6 +38,26 @@ BENCHMARK(VectorArenaAllocator_get, n) {
       std::make_unique<VectorArenaAllocator<int64_t, unsafe>>(), n);
 }
 
+BENCHMARK(VectorArenaAllocator_allocateAndFree, n) {
+  benchmarkAllocateAndFree<int64_t>(
+      std::make_unique<VectorArenaAllocator<int64_t, unsafe>>(), n);
+}
+
+BENCHMARK(VectorArenaAllocator_growth, n) {
+  benchmarkGrowth<uint64_t>(
+      std::make_unique<VectorArenaAllocator<std::vector<uint64_t>, unsafe>>(),
+      n,
+      64);
+}
+
+BENCHMARK(VectorArenaAllocator_growthWithHugePages, n) {
+  benchmarkGrowth<uint64_t>(
+      std::make_unique<VectorArenaAllocator<std::vector<uint64_t>, unsafe>>(
+          /*useHugePages*/ true),
+      n,
+      64);
+}
+
 BENCHMARK(UnorderedMapAllocator_allocate, n) {
   benchmarkAllocate<int64_t>(
       std::make_unique<UnorderedMapAllocator<int64_t>>(), n);
@@ -49,6 +71,16 @@ BENCHMARK(UnorderedMapAllocator_get, n) {
   benchmarkGet<int64_t>(std::make_unique<UnorderedMapAllocator<int64_t>>(), n);
 }
 
+BENCHMARK(UnorderedMapAllocator_allocateAndFree, n) {
+  benchmarkAllocateAndFree<int64_t>(
+      std::make_unique<UnorderedMapAllocator<int64_t>>(), n);
+}
+
+BENCHMARK(UnorderedMapAllocator_growth, n) {
+  benchmarkGrowth<uint64_t>(
+      std::make_unique<UnorderedMapAllocator<std::vector<uint64_t>>>(), n, 64);
+}
+
 // WireKeeper benchmarks
 
 BENCHMARK(WireKeeperBenchmark_allocateBooleanValue, n) {
@@ -93,6 +125,77 @@ BENCHMARK(WireKeeperBenchmark_decreaseReferenceCount, n) {
   }
 }
 
+BENCHMARK(WireKeeperBenchmark_allocateBatchBooleanValue, n) {
+  BENCHMARK_WIREKEEPER_BATCH(1024) {
+    wireKeeper->allocateBatchBooleanValue(batchValue, 1024);
+  }
+}
+
+BENCHMARK(WireKeeperBenchmark_getBatchBooleanValue, n) {
+  BENCHMARK_WIREKEEPER_BATCH(1024) {
+    wireKeeper->getBatchBooleanValue(wireIds.at(n));
+  }
+}
+
+BENCHMARK(WireKeeperBenchmark_decreaseBatchReferenceCount, n) {
+  BENCHMARK_WIREKEEPER_BATCH(1024) {
+    wireKeeper->decreaseBatchReferenceCount(wireIds.at(n));
+  }
+}
+
+// GateKeeper benchmarks
+
+BENCHMARK(GateKeeper_addAndPopNormalGates, n) {
+  folly::BenchmarkSuspender braces;
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena<unsafe>();
+  auto gateKeeper = std::make_unique<GateKeeper>(wireKeeper);
+  auto left = gateKeeper->inputGate(true);
+  auto right = gateKeeper->inputGate(false);
+  braces.dismiss();
+
+  // Alternate between free and non-free levels, as a scalar circuit would.
+  while (n--) {
+    auto xorWire = gateKeeper->normalGate(
+        INormalGate::GateType::SymmetricXOR, left, right);
+    auto andWire =
+        gateKeeper->normalGate(INormalGate::GateType::NonFreeAnd, left, right);
+    auto level = wireKeeper->getFirstAvailableLevel(andWire);
+    wireKeeper->decreaseReferenceCount(xorWire);
+    wireKeeper->decreaseReferenceCount(andWire);
+    if (gateKeeper->hasReachedBatchingLimit()) {
+      while (gateKeeper->getFirstUnexecutedLevel() <= level) {
+        gateKeeper->popFirstUnexecutedLevel();
+      }
+    }
+  }
+}
+
+BENCHMARK(GateKeeper_addAndPopCompositeGates, n) {
+  folly::BenchmarkSuspender braces;
+  std::shared_ptr<IWireKeeper> wireKeeper =
+      WireKeeper::createWithVectorArena<unsafe>();
+  auto gateKeeper = std::make_unique<GateKeeper>(wireKeeper);
+  auto left = gateKeeper->inputGate(true);
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> rights(
+      8, gateKeeper->inputGate(false));
+  braces.dismiss();
+
+  while (n--) {
+    auto outputs = gateKeeper->compositeGate(
+        ICompositeGate::GateType::NonFreeAnd, left, rights);
+    auto level = wireKeeper->getFirstAvailableLevel(outputs.at(0));
+    for (auto& wire : outputs) {
+      wireKeeper->decreaseReferenceCount(wire);
+    }
+    if (gateKeeper->hasReachedBatchingLimit()) {
+      while (gateKeeper->getFirstUnexecutedLevel() <= level) {
+        gateKeeper->popFirstUnexecutedLevel();
+      }
+    }
+  }
+}
+
 // Scheduler benchmarks
 
 class SchedulerBenchmark : public engine::util::NetworkedBenchmark {
@@ -201,6 +304,22 @@ class NonFreeGatesBenchmark : virtual public SchedulerBenchmark {
   }
 };
 
+class FreeGatesBenchmark : virtual public SchedulerBenchmark {
+ protected:
+  void runMethod(std::unique_ptr<IScheduler>& scheduler) override {
+    auto wire1 = scheduler->privateBooleanInput(input0_, randomParty_);
+    auto wire2 = scheduler->privateBooleanInput(input1_, 1 - randomParty_);
+    for (auto i = 0; i < 100000; i++) {
+      auto wire3 = scheduler->privateXorPrivate(wire1, wire2);
+      scheduler->decreaseReferenceCount(wire1);
+      wire1 = wire2;
+      wire2 = wire3;
+    }
+    scheduler->getBooleanValue(
+        scheduler->openBooleanValueToParty(wire2, randomParty_));
+  }
+};
+
 class NonFreeGatesBatchBenchmark : virtual public SchedulerBenchmark {
  protected:
   void runMethod(std::unique_ptr<IScheduler>& scheduler) override {
@@ -289,6 +408,22 @@ BENCHMARK_COUNTERS(EagerScheduler_NonFreeGates, counters) {
   benchmark.runBenchmark(counters);
 }
 
+class LazyScheduler_FreeGates_Benchmark : public LazySchedulerBenchmark,
+                                          public FreeGatesBenchmark {};
+
+BENCHMARK_COUNTERS(LazyScheduler_FreeGates, counters) {
+  LazyScheduler_FreeGates_Benchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
+
+class EagerScheduler_FreeGates_Benchmark : public EagerSchedulerBenchmark,
+                                           public FreeGatesBenchmark {};
+
+BENCHMARK_COUNTERS(EagerScheduler_FreeGates, counters) {
+  EagerScheduler_FreeGates_Benchmark benchmark;
+  benchmark.runBenchmark(counters);
+}
+
 class LazyScheduler_NonFreeGatesBatch_Benchmark
     : public LazySchedulerBenchmark,
       public NonFreeGatesBatchBenchmark {};
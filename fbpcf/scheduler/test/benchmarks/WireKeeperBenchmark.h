@@ -25,4 +25,16 @@ namespace fbpcf::scheduler {
   braces.dismiss();                                              \
   while (n--)
 
+#define BENCHMARK_WIREKEEPER_BATCH(batchSize)                          \
+  folly::BenchmarkSuspender braces;                                    \
+  auto wireKeeper = WireKeeper::createWithVectorArena<unsafe>();       \
+  std::vector<IScheduler::WireId<IScheduler::Boolean>> wireIds;        \
+  std::vector<bool> batchValue(batchSize);                             \
+  for (auto i = 0; i < n; i++) {                                       \
+    wireIds.push_back(                                                 \
+        wireKeeper->allocateBatchBooleanValue(batchValue, batchSize)); \
+  }                                                                    \
+  braces.dismiss();                                                    \
+  while (n--)
+
 } // namespace fbpcf::scheduler